@@ -61,9 +61,16 @@
 #include <CGAL/Polygon_mesh_processing/stitch_borders.h> // only if non-manifoldness is not treated
 #include <CGAL/property_map.h>
 #include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
 
 #include <algorithm>
 #include <array>
+#include <bitset>
 #include <fstream>
 #include <functional>
 #include <iostream>
@@ -304,6 +311,14 @@ public:
     //   on the offset surface corresponding to that corresponding to the latter offset value.
     const bool refining = choose_parameter(get_parameter(in_np, internal_np::refine_triangulation), false);
 
+    // With `Parallel_tag`, the gates are taken from the queue by batches, whose Steiner points
+    // are computed in parallel (see alpha_flood_fill()).
+    using Concurrency_tag = typename internal_np::Lookup_named_param_def<
+                              internal_np::concurrency_tag_t,
+                              InputNamedParameters,
+                              Sequential_tag // default
+                            >::type;
+
 #ifdef CGAL_AW3_TIMER
     CGAL::Real_timer t;
     t.start();
@@ -325,7 +340,7 @@ public:
     dump_triangulation_faces("starting_wrap.off", true /*only_boundary_faces*/);
 #endif
 
-    alpha_flood_fill(visitor);
+    alpha_flood_fill<Concurrency_tag>(visitor);
 
 #ifdef CGAL_AW3_DEBUG_DUMP_INTERMEDIATE_WRAPS
     dump_triangulation_faces("flood_filled_wrap.off", true /*only_boundary_faces*/);
@@ -399,6 +414,96 @@ public:
     return operator()(default_alpha(), output_mesh);
   }
 
+  // Invalidates the wrap in the vicinity of `region`, typically after a modification of the input
+  // (the oracle) within `region`, which must contain both the previous and the new positions
+  // of the modified input. The next call with `refine_triangulation(true)` then only computes again
+  // the part of the wrap that depends on the modified input:
+  // - the Steiner points that could be on the offset surface of the modified input are removed,
+  // - the cells that could intersect the (offset) modified input are labeled "inside" again.
+  //
+  // The oracle must have been updated beforehand. If the input does not fit in the bounding box
+  // of the triangulation anymore, the triangulation is cleared and the next call starts from scratch.
+  void invalidate(const Bbox_3& region)
+  {
+#ifdef CGAL_AW3_DEBUG
+    std::cout << "> Invalidate " << region << std::endl;
+#endif
+
+    if(m_tr.dimension() != 3 || !is_positive(m_offset))
+      return;
+
+    // Manifold cells are outside cells
+    reset_manifold_labels();
+
+    const SC_Iso_cuboid_3 bbox = construct_bbox(CGAL::to_double(m_offset));
+    if(m_bbox.has_on_unbounded_side((bbox.min)()) || m_bbox.has_on_unbounded_side((bbox.max)()))
+    {
+#ifdef CGAL_AW3_DEBUG
+      std::cout << "Input out of the bounding box, clear the triangulation" << std::endl;
+#endif
+      m_tr.clear();
+#ifdef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
+      m_queue.clear();
+#else
+      m_queue = { };
+#endif
+      return;
+    }
+
+    // Steiner points are (approximately) at distance `offset` from the input: dilate the region
+    // with some margin.
+    const double d = 2 * CGAL::to_double(m_offset);
+    const Bbox_3 dilated_region(region.xmin() - d, region.ymin() - d, region.zmin() - d,
+                                region.xmax() + d, region.ymax() + d, region.zmax() + d);
+
+    std::vector<Vertex_handle> vertices_to_remove;
+    for(Vertex_handle v : m_tr.finite_vertex_handles())
+    {
+      if(v->type() == AW3i::Vertex_type::DEFAULT &&
+         do_overlap(dilated_region, m_tr.point(v).bbox()))
+        vertices_to_remove.push_back(v);
+    }
+
+#ifdef CGAL_AW3_DEBUG
+    std::cout << "Remove " << vertices_to_remove.size() << " Steiner points" << std::endl;
+#endif
+
+    // The new cells are labeled "inside"
+    for(Vertex_handle v : vertices_to_remove)
+      m_tr.remove(v);
+
+    std::size_t label_change_counter = 0;
+    for(Cell_handle ch : m_tr.finite_cell_handles())
+    {
+      if(!ch->is_outside())
+        continue;
+
+      const Bbox_3 ch_bbox = m_tr.point(ch, 0).bbox() + m_tr.point(ch, 1).bbox() +
+                             m_tr.point(ch, 2).bbox() + m_tr.point(ch, 3).bbox();
+      if(!do_overlap(dilated_region, ch_bbox) &&
+         !do_overlap(dilated_region, circumcenter(ch).bbox()))
+        continue;
+
+      ch->set_label(Cell_label::INSIDE);
+      ++label_change_counter;
+    }
+
+#ifdef CGAL_AW3_DEBUG
+    std::cout << label_change_counter << " label changes" << std::endl;
+#else
+    CGAL_USE(label_change_counter);
+#endif
+
+    // Gates of the previous run (if it was interrupted) might have become invalid,
+    // the queue is filled again
+#ifdef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
+    m_queue.clear();
+#else
+    m_queue = { };
+#endif
+    initialize_from_existing_triangulation();
+  }
+
   // This function is public only because it is used in the tests
   SC_Iso_cuboid_3 construct_bbox(const double offset)
   {
@@ -902,19 +1007,42 @@ private:
   {
     CGAL_precondition(!m_tr.is_infinite(neighbor));
 
+    return compute_steiner_point(ch, neighbor,
+                                 [&]() -> const Point_3& { return circumcenter(ch); },
+                                 circumcenter(neighbor), steiner_point);
+  }
+
+  // `ch_circumcenter()` returns the circumcenter of `ch`, which is only needed in some cases.
+  // If `depends_on_labels` is not null, it is set to `true` if the result depends on the labels
+  // of the neighbors of `neighbor`.
+  //
+  // This function does not modify the triangulation (nor the circumcenters cached in the cells)
+  // if `ch_circumcenter()` does not, and can then be called concurrently.
+  template <typename ChCircumcenter>
+  bool compute_steiner_point(const Cell_handle ch,
+                             const Cell_handle neighbor,
+                             const ChCircumcenter& ch_circumcenter,
+                             const Point_3& neighbor_cc,
+                             Point_3& steiner_point,
+                             bool* depends_on_labels = nullptr) const
+  {
+    CGAL_precondition(!m_tr.is_infinite(neighbor));
+
+    if(depends_on_labels != nullptr)
+      *depends_on_labels = false;
+
     typename Geom_traits::Construct_ball_3 ball = geom_traits().construct_ball_3_object();
     typename Geom_traits::Construct_vector_3 vector = geom_traits().construct_vector_3_object();
     typename Geom_traits::Construct_translated_point_3 translate = geom_traits().construct_translated_point_3_object();
     typename Geom_traits::Construct_scaled_vector_3 scale = geom_traits().construct_scaled_vector_3_object();
 
-    const Point_3& neighbor_cc = circumcenter(neighbor);
     const Ball_3 neighbor_cc_offset_ball = ball(neighbor_cc, m_sq_offset);
     const bool is_neighbor_cc_in_offset = m_oracle.do_intersect(neighbor_cc_offset_ball);
 
 #ifdef CGAL_AW3_DEBUG_STEINER_COMPUTATION
     std::cout << "Compute_steiner_point(" << &*ch << ", " << &*neighbor << ")" << std::endl;
 
-    const Point_3& chc = circumcenter(ch);
+    const Point_3& chc = ch_circumcenter();
     std::cout << "CH" << std::endl;
     std::cout << "\t" << ch->vertex(0)->point() << std::endl;
     std::cout << "\t" << ch->vertex(1)->point() << std::endl;
@@ -936,13 +1064,13 @@ private:
 #endif
 
     // ch's circumcenter should not be within the offset volume
-    CGAL_assertion_code(const Point_3& ch_cc = circumcenter(ch);)
+    CGAL_assertion_code(const Point_3& ch_cc = ch_circumcenter();)
     CGAL_assertion_code(const Ball_3 ch_cc_offset_ball = ball(ch_cc, m_sq_offset);)
     CGAL_assertion(!m_oracle.do_intersect(ch_cc_offset_ball));
 
     if(is_neighbor_cc_in_offset)
     {
-      const Point_3& ch_cc = circumcenter(ch);
+      const Point_3& ch_cc = ch_circumcenter();
 
       // If the voronoi edge intersects the offset, the steiner point is the first intersection
       if(m_oracle.first_intersection(ch_cc, neighbor_cc, steiner_point, m_offset))
@@ -954,6 +1082,9 @@ private:
       }
     }
 
+    if(depends_on_labels != nullptr)
+      *depends_on_labels = true;
+
     Tetrahedron_with_outside_info<Geom_traits> tet(neighbor, geom_traits());
     if(m_oracle.do_intersect(tet))
     {
@@ -983,6 +1114,96 @@ private:
     return false;
   }
 
+  // The result of the Steiner point computation for a gate can depend on the labels
+  // of the neighbors of the cell being entered (see `Tetrahedron_with_outside_info`)
+  std::bitset<4> outside_neighbors(const Cell_handle c) const
+  {
+    std::bitset<4> b;
+    for(int i=0; i<4; ++i)
+      if(c->neighbor(i)->is_outside())
+        b.set(i, true);
+    return b;
+  }
+
+#if defined(CGAL_LINKED_WITH_TBB) && !defined(CGAL_AW3_USE_SORTED_PRIORITY_QUEUE)
+  // Moves (at most `batch_size`) non-zombie gates from the top of the queue to `batch`,
+  // and computes their Steiner points in parallel.
+  void pop_batch_of_gates(std::vector<Gate>& batch)
+  {
+    constexpr std::size_t batch_size = 1024;
+
+    batch.clear();
+    while(!m_queue.empty() && batch.size() < batch_size)
+    {
+      if(!m_queue.top().is_zombie())
+        batch.push_back(m_queue.top());
+      m_queue.pop();
+    }
+
+    // The circumcenters are computed (and cached in the cells) sequentially, beforehand
+    std::vector<std::size_t> ids;
+    std::vector<Point_3> ch_circumcenters;
+    for(std::size_t i=0; i<batch.size(); ++i)
+    {
+      const Facet& f = batch[i].facet();
+      const Cell_handle nh = f.first->neighbor(f.second);
+      if(m_tr.is_infinite(nh))
+        continue;
+
+      ids.push_back(i);
+      ch_circumcenters.push_back(circumcenter(f.first));
+      circumcenter(nh);
+    }
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, ids.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t i=r.begin(); i!=r.end(); ++i)
+      {
+        Gate& gate = batch[ids[i]];
+        const Cell_handle ch = gate.facet().first;
+        const Cell_handle nh = ch->neighbor(gate.facet().second);
+
+        Point_3 steiner_point;
+        bool depends_on_labels;
+        const bool has_steiner_point =
+          compute_steiner_point(ch, nh,
+                                [&]() -> const Point_3& { return ch_circumcenters[i]; },
+                                nh->circumcenter(geom_traits()), steiner_point, &depends_on_labels);
+
+        gate.set_steiner_point(has_steiner_point, steiner_point,
+                               depends_on_labels, outside_neighbors(nh));
+      }
+    });
+  }
+#endif
+
+  // Returns `true` if the Steiner point of `gate` has been computed ahead of its treatment
+  // and is still valid, and puts it in `has_steiner_point` and `steiner_point`.
+  bool precomputed_steiner_point(const Gate& gate,
+                                 bool& has_steiner_point,
+                                 Point_3& steiner_point) const
+  {
+#ifndef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
+    const Facet& f = gate.facet();
+    if(!gate.is_steiner_point_computed())
+      return false;
+
+    if(gate.depends_on_labels() &&
+       gate.outside_neighbors() != outside_neighbors(f.first->neighbor(f.second)))
+      return false;
+
+    has_steiner_point = gate.has_steiner_point();
+    steiner_point = gate.steiner_point();
+    return true;
+#else
+    CGAL_USE(gate);
+    CGAL_USE(has_steiner_point);
+    CGAL_USE(steiner_point);
+    return false;
+#endif
+  }
+
 private:
   // A permissive gate is a gate that we can traverse without checking its circumradius
   enum class Facet_status
@@ -1135,12 +1356,16 @@ private:
 private:
   bool initialize(const double alpha,
                   const double offset,
-                  const bool refining)
+                  bool refining)
   {
 #ifdef CGAL_AW3_DEBUG
     std::cout << "> Initialize..." << std::endl;
 #endif
 
+    // Nothing to refine, e.g. if the triangulation has been cleared by `invalidate()`
+    if(m_tr.dimension() != 3)
+      refining = false;
+
     const bool resuming = refining && (alpha == m_alpha) && (offset == m_offset);
 
 #ifdef CGAL_AW3_DEBUG
@@ -1210,7 +1435,7 @@ private:
     }
   }
 
-  template <typename Visitor>
+  template <typename ConcurrencyTag, typename Visitor>
   bool alpha_flood_fill(Visitor& visitor)
   {
 #ifdef CGAL_AW3_DEBUG
@@ -1219,23 +1444,69 @@ private:
 
     visitor.on_flood_fill_begin(*this);
 
+    // In parallel, gates are taken from the top of the queue by batches, and the Steiner points
+    // of a batch are computed in parallel. The gates of the batch are then treated one at a time
+    // (in order), before the gates that were created meanwhile. The Steiner points of gates whose
+    // neighborhood has been modified since are computed again.
+    //
+    // The result does not depend on the number of threads, but can be different from
+    // the sequential result, as the gates are not treated in the same order.
+#if !defined(CGAL_LINKED_WITH_TBB)
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+    constexpr bool use_batches = false;
+#elif defined(CGAL_AW3_USE_SORTED_PRIORITY_QUEUE) // the sorted queue is always used sequentially
+    constexpr bool use_batches = false;
+#else
+    constexpr bool use_batches = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+#endif
+
+    std::vector<Gate> batch;
+    std::size_t batch_pos = 0;
+
+    auto pop_gate = [&]()
+    {
+      if constexpr(use_batches)
+        ++batch_pos;
+      else
+        m_queue.pop();
+    };
+
     // Explore all finite cells that are reachable from one of the initial outside cells.
-    while(!m_queue.empty())
+    while(!m_queue.empty() || batch_pos < batch.size())
     {
       if(!visitor.go_further(*this))
+      {
+        // put the remaining gates of the batch back in the queue
+        for(std::size_t i=batch.size(); i>batch_pos; --i)
+          m_queue.push(batch[i-1]);
         return false;
+      }
 
 #ifdef CGAL_AW3_DEBUG_QUEUE_PP
       check_queue_sanity();
 #endif
 
+#if defined(CGAL_LINKED_WITH_TBB) && !defined(CGAL_AW3_USE_SORTED_PRIORITY_QUEUE)
+      if constexpr(use_batches)
+      {
+        if(batch_pos == batch.size())
+        {
+          pop_batch_of_gates(batch);
+          batch_pos = 0;
+          if(batch.empty()) // only zombies
+            continue;
+        }
+      }
+#endif
+
       // const& to something that will be popped, but safe as `ch` && `id` are extracted before the pop
-      const Gate& gate = m_queue.top();
+      const Gate& gate = use_batches ? batch[batch_pos] : m_queue.top();
 
 #ifndef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
       if(gate.is_zombie())
       {
-        m_queue.pop();
+        pop_gate();
         continue;
       }
 #endif
@@ -1279,7 +1550,12 @@ private:
 
       visitor.before_facet_treatment(*this, gate);
 
-      m_queue.pop();
+      bool has_steiner_point = false;
+      Point_3 steiner_point;
+      const bool is_steiner_point_precomputed =
+        use_batches && precomputed_steiner_point(gate, has_steiner_point, steiner_point);
+
+      pop_gate();
 
       if(m_tr.is_infinite(nh))
       {
@@ -1290,8 +1566,10 @@ private:
         continue;
       }
 
-      Point_3 steiner_point;
-      if(compute_steiner_point(ch, nh, steiner_point))
+      if(!is_steiner_point_precomputed)
+        has_steiner_point = compute_steiner_point(ch, nh, steiner_point);
+
+      if(has_steiner_point)
       {
 //        std::cout << CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset)
 //                  << " vs " << 1e-2 * m_offset << std::endl;
@@ -20,6 +20,7 @@
 
 #include <boost/property_map/property_map.hpp>
 
+#include <bitset>
 #include <cassert>
 #include <iostream>
 
@@ -100,12 +101,22 @@ class Gate
 {
   using Facet = typename Tr::Facet;
   using FT = typename Tr::Geom_traits::FT;
+  using Point_3 = typename Tr::Geom_traits::Point_3;
 
 private:
   Facet m_facet, m_mirror_facet;
   const unsigned int m_erase_counter_mem;
   const unsigned int m_mirror_erase_counter_mem;
 
+  // Steiner point computed ahead of the treatment of the gate (parallel flood fill).
+  // It remains valid as long as the gate is not a zombie and, if the computation
+  // depends on them, the labels of the neighbors of the mirror cell are unchanged.
+  bool m_is_steiner_point_computed = false;
+  bool m_has_steiner_point = false;
+  bool m_depends_on_labels = false;
+  std::bitset<4> m_outside_neighbors;
+  Point_3 m_steiner_point;
+
 public:
   // Constructors
   Gate(const Facet& facet,
@@ -126,6 +137,24 @@ public:
     return (m_facet.first->erase_counter() != m_erase_counter_mem) ||
            (m_mirror_facet.first->erase_counter() != m_mirror_erase_counter_mem);
   }
+
+  bool is_steiner_point_computed() const { return m_is_steiner_point_computed; }
+  bool has_steiner_point() const { return m_has_steiner_point; }
+  const Point_3& steiner_point() const { return m_steiner_point; }
+  bool depends_on_labels() const { return m_depends_on_labels; }
+  const std::bitset<4>& outside_neighbors() const { return m_outside_neighbors; }
+
+  void set_steiner_point(const bool has_steiner_point,
+                         const Point_3& steiner_point,
+                         const bool depends_on_labels,
+                         const std::bitset<4>& outside_neighbors)
+  {
+    m_is_steiner_point_computed = true;
+    m_has_steiner_point = has_steiner_point;
+    m_steiner_point = steiner_point;
+    m_depends_on_labels = depends_on_labels;
+    m_outside_neighbors = outside_neighbors;
+  }
 };
 
 #endif // CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
@@ -71,6 +71,15 @@ namespace CGAL {
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel, the Steiner points of batches of gates are computed ahead of time.
+*                     The gates are then not treated in the same order, and the output may differ
+*                     from the sequential output. It does not depend on the number of threads.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -218,6 +227,15 @@ void alpha_wrap_3(const PointRange& points,
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel, the Steiner points of batches of gates are computed ahead of time.
+*                     The gates are then not treated in the same order, and the output may differ
+*                     from the sequential output. It does not depend on the number of threads.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -304,6 +322,15 @@ void alpha_wrap_3(const TriangleMesh& tmesh,
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{In parallel, the Steiner points of batches of gates are computed ahead of time.
+*                     The gates are then not treated in the same order, and the output may differ
+*                     from the sequential output. It does not depend on the number of threads.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
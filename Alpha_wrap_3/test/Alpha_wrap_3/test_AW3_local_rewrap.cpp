@@ -0,0 +1,152 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/alpha_wrap_3.h>
+#include <CGAL/Alpha_wrap_3/internal/validation.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Real_timer.h>
+
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Checks that the wrap can be computed again after a local modification of the input,
+// by invalidating only the region of the modification
+
+namespace AW3 = CGAL::Alpha_wraps_3;
+
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point_3 = Kernel::Point_3;
+using Vector_3 = Kernel::Vector_3;
+
+using Points = std::vector<Point_3>;
+using Face = std::array<std::size_t, 3>;
+using Faces = std::vector<Face>;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+using Oracle = AW3::internal::Triangle_soup_oracle<Kernel>;
+using Wrapper = AW3::internal::Alpha_wrapper_3<Oracle>;
+
+struct Soup
+{
+  Points points;
+  Faces faces;
+};
+
+// The input is made of two parts: `part` and a copy of `part` translated by `t`
+Soup make_input(const Soup& part, const Vector_3& t)
+{
+  Soup input = part;
+  const std::size_t nv = part.points.size();
+  for(const Point_3& p : part.points)
+    input.points.push_back(p + t);
+  for(const Face& f : part.faces)
+    input.faces.push_back(Face{f[0] + nv, f[1] + nv, f[2] + nv});
+  return input;
+}
+
+CGAL::Bbox_3 bbox(const Points& points)
+{
+  CGAL::Bbox_3 bb;
+  for(const Point_3& p : points)
+    bb += p.bbox();
+  return bb;
+}
+
+// The wraps are not computed in the same order, but they should be similar
+bool are_similar(const Mesh& wrap_1, const Mesh& wrap_2)
+{
+  const double nv_1 = static_cast<double>(num_vertices(wrap_1));
+  const double nv_2 = static_cast<double>(num_vertices(wrap_2));
+  return (0.8 * nv_1 < nv_2) && (nv_2 < 1.2 * nv_1);
+}
+
+void check_wrap(Wrapper& wrapper,
+                const Soup& input,
+                const double alpha,
+                const double offset)
+{
+  wrapper.oracle() = Oracle();
+  wrapper.oracle().add_triangle_soup(input.points, input.faces);
+
+  CGAL::Real_timer t;
+  t.start();
+  Mesh wrap;
+  wrapper(alpha, offset, wrap, CGAL::parameters::refine_triangulation(true));
+  t.stop();
+
+  std::cout << "Local rewrap: " << num_vertices(wrap) << " vertices, " << t.time() << " s." << std::endl;
+  assert(AW3::internal::is_valid_wrap(wrap));
+  assert(AW3::internal::is_outer_wrap_of_triangle_soup(wrap, input.points, input.faces));
+
+  t.reset();
+  t.start();
+  Mesh ref_wrap;
+  CGAL::alpha_wrap_3(input.points, input.faces, alpha, offset, ref_wrap);
+  t.stop();
+
+  std::cout << "From scratch: " << num_vertices(ref_wrap) << " vertices, " << t.time() << " s." << std::endl;
+  assert(are_similar(ref_wrap, wrap));
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : "data/bunny_random_perturbation.off";
+
+  Soup part;
+  bool res = CGAL::IO::read_polygon_soup(filename, part.points, part.faces);
+  assert(res && !part.faces.empty());
+
+  const CGAL::Bbox_3 part_bbox = bbox(part.points);
+  const double diag_length = std::sqrt(CGAL::square(part_bbox.xmax() - part_bbox.xmin()) +
+                                       CGAL::square(part_bbox.ymax() - part_bbox.ymin()) +
+                                       CGAL::square(part_bbox.zmax() - part_bbox.zmin()));
+  const double alpha = diag_length / 30.;
+  const double offset = diag_length / 600.;
+
+  const Vector_3 t(1.5 * diag_length, 0, 0);
+  Soup input = make_input(part, t);
+
+  Wrapper wrapper;
+  wrapper.oracle().add_triangle_soup(input.points, input.faces);
+
+  Mesh wrap;
+  wrapper(alpha, offset, wrap);
+  std::cout << "Initial wrap: " << num_vertices(wrap) << " vertices" << std::endl;
+  assert(AW3::internal::is_valid_wrap(wrap));
+
+  // move the second part a little (within the bounding box of the input)
+  std::cout << "== Local move ==" << std::endl;
+  const Vector_3 t2 = t + Vector_3(- 0.3 * diag_length, 0, 0);
+  Soup moved_input = make_input(part, t2);
+  CGAL::Bbox_3 region = bbox(Points(input.points.begin() + part.points.size(), input.points.end()));
+  region += bbox(Points(moved_input.points.begin() + part.points.size(), moved_input.points.end()));
+
+  wrapper.oracle() = Oracle();
+  wrapper.oracle().add_triangle_soup(moved_input.points, moved_input.faces);
+  wrapper.invalidate(region);
+  check_wrap(wrapper, moved_input, alpha, offset);
+
+  // move the second part out of the bounding box: starts from scratch
+  std::cout << "== Large move ==" << std::endl;
+  const Vector_3 t3 = t + Vector_3(0, 2 * diag_length, 0);
+  Soup far_input = make_input(part, t3);
+  region = bbox(Points(moved_input.points.begin() + part.points.size(), moved_input.points.end()));
+  region += bbox(Points(far_input.points.begin() + part.points.size(), far_input.points.end()));
+
+  wrapper.oracle() = Oracle();
+  wrapper.oracle().add_triangle_soup(far_input.points, far_input.faces);
+  wrapper.invalidate(region);
+  check_wrap(wrapper, far_input, alpha, offset);
+
+  // refine from the last wrap with a smaller alpha
+  std::cout << "== Smaller alpha ==" << std::endl;
+  check_wrap(wrapper, far_input, alpha / 2, offset);
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,108 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/alpha_wrap_3.h>
+#include <CGAL/Alpha_wrap_3/internal/validation.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/IO/polygon_soup_io.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Checks the wraps computed with `Parallel_tag`: they are valid, deterministic,
+// and similar to the wraps computed with `Sequential_tag`
+
+namespace AW3i = CGAL::Alpha_wraps_3::internal;
+
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point_3 = Kernel::Point_3;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+#ifdef CGAL_LINKED_WITH_TBB
+using Concurrency_tag = CGAL::Parallel_tag;
+#else
+using Concurrency_tag = CGAL::Sequential_tag;
+#endif
+
+bool are_identical(const Mesh& wrap_1, const Mesh& wrap_2)
+{
+  if(num_vertices(wrap_1) != num_vertices(wrap_2) || num_faces(wrap_1) != num_faces(wrap_2))
+    return false;
+
+  return std::equal(wrap_1.points().begin(), wrap_1.points().end(), wrap_2.points().begin());
+}
+
+// The gates are not treated in the same order, but the wraps are similar
+bool are_similar(const Mesh& sequential_wrap, const Mesh& parallel_wrap)
+{
+  const double nv_seq = static_cast<double>(num_vertices(sequential_wrap));
+  const double nv_par = static_cast<double>(num_vertices(parallel_wrap));
+  return (0.8 * nv_seq < nv_par) && (nv_par < 1.2 * nv_seq);
+}
+
+void test_triangle_soup(const std::string& filename,
+                        const double relative_alpha,
+                        const double relative_offset,
+                        const bool use_seeds)
+{
+  std::cout << "== " << filename << " ==" << std::endl;
+
+  std::vector<Point_3> points;
+  std::vector<std::array<std::size_t, 3> > faces;
+  bool res = CGAL::IO::read_polygon_soup(filename, points, faces);
+  assert(res && !faces.empty());
+
+  CGAL::Bbox_3 bbox;
+  for(const Point_3& p : points)
+    bbox += p.bbox();
+
+  const double diag_length = std::sqrt(CGAL::square(bbox.xmax() - bbox.xmin()) +
+                                       CGAL::square(bbox.ymax() - bbox.ymin()) +
+                                       CGAL::square(bbox.zmax() - bbox.zmin()));
+  const double alpha = diag_length / relative_alpha;
+  const double offset = diag_length / relative_offset;
+
+  Mesh sequential_wrap, parallel_wrap, parallel_wrap_2;
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, sequential_wrap);
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, parallel_wrap,
+                     CGAL::parameters::concurrency_tag(Concurrency_tag()));
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, parallel_wrap_2,
+                     CGAL::parameters::concurrency_tag(Concurrency_tag()));
+
+  std::cout << num_vertices(sequential_wrap) << " vertices (sequential), "
+            << num_vertices(parallel_wrap) << " vertices (parallel)" << std::endl;
+  assert(AW3i::is_valid_wrap(parallel_wrap));
+  assert(AW3i::is_outer_wrap_of_triangle_soup(parallel_wrap, points, faces));
+  assert(are_identical(parallel_wrap, parallel_wrap_2));
+  assert(are_similar(sequential_wrap, parallel_wrap));
+
+  if(!use_seeds)
+    return;
+
+  // starting from seeds, the wrap is then an inner wrap
+  std::vector<Point_3> seeds = { CGAL::midpoint(Point_3(bbox.xmin(), bbox.ymin(), bbox.zmin()),
+                                                Point_3(bbox.xmax(), bbox.ymax(), bbox.zmax())) };
+  Mesh parallel_seeded_wrap, parallel_seeded_wrap_2;
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, parallel_seeded_wrap,
+                     CGAL::parameters::seed_points(std::ref(seeds))
+                                      .concurrency_tag(Concurrency_tag()));
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, parallel_seeded_wrap_2,
+                     CGAL::parameters::seed_points(std::ref(seeds))
+                                      .concurrency_tag(Concurrency_tag()));
+  assert(AW3i::is_valid_wrap(parallel_seeded_wrap));
+  assert(are_identical(parallel_seeded_wrap, parallel_seeded_wrap_2));
+}
+
+int main(int argc, char** argv)
+{
+  test_triangle_soup(argc > 1 ? argv[1] : "data/bunny_random_perturbation.off", 30., 600., true);
+  test_triangle_soup("data/three_knives.off", 10., 300., false);
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,469 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_SPARSE_IMAGE_3_H
+#define CGAL_SPARSE_IMAGE_3_H
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/basic.h>
+#include <CGAL/Image_3.h>
+#include <CGAL/ImageIO.h>
+#include <CGAL/assertions.h>
+#include <CGAL/function_objects.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace CGAL {
+
+/// Brick-sparse storage of a 3D image, with the same conventions as `Image_3`:
+/// the value of the voxel `(i, j, k)` is the value at the point
+/// `(i * vx(), j * vy(), k * vz())` relative to the origin `(tx(), ty(), tz())`.
+///
+/// The image is split into cubic bricks of `brick_size`^3 voxels. A brick whose voxels
+/// all have the same value (typically, the background of a segmented image) only stores
+/// that value, so that the memory used by a mostly uniform image is much smaller than
+/// the one of `Image_3`.
+///
+/// The queries optionally take a `Brick_cache`, which keeps the recently accessed bricks.
+/// A cache must not be shared by several threads.
+template <typename Word_type, std::size_t brick_size = 8>
+class Sparse_image_3
+{
+  static_assert(brick_size >= 2 && (brick_size & (brick_size - 1)) == 0,
+                "The size of the bricks must be a power of two.");
+
+  static constexpr std::size_t brick_mask = brick_size - 1;
+  static constexpr std::size_t brick_volume = brick_size * brick_size * brick_size;
+  static constexpr std::uint32_t uniform_brick = (std::numeric_limits<std::uint32_t>::max)();
+
+  // A reference to a brick: its voxels if they are stored, or its unique value
+  struct Brick_ref
+  {
+    const Word_type* data;
+    Word_type value;
+
+    Word_type operator[](std::size_t i) const { return (data == nullptr) ? value : data[i]; }
+  };
+
+public:
+  typedef Word_type word_type;
+
+  /// Direct-mapped cache of the bricks accessed recently by a thread
+  class Brick_cache
+  {
+    friend class Sparse_image_3;
+
+    static constexpr std::size_t cache_size = 8;
+
+    std::array<std::size_t, cache_size> bricks;
+    std::array<Brick_ref, cache_size> refs;
+    const Sparse_image_3* image = nullptr;
+
+  public:
+    Brick_cache() { clear(); }
+
+    void clear()
+    {
+      bricks.fill((std::numeric_limits<std::size_t>::max)());
+    }
+  };
+
+public:
+  Sparse_image_3() { }
+
+  /// Copies `image`, whose word type must be `Word_type`
+  explicit Sparse_image_3(const Image_3& image)
+  {
+    CGAL_precondition(image.is_valid());
+
+    CGAL_precondition_code(std::size_t word_size = 0;)
+    CGAL_precondition_code(CGAL_IMAGE_IO_CASE(image.image(), word_size = sizeof(Word);))
+    CGAL_precondition(word_size == sizeof(Word_type));
+
+    const Word_type* data = static_cast<const Word_type*>(image.data());
+    const std::size_t dimx = image.xdim(), dimxy = dimx * image.ydim();
+    build(image.xdim(), image.ydim(), image.zdim(),
+          image.vx(), image.vy(), image.vz(),
+          image.tx(), image.ty(), image.tz(),
+          [&](std::size_t i, std::size_t j, std::size_t k) { return data[k * dimxy + j * dimx + i]; });
+  }
+
+  /// Builds the image of dimensions `xdim` x `ydim` x `zdim` whose voxel `(i, j, k)`
+  /// has value `value(i, j, k)`. The bricks are filled one after the other, so that the
+  /// image is never stored densely (`value` may for example read a file on demand).
+  template <typename Function>
+  Sparse_image_3(std::size_t xdim, std::size_t ydim, std::size_t zdim,
+                 double vx, double vy, double vz,
+                 const Function& value,
+                 double tx = 0, double ty = 0, double tz = 0)
+  {
+    build(xdim, ydim, zdim, vx, vy, vz, tx, ty, tz, value);
+  }
+
+  bool is_valid() const { return !offsets.empty(); }
+
+  std::size_t xdim() const { return dim[0]; }
+  std::size_t ydim() const { return dim[1]; }
+  std::size_t zdim() const { return dim[2]; }
+
+  std::size_t size() const { return xdim() * ydim() * zdim(); }
+
+  double vx() const { return voxel_size[0]; }
+  double vy() const { return voxel_size[1]; }
+  double vz() const { return voxel_size[2]; }
+
+  double tx() const { return origin[0]; }
+  double ty() const { return origin[1]; }
+  double tz() const { return origin[2]; }
+
+  std::size_t number_of_bricks() const { return offsets.size(); }
+
+  /// Returns the number of bricks whose voxels are stored, that is which are not uniform
+  std::size_t number_of_stored_bricks() const { return pool.size() / brick_volume; }
+
+  /// Returns the number of bytes used to store the image
+  std::size_t memory_size() const
+  {
+    return pool.capacity() * sizeof(Word_type)
+         + offsets.capacity() * sizeof(std::uint32_t)
+         + uniform_values.capacity() * sizeof(Word_type);
+  }
+
+  Word_type value(std::size_t i, std::size_t j, std::size_t k) const
+  {
+    return get_brick(brick_index(i, j, k))[voxel_index(i, j, k)];
+  }
+
+  Word_type value(std::size_t i, std::size_t j, std::size_t k, Brick_cache& cache) const
+  {
+    return get_brick(brick_index(i, j, k), cache)[voxel_index(i, j, k)];
+  }
+
+public:
+  /// Same as `Image_3::trilinear_interpolation()`
+  template <typename Target_type, typename Coord_type, class Image_transform = CGAL::Identity<Word_type> >
+  Target_type
+  trilinear_interpolation(const Coord_type& x,
+                          const Coord_type& y,
+                          const Coord_type& z,
+                          const Target_type& value_outside = Target_type(),
+                          Image_transform transform = Image_transform()) const
+  {
+    Brick_cache cache;
+    return trilinear_interpolation(x, y, z, value_outside, cache, transform);
+  }
+
+  template <typename Target_type, typename Coord_type, class Image_transform = CGAL::Identity<Word_type> >
+  Target_type
+  trilinear_interpolation(const Coord_type& x,
+                          const Coord_type& y,
+                          const Coord_type& z,
+                          const Target_type& value_outside,
+                          Brick_cache& cache,
+                          Image_transform transform = Image_transform()) const
+  {
+    Corners<Coord_type> corners;
+    if(!gather_corners(x, y, z, cache, corners))
+      return value_outside;
+
+    std::array<Target_type, 8> values;
+    for(int n=0; n<8; ++n)
+      values[n] = Target_type(transform(corners.values[n]));
+    return interpolate(corners, values);
+  }
+
+  /// Same as `Image_3::labellized_trilinear_interpolation()`: returns the label
+  /// whose indicator function has the largest trilinear interpolation at `(x, y, z)`.
+  /// The voxels are read once, and the uniform bricks are handled without interpolation.
+  template <typename Coord_type, typename Target_type>
+  Target_type
+  labellized_trilinear_interpolation(const Coord_type& x,
+                                     const Coord_type& y,
+                                     const Coord_type& z,
+                                     const Target_type& value_outside = Target_type()) const
+  {
+    Brick_cache cache;
+    return labellized_trilinear_interpolation(x, y, z, value_outside, cache);
+  }
+
+  template <typename Coord_type, typename Target_type>
+  Target_type
+  labellized_trilinear_interpolation(const Coord_type& x,
+                                     const Coord_type& y,
+                                     const Coord_type& z,
+                                     const Target_type& value_outside,
+                                     Brick_cache& cache) const
+  {
+    Corners<Coord_type> corners;
+    if(!gather_corners(x, y, z, cache, corners))
+      return value_outside;
+    if(corners.uniform)
+      return static_cast<Target_type>(corners.values[0]);
+
+    // distinct labels, in the order of `Image_3::labellized_trilinear_interpolation()`
+    static constexpr int order[8] = { 0, 4, 3, 7, 1, 5, 2, 6 };
+    std::array<Word_type, 8> labels;
+    labels[0] = corners.values[order[0]];
+    int lc = 1;
+    for(int n=1; n<8; ++n)
+    {
+      const Word_type w = corners.values[order[n]];
+      bool found = false;
+      for(int l=0; l<lc; ++l)
+      {
+        if(w == labels[l])
+        {
+          found = true;
+          break;
+        }
+      }
+      if(!found)
+        labels[lc++] = w;
+    }
+
+    if(lc == 1)
+      return static_cast<Target_type>(labels[0]);
+
+    double best_value = 0.;
+    Word_type best = 0;
+    std::array<double, 8> indicator;
+    for(int l=0; l<lc; ++l)
+    {
+      for(int n=0; n<8; ++n)
+        indicator[n] = (corners.values[n] == labels[l]) ? 1. : 0.;
+
+      const double r = interpolate(corners, indicator);
+      if(r > best_value)
+      {
+        best = labels[l];
+        best_value = r;
+      }
+    }
+    return static_cast<Target_type>(best);
+  }
+
+private:
+  // The 8 voxels around a point, in the order `a, b, c, d, e, f, g, h`
+  // of `Image_3::trilinear_interpolation()`, and the local coordinates of the point
+  template <typename Coord_type>
+  struct Corners
+  {
+    std::array<Word_type, 8> values;
+    bool uniform;
+    int i1, j1, k1;
+    Coord_type lx, ly, lz;
+  };
+
+  template <typename Coord_type>
+  bool gather_corners(const Coord_type& x, const Coord_type& y, const Coord_type& z,
+                      Brick_cache& cache,
+                      Corners<Coord_type>& corners) const
+  {
+    // Check on double/float coordinates, because (int)-0.1 gives 0
+    if(x < 0 || y < 0 || z < 0)
+      return false;
+
+    corners.lx = static_cast<Coord_type>(x / vx());
+    corners.ly = static_cast<Coord_type>(y / vy());
+    corners.lz = static_cast<Coord_type>(z / vz());
+    if(corners.lx < 0 || corners.ly < 0 || corners.lz < 0 ||
+       corners.lz >= Coord_type(zdim()-1) ||
+       corners.ly >= Coord_type(ydim()-1) ||
+       corners.lx >= Coord_type(xdim()-1))
+    {
+      return false;
+    }
+
+    // images are indexed by (z,y,x)
+    corners.i1 = (int)(corners.lz);
+    corners.j1 = (int)(corners.ly);
+    corners.k1 = (int)(corners.lx);
+
+    const std::size_t x1 = corners.k1, y1 = corners.j1, z1 = corners.i1;
+    if((x1 & brick_mask) != brick_mask &&
+       (y1 & brick_mask) != brick_mask &&
+       (z1 & brick_mask) != brick_mask)
+    {
+      // the 8 voxels are in the same brick
+      const Brick_ref brick = get_brick(brick_index(x1, y1, z1), cache);
+      if(brick.data == nullptr)
+      {
+        corners.values.fill(brick.value);
+        corners.uniform = true;
+        return true;
+      }
+
+      const Word_type* ptr = brick.data + voxel_index(x1, y1, z1);
+      constexpr std::size_t dx = 1, dy = brick_size, dz = brick_size * brick_size;
+      corners.values = { ptr[0], ptr[dz], ptr[dz + dy], ptr[dy],
+                         ptr[dx], ptr[dz + dx], ptr[dz + dy + dx], ptr[dy + dx] };
+    }
+    else
+    {
+      corners.values = { value(x1, y1, z1, cache),
+                         value(x1, y1, z1 + 1, cache),
+                         value(x1, y1 + 1, z1 + 1, cache),
+                         value(x1, y1 + 1, z1, cache),
+                         value(x1 + 1, y1, z1, cache),
+                         value(x1 + 1, y1, z1 + 1, cache),
+                         value(x1 + 1, y1 + 1, z1 + 1, cache),
+                         value(x1 + 1, y1 + 1, z1, cache) };
+    }
+
+    corners.uniform = false;
+    return true;
+  }
+
+  // Same arithmetic as `Image_3::trilinear_interpolation()`
+  template <typename Coord_type, typename Target_type>
+  static Target_type interpolate(const Corners<Coord_type>& corners,
+                                 const std::array<Target_type, 8>& v)
+  {
+    const int i2 = corners.i1 + 1;
+    const int j2 = corners.j1 + 1;
+    const int k2 = corners.k1 + 1;
+
+    const Target_type di2 = i2 - corners.lz;
+    const Target_type di1 = corners.lz - corners.i1;
+    const Target_type dj2 = j2 - corners.ly;
+    const Target_type dj1 = corners.ly - corners.j1;
+    const Target_type dk2 = k2 - corners.lx;
+    const Target_type dk1 = corners.lx - corners.k1;
+
+    const Target_type& a = v[0]; const Target_type& b = v[1];
+    const Target_type& c = v[2]; const Target_type& d = v[3];
+    const Target_type& e = v[4]; const Target_type& f = v[5];
+    const Target_type& g = v[6]; const Target_type& h = v[7];
+
+    return ( (  ( a * di2 + b * di1 ) * dj2 +
+                ( d * di2 + c * di1 ) * dj1   ) * dk2 +
+             (  ( e * di2 + f * di1 ) * dj2 +
+                ( h * di2 + g * di1 ) * dj1   ) * dk1 );
+  }
+
+  std::size_t brick_index(std::size_t i, std::size_t j, std::size_t k) const
+  {
+    CGAL_precondition(i < xdim() && j < ydim() && k < zdim());
+    return ((k / brick_size) * nb_bricks[1] + (j / brick_size)) * nb_bricks[0] + (i / brick_size);
+  }
+
+  static std::size_t voxel_index(std::size_t i, std::size_t j, std::size_t k)
+  {
+    return ((k & brick_mask) * brick_size + (j & brick_mask)) * brick_size + (i & brick_mask);
+  }
+
+  Brick_ref get_brick(std::size_t b) const
+  {
+    const std::uint32_t offset = offsets[b];
+    if(offset == uniform_brick)
+      return Brick_ref{ nullptr, uniform_values[b] };
+    return Brick_ref{ pool.data() + std::size_t(offset) * brick_volume, Word_type() };
+  }
+
+  Brick_ref get_brick(std::size_t b, Brick_cache& cache) const
+  {
+    if(cache.image != this)
+    {
+      cache.clear();
+      cache.image = this;
+    }
+
+    const std::size_t slot = b % Brick_cache::cache_size;
+    if(cache.bricks[slot] != b)
+    {
+      cache.bricks[slot] = b;
+      cache.refs[slot] = get_brick(b);
+    }
+    return cache.refs[slot];
+  }
+
+  template <typename Function>
+  void build(std::size_t xdim, std::size_t ydim, std::size_t zdim,
+             double vx, double vy, double vz,
+             double tx, double ty, double tz,
+             const Function& value)
+  {
+    CGAL_precondition(xdim > 0 && ydim > 0 && zdim > 0);
+
+    dim = { xdim, ydim, zdim };
+    voxel_size = { vx, vy, vz };
+    origin = { tx, ty, tz };
+    for(int d=0; d<3; ++d)
+      nb_bricks[d] = (dim[d] + brick_size - 1) / brick_size;
+
+    const std::size_t n = nb_bricks[0] * nb_bricks[1] * nb_bricks[2];
+    offsets.assign(n, uniform_brick);
+    uniform_values.assign(n, Word_type());
+
+    std::vector<Word_type> brick(brick_volume);
+    std::size_t b = 0;
+    for(std::size_t bk=0; bk<nb_bricks[2]; ++bk)
+      for(std::size_t bj=0; bj<nb_bricks[1]; ++bj)
+        for(std::size_t bi=0; bi<nb_bricks[0]; ++bi, ++b)
+        {
+          // the voxels of the bricks on the border that are outside the image
+          // take the value of the first voxel, so that they do not prevent the elision
+          const Word_type first = value(bi * brick_size, bj * brick_size, bk * brick_size);
+          bool is_uniform = true;
+          for(std::size_t k=0; k<brick_size; ++k)
+            for(std::size_t j=0; j<brick_size; ++j)
+              for(std::size_t i=0; i<brick_size; ++i)
+              {
+                const std::size_t gi = bi * brick_size + i,
+                                  gj = bj * brick_size + j,
+                                  gk = bk * brick_size + k;
+                Word_type w = first;
+                if(gi < xdim && gj < ydim && gk < zdim)
+                  w = value(gi, gj, gk);
+                brick[voxel_index(i, j, k)] = w;
+                is_uniform = is_uniform && (w == first);
+              }
+
+          if(is_uniform)
+          {
+            uniform_values[b] = first;
+          }
+          else
+          {
+            CGAL_assertion(pool.size() / brick_volume < uniform_brick);
+            offsets[b] = static_cast<std::uint32_t>(pool.size() / brick_volume);
+            pool.insert(pool.end(), brick.begin(), brick.end());
+          }
+        }
+
+    pool.shrink_to_fit();
+  }
+
+private:
+  std::array<std::size_t, 3> dim = {{ 0, 0, 0 }};
+  std::array<std::size_t, 3> nb_bricks = {{ 0, 0, 0 }};
+  std::array<double, 3> voxel_size = {{ 1, 1, 1 }};
+  std::array<double, 3> origin = {{ 0, 0, 0 }};
+
+  // for each brick, the index of its voxels in `pool`, or `uniform_brick`
+  std::vector<std::uint32_t> offsets;
+  // for each brick, its value if it is uniform
+  std::vector<Word_type> uniform_values;
+  // the voxels of the bricks that are not uniform
+  std::vector<Word_type> pool;
+};
+
+} // end namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_SPARSE_IMAGE_3_H
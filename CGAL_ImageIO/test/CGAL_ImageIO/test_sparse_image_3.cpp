@@ -0,0 +1,94 @@
+#include <CGAL/config.h>
+#include <CGAL/Image_3.h>
+#include <CGAL/Sparse_image_3.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+
+// Checks that a `Sparse_image_3` gives the same values as the `Image_3` it is built from.
+
+typedef unsigned char Word;
+
+// two balls of labels 1 and 2, and a slab of label 3, in a background of label 0
+Word label(std::size_t i, std::size_t j, std::size_t k)
+{
+  const double x = double(i), y = double(j), z = double(k);
+  if((x-20)*(x-20) + (y-15)*(y-15) + (z-12)*(z-12) < 64)
+    return 1;
+  if((x-30)*(x-30) + (y-20)*(y-20) + (z-12)*(z-12) < 36)
+    return 2;
+  if(k == 3 && i > 5 && j > 7)
+    return 3;
+  return 0;
+}
+
+template <std::size_t brick_size>
+void test(const CGAL::Image_3& image)
+{
+  typedef CGAL::Sparse_image_3<Word, brick_size> Sparse_image;
+  typedef typename Sparse_image::Brick_cache Brick_cache;
+
+  Sparse_image sparse(image);
+  assert(sparse.xdim() == image.xdim() && sparse.ydim() == image.ydim() && sparse.zdim() == image.zdim());
+  assert(sparse.vx() == image.vx() && sparse.vy() == image.vy() && sparse.vz() == image.vz());
+
+  std::cout << "brick size " << brick_size << ": "
+            << sparse.number_of_stored_bricks() << " stored bricks out of "
+            << sparse.number_of_bricks() << ", "
+            << sparse.memory_size() << " bytes instead of " << image.size() << std::endl;
+  assert(sparse.number_of_stored_bricks() < sparse.number_of_bricks());
+  assert(sparse.memory_size() < image.size());
+
+  // the same image, built without a dense buffer
+  Sparse_image direct(image.xdim(), image.ydim(), image.zdim(),
+                      image.vx(), image.vy(), image.vz(), label);
+  assert(direct.number_of_stored_bricks() == sparse.number_of_stored_bricks());
+
+  Brick_cache cache;
+  for(std::size_t k=0; k<image.zdim(); ++k)
+    for(std::size_t j=0; j<image.ydim(); ++j)
+      for(std::size_t i=0; i<image.xdim(); ++i)
+      {
+        assert(sparse.value(i, j, k) == label(i, j, k));
+        assert(sparse.value(i, j, k, cache) == label(i, j, k));
+        assert(direct.value(i, j, k, cache) == label(i, j, k));
+      }
+
+  // interpolations, including outside of the image
+  CGAL::Random rng(0);
+  for(int n=0; n<100000; ++n)
+  {
+    const double x = rng.get_double(-1, (image.xdim() + 1) * image.vx());
+    const double y = rng.get_double(-1, (image.ydim() + 1) * image.vy());
+    const double z = rng.get_double(-1, (image.zdim() + 1) * image.vz());
+
+    const double value = image.trilinear_interpolation<Word, double, double>(x, y, z, 255.);
+    assert(sparse.template trilinear_interpolation<double>(x, y, z, 255.) == value);
+    assert(sparse.template trilinear_interpolation<double>(x, y, z, 255., cache) == value);
+
+    const int l = image.labellized_trilinear_interpolation<Word>(x, y, z, 255);
+    assert(sparse.labellized_trilinear_interpolation(x, y, z, 255) == l);
+    assert(sparse.labellized_trilinear_interpolation(x, y, z, 255, cache) == l);
+  }
+}
+
+int main()
+{
+  CGAL::Image_3 image(_createImage(45, 37, 29, 1,
+                                   0.5, 0.75, 1.,
+                                   1, WK_FIXED, SGN_UNSIGNED));
+  Word* data = static_cast<Word*>(image.data());
+  for(std::size_t k=0; k<image.zdim(); ++k)
+    for(std::size_t j=0; j<image.ydim(); ++j)
+      for(std::size_t i=0; i<image.xdim(); ++i)
+        data[(k * image.ydim() + j) * image.xdim() + i] = label(i, j, k);
+
+  test<8>(image);
+  test<4>(image);
+  test<2>(image);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+// Compares the number of predicates evaluated per second by the predicates of Epick
+// called on each tuple of points, and by the batched predicates.
+// Compile with -mavx2 or -mavx512f to use the SIMD versions of the static filters.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Batched_predicates_3.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/Random.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+struct Points
+{
+  std::vector<double> x, y, z;
+  CGAL::Coordinate_arrays_3 arrays() const { return { x.data(), y.data(), z.data() }; }
+};
+
+void report(const char* name, std::size_t n, double time, std::size_t checksum)
+{
+  std::cout << name << ": " << n / time / 1e6 << " M predicates/s"
+            << " (checksum " << checksum << ")" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  const int repeat = 20;
+
+  CGAL::Random rng(0);
+  Points pts[5];
+  std::vector<Point_3> points[5];
+  for(int a=0; a<5; ++a)
+    for(std::size_t i=0; i<n; ++i)
+    {
+      const Point_3 p(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+      points[a].push_back(p);
+      pts[a].x.push_back(p.x());
+      pts[a].y.push_back(p.y());
+      pts[a].z.push_back(p.z());
+    }
+
+  std::vector<CGAL::Sign> result(n);
+  CGAL::Real_timer timer;
+  std::size_t checksum = 0;
+
+  // Orientation_3
+  K::Orientation_3 orientation = K().orientation_3_object();
+  timer.start();
+  for(int j=0; j<repeat; ++j)
+    for(std::size_t i=0; i<n; ++i)
+      result[i] = orientation(points[0][i], points[1][i], points[2][i], points[3][i]);
+  timer.stop();
+  for(std::size_t i=0; i<n; ++i) checksum += result[i] + 1;
+  report("Orientation_3", repeat * n, timer.time(), checksum);
+
+  CGAL::Batched_orientation_3<K> batched_orientation;
+  timer.reset(); timer.start(); checksum = 0;
+  for(int j=0; j<repeat; ++j)
+    batched_orientation(n, pts[0].arrays(), pts[1].arrays(), pts[2].arrays(), pts[3].arrays(),
+                        result.data());
+  timer.stop();
+  for(std::size_t i=0; i<n; ++i) checksum += result[i] + 1;
+  report("Batched_orientation_3", repeat * n, timer.time(), checksum);
+
+  // Side_of_oriented_sphere_3
+  K::Side_of_oriented_sphere_3 side_of_oriented_sphere = K().side_of_oriented_sphere_3_object();
+  timer.reset(); timer.start(); checksum = 0;
+  for(int j=0; j<repeat; ++j)
+    for(std::size_t i=0; i<n; ++i)
+      result[i] = side_of_oriented_sphere(points[0][i], points[1][i], points[2][i],
+                                          points[3][i], points[4][i]);
+  timer.stop();
+  for(std::size_t i=0; i<n; ++i) checksum += result[i] + 1;
+  report("Side_of_oriented_sphere_3", repeat * n, timer.time(), checksum);
+
+  CGAL::Batched_side_of_oriented_sphere_3<K> batched_side_of_oriented_sphere;
+  timer.reset(); timer.start(); checksum = 0;
+  for(int j=0; j<repeat; ++j)
+    batched_side_of_oriented_sphere(n, pts[0].arrays(), pts[1].arrays(), pts[2].arrays(),
+                                    pts[3].arrays(), pts[4].arrays(), result.data());
+  timer.stop();
+  for(std::size_t i=0; i<n; ++i) checksum += result[i] + 1;
+  report("Batched_side_of_oriented_sphere_3", repeat * n, timer.time(), checksum);
+
+  // Compare_distance_3
+  K::Compare_distance_3 compare_distance = K().compare_distance_3_object();
+  timer.reset(); timer.start(); checksum = 0;
+  for(int j=0; j<repeat; ++j)
+    for(std::size_t i=0; i<n; ++i)
+      result[i] = compare_distance(points[0][i], points[1][i], points[2][i]);
+  timer.stop();
+  for(std::size_t i=0; i<n; ++i) checksum += result[i] + 1;
+  report("Compare_distance_3", repeat * n, timer.time(), checksum);
+
+  CGAL::Batched_compare_distance_3<K> batched_compare_distance;
+  timer.reset(); timer.start(); checksum = 0;
+  for(int j=0; j<repeat; ++j)
+    batched_compare_distance(n, pts[0].arrays(), pts[1].arrays(), pts[2].arrays(), result.data());
+  timer.stop();
+  for(std::size_t i=0; i<n; ++i) checksum += result[i] + 1;
+  report("Batched_compare_distance_3", repeat * n, timer.time(), checksum);
+
+  return EXIT_SUCCESS;
+}
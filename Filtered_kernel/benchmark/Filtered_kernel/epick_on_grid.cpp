@@ -0,0 +1,100 @@
+// Compares Epick and Epick_on_grid on degenerate inputs on the grid of Epick_on_grid<>:
+// - coplanar and cospherical tuples of points with large coordinates, on which the
+//   interval filter fails, and which are decided with the exact number type by Epick
+//   and with integers by Epick_on_grid,
+// - a Delaunay triangulation of points on a small lattice, on which the static filters
+//   often fail, but not the interval filter.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel_on_grid.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/Random.h>
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef std::array<double, 3> Coordinates;
+
+template <typename K>
+void bench(const std::string& name,
+           const std::vector<Coordinates>& degenerate,
+           const std::vector<Coordinates>& lattice)
+{
+  typedef typename K::Point_3 Point_3;
+  auto to_points = [](const std::vector<Coordinates>& coordinates) {
+    std::vector<Point_3> points;
+    for(const Coordinates& c : coordinates)
+      points.emplace_back(c[0], c[1], c[2]);
+    return points;
+  };
+
+  // the degenerate tuples are stored by groups of 5 points, whose 4 first ones are
+  // coplanar, and whose 5 ones are cospherical
+  const std::vector<Point_3> points = to_points(degenerate);
+  CGAL::Real_timer timer;
+  std::size_t checksum = 0;
+  const typename K::Orientation_3 orientation = K().orientation_3_object();
+  timer.start();
+  for(std::size_t i=0; i+4<points.size(); i+=5)
+    checksum += orientation(points[i], points[i+1], points[i+2], points[i+3]) + 1;
+  timer.stop();
+  std::cout << name << " Orientation_3: " << timer.time() << " s (checksum " << checksum << ")" << std::endl;
+
+  checksum = 0;
+  const typename K::Side_of_oriented_sphere_3 side_of_oriented_sphere = K().side_of_oriented_sphere_3_object();
+  timer.reset(); timer.start();
+  for(std::size_t i=0; i+4<points.size(); i+=5)
+    checksum += side_of_oriented_sphere(points[i], points[i+1], points[i+2], points[i+3], points[i+4]) + 1;
+  timer.stop();
+  std::cout << name << " Side_of_oriented_sphere_3: " << timer.time() << " s (checksum " << checksum << ")" << std::endl;
+
+  const std::vector<Point_3> lattice_points = to_points(lattice);
+  timer.reset(); timer.start();
+  CGAL::Delaunay_triangulation_3<K> dt(lattice_points.begin(), lattice_points.end());
+  timer.stop();
+  std::cout << name << " Delaunay_triangulation_3: " << timer.time() << " s ("
+            << dt.number_of_vertices() << " vertices)" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const int n = (argc > 1) ? std::atoi(argv[1]) : 100000;
+  const int lattice_size = (argc > 2) ? std::atoi(argv[2]) : 40;
+
+  CGAL::Random rng(0);
+  // a random multiple of 2^-20 of absolute value at most 2^18
+  auto random_coordinate = [&]() {
+    return std::ldexp(double(rng.get_int(-(1 << 30), 1 << 30)) * (1 << 8) + rng.get_int(0, 1 << 8), -20);
+  };
+
+  std::vector<Coordinates> degenerate;
+  for(int i=0; i<n/5; ++i)
+  {
+    const double cx = random_coordinate(), cy = random_coordinate(), cz = random_coordinate();
+    const double r = std::abs(random_coordinate());
+    degenerate.push_back({ cx + r, cy, cz });
+    degenerate.push_back({ cx, cy + r, cz });
+    degenerate.push_back({ cx - r, cy, cz });
+    degenerate.push_back({ cx, cy - r, cz });
+    degenerate.push_back({ cx, cy, cz + r });
+  }
+
+  // points on a lattice of step 2^-10 inside [-2^19, 2^19]^3
+  const double step = std::ldexp(1., -10);
+  const double origin = std::ldexp(1., 19);
+  std::vector<Coordinates> lattice;
+  for(int i=0; i<n; ++i)
+    lattice.push_back({ origin - rng.get_int(0, lattice_size) * step,
+                        origin - rng.get_int(0, lattice_size) * step,
+                        origin - rng.get_int(0, lattice_size) * step });
+
+  bench<CGAL::Epick>("Epick", degenerate, lattice);
+  bench<CGAL::Epick_on_grid<> >("Epick_on_grid", degenerate, lattice);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+// Measures the time taken by Epeck to build and release many small DAGs of constructions,
+// and to evaluate their exact values.
+// The target bench_lazy_arena_heap allocates them on the heap, and bench_lazy_arena
+// in a `Lazy_arena` (CGAL_LAZY_USE_ARENA is defined), one per batch of constructions.
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Lazy_arena.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/Random.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+// returns the number of points on the positive side of a plane through constructed points
+std::size_t batch(const std::vector<Point_3>& points, std::size_t begin, std::size_t end, bool exact)
+{
+  std::size_t res = 0;
+  for(std::size_t i=begin; i+3<end; ++i)
+  {
+    const Point_3 m = CGAL::midpoint(points[i], points[i+1]);
+    const Point_3 c = CGAL::centroid(m, points[i+2], points[i+3]);
+    const K::Plane_3 plane(m, c, points[i+3]);
+    if(exact)
+      c.exact();
+    if(plane.has_on_positive_side(points[i]))
+      ++res;
+  }
+  return res;
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  const std::size_t batch_size = 1000;
+
+  CGAL::Random rng(0);
+  std::vector<Point_3> points;
+  points.reserve(n);
+  for(std::size_t i=0; i<n; ++i)
+    points.emplace_back(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+
+#ifdef CGAL_LAZY_USE_ARENA
+  std::cout << "Lazy_arena" << std::endl;
+#else
+  std::cout << "heap" << std::endl;
+#endif
+
+  for(bool exact : { false, true })
+  {
+    CGAL::Real_timer timer;
+    timer.start();
+    std::size_t res = 0;
+    std::size_t memory = 0;
+    for(std::size_t b=0; b<n; b+=batch_size)
+    {
+      CGAL::Lazy_arena arena;
+      res += batch(points, b, (std::min)(n, b + batch_size), exact);
+      memory = (std::max)(memory, arena.memory_size());
+    }
+    timer.stop();
+    std::cout << (exact ? "  with exact evaluations: " : "  filtered only: ")
+              << timer.time() << " s (" << res << " positive, "
+              << memory << " bytes per arena)" << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
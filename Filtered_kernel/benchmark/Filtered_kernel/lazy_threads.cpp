@@ -0,0 +1,74 @@
+// Measures the scaling of Epeck with the number of threads when the threads share
+// the same input points: each thread copies the points, builds constructions on them,
+// and evaluates predicates, which takes and releases many references to the shared nodes.
+// The target bench_lazy_threads uses the atomic reference counting of `CGAL::Handle`,
+// and bench_lazy_threads_biased the biased one (CGAL_HANDLE_BIASED_REFERENCE_COUNTING
+// is defined), for which the references taken by the thread that creates a node are
+// not counted atomically.
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/Random.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+// returns the number of positive orientations of tetrahedra made of shared and constructed points
+std::size_t work(const std::vector<Point_3>& shared, std::size_t rounds)
+{
+  std::size_t res = 0;
+  for(std::size_t r=0; r<rounds; ++r)
+  {
+    std::vector<Point_3> points(shared); // copies of the handles
+    std::vector<Point_3> midpoints;
+    midpoints.reserve(points.size());
+    for(std::size_t i=0; i+1<points.size(); ++i)
+      midpoints.push_back(CGAL::midpoint(points[i], points[i+1]));
+    for(std::size_t i=0; i+3<midpoints.size(); ++i)
+      if(CGAL::orientation(points[i], midpoints[i+1], points[i+2], midpoints[i+3]) == CGAL::POSITIVE)
+        ++res;
+  }
+  return res;
+}
+
+int main(int argc, char** argv)
+{
+  const std::size_t n = (argc > 1) ? std::atoi(argv[1]) : 10000;
+  const std::size_t rounds = (argc > 2) ? std::atoi(argv[2]) : 100;
+  const unsigned max_threads = (argc > 3) ? std::atoi(argv[3])
+                                          : (std::max)(1u, std::thread::hardware_concurrency());
+
+  CGAL::Random rng(0);
+  std::vector<Point_3> shared;
+  for(std::size_t i=0; i<n; ++i)
+    shared.emplace_back(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+
+#ifdef CGAL_HANDLE_BIASED_REFERENCE_COUNTING
+  std::cout << "biased reference counting" << std::endl;
+#else
+  std::cout << "atomic reference counting" << std::endl;
+#endif
+
+  // the same amount of work per thread: the time is constant if the scaling is perfect
+  for(unsigned t=1; t<=max_threads; t*=2)
+  {
+    CGAL::Real_timer timer;
+    timer.start();
+    std::vector<std::size_t> res(t);
+    std::vector<std::thread> threads;
+    for(unsigned k=0; k<t; ++k)
+      threads.emplace_back([&, k]() { res[k] = work(shared, rounds); });
+    for(std::thread& thread : threads)
+      thread.join();
+    timer.stop();
+    std::cout << "  " << t << " thread(s): " << timer.time() << " s ("
+              << res[0] << " positive)" << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+// Measures the exact stage of the predicates of Epick, on degenerate inputs on which
+// the interval filter fails. Compiled with and without CGAL_EPICK_USE_STACK_MPZF, to
+// compare Stack_mpzf with the default exact ring number type.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/Random.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <typeinfo>
+#include <vector>
+
+typedef CGAL::Epick        K;
+typedef K::Point_2         Point_2;
+typedef K::Point_3         Point_3;
+
+int main(int argc, char** argv)
+{
+  const int n = (argc > 1) ? std::atoi(argv[1]) : 100000;
+
+  std::cout << "exact ring number type: "
+            << typeid(CGAL::Exact_kernel_selector<K>::Exact_rt).name() << std::endl;
+
+  // collinear, coplanar, and cospherical tuples (up to rounding), with random coordinates
+  CGAL::Random rng(0);
+  std::vector<Point_2> p2;
+  std::vector<Point_3> p3;
+  for(int i=0; i<n; ++i)
+  {
+    const double cx = rng.get_double(), cy = rng.get_double(), cz = rng.get_double();
+    const double ux = rng.get_double(), uy = rng.get_double(), uz = rng.get_double();
+    p2.emplace_back(cx, cy);
+    p2.emplace_back(cx + ux, cy + uy);
+    p2.emplace_back(cx + 2 * ux, cy + 2 * uy);
+    p2.emplace_back(cx - ux, cy - uy);
+    p3.emplace_back(cx, cy, cz);
+    p3.emplace_back(cx + ux, cy + uy, cz + uz);
+    p3.emplace_back(cx + 2 * ux, cy + 2 * uy, cz + 2 * uz);
+    p3.emplace_back(cx + ux, cy, cz);
+    p3.emplace_back(cx, cy + ux, cz);
+    p3.emplace_back(cx, cy, cz + ux);
+    p3.emplace_back(cx - ux, cy, cz);
+    p3.emplace_back(cx, cy - ux, cz);
+  }
+
+  CGAL::Real_timer timer;
+  int checksum = 0;
+  timer.start();
+  for(std::size_t i=0; i+3<p2.size(); i+=4)
+    checksum += CGAL::orientation(p2[i], p2[i+1], p2[i+2]) + CGAL::orientation(p2[i+3], p2[i], p2[i+1]);
+  timer.stop();
+  std::cout << "Orientation_2 (collinear): " << timer.time() << " s (checksum " << checksum << ")" << std::endl;
+
+  checksum = 0;
+  timer.reset(); timer.start();
+  for(std::size_t i=0; i+7<p3.size(); i+=8)
+    checksum += CGAL::orientation(p3[i], p3[i+1], p3[i+2], p3[i+3]);
+  timer.stop();
+  std::cout << "Orientation_3 (coplanar): " << timer.time() << " s (checksum " << checksum << ")" << std::endl;
+
+  checksum = 0;
+  timer.reset(); timer.start();
+  for(std::size_t i=0; i+7<p3.size(); i+=8)
+    checksum += CGAL::side_of_oriented_sphere(p3[i+3], p3[i+4], p3[i+5], p3[i+6], p3[i+7]);
+  timer.stop();
+  std::cout << "Side_of_oriented_sphere_3 (cospherical): " << timer.time() << " s (checksum " << checksum << ")" << std::endl;
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,364 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_BATCHED_PREDICATES_3_H
+#define CGAL_BATCHED_PREDICATES_3_H
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/determinant.h>
+#include <CGAL/enum.h>
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#if defined __AVX__ || defined __AVX512F__
+#  include <immintrin.h>
+#endif
+
+namespace CGAL {
+
+// The coordinates of `n` points, stored as a structure of arrays:
+// the i-th point is `(x[i], y[i], z[i])`.
+struct Coordinate_arrays_3
+{
+  const double* x;
+  const double* y;
+  const double* z;
+};
+
+namespace internal {
+namespace Batched_predicates {
+
+// Packs of doubles, evaluated with the same formulas as the scalar static
+// filters (`CGAL::determinant()` is instantiated with them), and whose
+// comparisons return the bit mask of the lanes where they hold.
+
+struct Scalar_pack
+{
+  static constexpr std::size_t size = 1;
+  double v;
+
+  Scalar_pack() {}
+  Scalar_pack(double d) : v(d) {}
+  static Scalar_pack load(const double* p) { return Scalar_pack(*p); }
+
+  friend Scalar_pack operator+(Scalar_pack a, Scalar_pack b) { return a.v + b.v; }
+  friend Scalar_pack operator-(Scalar_pack a, Scalar_pack b) { return a.v - b.v; }
+  friend Scalar_pack operator*(Scalar_pack a, Scalar_pack b) { return a.v * b.v; }
+  friend Scalar_pack operator-(Scalar_pack a) { return -a.v; }
+  friend Scalar_pack abs(Scalar_pack a) { return std::fabs(a.v); }
+  friend Scalar_pack max(Scalar_pack a, Scalar_pack b) { return (a.v < b.v) ? b.v : a.v; }
+  friend Scalar_pack min(Scalar_pack a, Scalar_pack b) { return (b.v < a.v) ? b.v : a.v; }
+  friend unsigned int operator<(Scalar_pack a, Scalar_pack b) { return a.v < b.v; }
+  friend unsigned int operator>(Scalar_pack a, Scalar_pack b) { return a.v > b.v; }
+};
+
+#ifdef __AVX__
+struct Avx_pack
+{
+  static constexpr std::size_t size = 4;
+  __m256d v;
+
+  Avx_pack() {}
+  Avx_pack(__m256d m) : v(m) {}
+  Avx_pack(double d) : v(_mm256_set1_pd(d)) {}
+  static Avx_pack load(const double* p) { return _mm256_loadu_pd(p); }
+
+  friend Avx_pack operator+(Avx_pack a, Avx_pack b) { return _mm256_add_pd(a.v, b.v); }
+  friend Avx_pack operator-(Avx_pack a, Avx_pack b) { return _mm256_sub_pd(a.v, b.v); }
+  friend Avx_pack operator*(Avx_pack a, Avx_pack b) { return _mm256_mul_pd(a.v, b.v); }
+  friend Avx_pack operator-(Avx_pack a) { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.)); }
+  friend Avx_pack abs(Avx_pack a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.), a.v); }
+  friend Avx_pack max(Avx_pack a, Avx_pack b) { return _mm256_max_pd(a.v, b.v); }
+  friend Avx_pack min(Avx_pack a, Avx_pack b) { return _mm256_min_pd(a.v, b.v); }
+  friend unsigned int operator<(Avx_pack a, Avx_pack b)
+  { return _mm256_movemask_pd(_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)); }
+  friend unsigned int operator>(Avx_pack a, Avx_pack b)
+  { return _mm256_movemask_pd(_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)); }
+};
+#endif // __AVX__
+
+#ifdef __AVX512F__
+struct Avx512_pack
+{
+  static constexpr std::size_t size = 8;
+  __m512d v;
+
+  Avx512_pack() {}
+  Avx512_pack(__m512d m) : v(m) {}
+  Avx512_pack(double d) : v(_mm512_set1_pd(d)) {}
+  static Avx512_pack load(const double* p) { return _mm512_loadu_pd(p); }
+
+  friend Avx512_pack operator+(Avx512_pack a, Avx512_pack b) { return _mm512_add_pd(a.v, b.v); }
+  friend Avx512_pack operator-(Avx512_pack a, Avx512_pack b) { return _mm512_sub_pd(a.v, b.v); }
+  friend Avx512_pack operator*(Avx512_pack a, Avx512_pack b) { return _mm512_mul_pd(a.v, b.v); }
+  friend Avx512_pack operator-(Avx512_pack a) { return _mm512_sub_pd(_mm512_setzero_pd(), a.v); }
+  friend Avx512_pack abs(Avx512_pack a) { return _mm512_abs_pd(a.v); }
+  friend Avx512_pack max(Avx512_pack a, Avx512_pack b) { return _mm512_max_pd(a.v, b.v); }
+  friend Avx512_pack min(Avx512_pack a, Avx512_pack b) { return _mm512_min_pd(a.v, b.v); }
+  friend unsigned int operator<(Avx512_pack a, Avx512_pack b)
+  { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ); }
+  friend unsigned int operator>(Avx512_pack a, Avx512_pack b)
+  { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ); }
+};
+typedef Avx512_pack Widest_pack;
+#elif defined __AVX__
+typedef Avx_pack    Widest_pack;
+#else
+typedef Scalar_pack Widest_pack;
+#endif
+
+// The static filters below are the ones of
+// `Filtered_kernel/internal/Static_filters/`, with the same error bounds.
+// `c` holds the coordinates of the points, and the lanes where the sign is
+// certified to be positive (resp. negative) are set in `positive` (resp. `negative`).
+
+struct Orientation_3_filter
+{
+  static constexpr std::size_t arity = 4;
+
+  template <typename P>
+  static void apply(const P* c, unsigned int& positive, unsigned int& negative)
+  {
+    const P pqx = c[3] - c[0], pqy = c[4] - c[1], pqz = c[5] - c[2];
+    const P prx = c[6] - c[0], pry = c[7] - c[1], prz = c[8] - c[2];
+    const P psx = c[9] - c[0], psy = c[10] - c[1], psz = c[11] - c[2];
+
+    const P maxx = max(abs(pqx), max(abs(prx), abs(psx)));
+    const P maxy = max(abs(pqy), max(abs(pry), abs(psy)));
+    const P maxz = max(abs(pqz), max(abs(prz), abs(psz)));
+
+    const P det = CGAL::determinant(pqx, pqy, pqz,
+                                    prx, pry, prz,
+                                    psx, psy, psz);
+    const P eps = P(5.1107127829973299e-15) * maxx * maxy * maxz;
+
+    const P lower = min(maxx, min(maxy, maxz));
+    const P upper = max(maxx, max(maxy, maxz));
+    // underflow and overflow protections
+    const unsigned int safe = (lower > P(1e-97)) & (upper < P(1e102));
+
+    positive = safe & (det > eps);
+    negative = safe & (det < -eps);
+  }
+};
+
+struct Side_of_oriented_sphere_3_filter
+{
+  static constexpr std::size_t arity = 5;
+
+  template <typename P>
+  static void apply(const P* c, unsigned int& positive, unsigned int& negative)
+  {
+    const P ptx = c[0] - c[12], pty = c[1] - c[13], ptz = c[2] - c[14];
+    const P qtx = c[3] - c[12], qty = c[4] - c[13], qtz = c[5] - c[14];
+    const P rtx = c[6] - c[12], rty = c[7] - c[13], rtz = c[8] - c[14];
+    const P stx = c[9] - c[12], sty = c[10] - c[13], stz = c[11] - c[14];
+    const P pt2 = ptx*ptx + pty*pty + ptz*ptz;
+    const P qt2 = qtx*qtx + qty*qty + qtz*qtz;
+    const P rt2 = rtx*rtx + rty*rty + rtz*rtz;
+    const P st2 = stx*stx + sty*sty + stz*stz;
+
+    const P maxx = max(max(abs(ptx), abs(qtx)), max(abs(rtx), abs(stx)));
+    const P maxy = max(max(abs(pty), abs(qty)), max(abs(rty), abs(sty)));
+    const P maxz = max(max(abs(ptz), abs(qtz)), max(abs(rtz), abs(stz)));
+
+    const P det = CGAL::determinant(ptx, pty, ptz, pt2,
+                                    rtx, rty, rtz, rt2,
+                                    qtx, qty, qtz, qt2,
+                                    stx, sty, stz, st2);
+
+    const P lower = min(maxx, min(maxy, maxz));
+    const P upper = max(maxx, max(maxy, maxz));
+    const P eps = P(1.2466136531027298e-13) * maxx * maxy * maxz * (upper * upper);
+    const unsigned int safe = (lower > P(1e-58)) & (upper < P(1e61));
+
+    positive = safe & (det > eps);
+    negative = safe & (det < -eps);
+  }
+};
+
+struct Compare_distance_3_filter
+{
+  static constexpr std::size_t arity = 3;
+
+  template <typename P>
+  static void apply(const P* c, unsigned int& positive, unsigned int& negative)
+  {
+    const P qpx = c[3] - c[0], qpy = c[4] - c[1], qpz = c[5] - c[2];
+    const P rpx = c[6] - c[0], rpy = c[7] - c[1], rpz = c[8] - c[2];
+    const P qp2 = (qpx*qpx + qpy*qpy) + qpz*qpz;
+    const P rp2 = (rpx*rpx + rpy*rpy) + rpz*rpz;
+    const P diff = qp2 - rp2;
+
+    const P max1 = max(max(max(abs(qpx), abs(qpy)), max(abs(qpz), abs(rpx))),
+                       max(abs(rpy), abs(rpz)));
+    const P eps = P(3.77746921267322435884e-15) * (max1 * max1);
+    const unsigned int safe = (max1 > P(2.42701102401884262260e-147))
+                            & (max1 < P(8.37987995621411946582e+152));
+
+    positive = safe & (diff > eps);
+    negative = safe & (diff < -eps);
+  }
+};
+
+// Applies `Filter` to the points of indices in `[begin, end)` by packs of
+// `Pack::size` points, and returns the first index that was not handled.
+// The indices whose sign is not certified are appended to `undecided`.
+template <typename Filter, typename Pack>
+std::size_t apply_static_filter(std::size_t begin, std::size_t end,
+                                const Coordinate_arrays_3* points,
+                                Sign* result,
+                                std::vector<std::size_t>& undecided)
+{
+  std::size_t i = begin;
+  for(; i + Pack::size <= end; i += Pack::size)
+  {
+    Pack c[3 * Filter::arity];
+    for(std::size_t a=0; a<Filter::arity; ++a)
+    {
+      c[3*a]     = Pack::load(points[a].x + i);
+      c[3*a + 1] = Pack::load(points[a].y + i);
+      c[3*a + 2] = Pack::load(points[a].z + i);
+    }
+
+    unsigned int positive, negative;
+    Filter::apply(c, positive, negative);
+
+    for(std::size_t l=0; l<Pack::size; ++l)
+    {
+      if((positive >> l) & 1u)
+        result[i + l] = POSITIVE;
+      else if((negative >> l) & 1u)
+        result[i + l] = NEGATIVE;
+      else
+        undecided.push_back(i + l);
+    }
+  }
+  return i;
+}
+
+template <typename Filter>
+std::vector<std::size_t> apply_static_filter(std::size_t n,
+                                             const Coordinate_arrays_3* points,
+                                             Sign* result)
+{
+  std::vector<std::size_t> undecided;
+  std::size_t i = apply_static_filter<Filter, Widest_pack>(0, n, points, result, undecided);
+  apply_static_filter<Filter, Scalar_pack>(i, n, points, result, undecided);
+  return undecided;
+}
+
+template <typename K>
+typename K::Point_3 point(const Coordinate_arrays_3& points, std::size_t i)
+{
+  return typename K::Point_3(points.x[i], points.y[i], points.z[i]);
+}
+
+} // namespace Batched_predicates
+} // namespace internal
+
+// The batched versions of the predicates of a kernel with `double` coordinates,
+// such as `Epick`. The semi-static filters are evaluated on several tuples of
+// points at once with AVX or AVX-512 when the code is compiled with them, and
+// the tuples for which they fail are then evaluated one by one by the predicate
+// of the kernel, that is with the interval and exact filters.
+// The function operators return the number of tuples that needed this fallback.
+
+template <typename K = Epick>
+class Batched_orientation_3
+{
+  static_assert(std::is_same<typename K::FT, double>::value,
+                "the coordinates must be doubles");
+
+public:
+  typedef typename K::Orientation_3::result_type result_type;
+
+  std::size_t operator()(std::size_t n,
+                         const Coordinate_arrays_3& p, const Coordinate_arrays_3& q,
+                         const Coordinate_arrays_3& r, const Coordinate_arrays_3& s,
+                         result_type* result) const
+  {
+    namespace BP = internal::Batched_predicates;
+    const Coordinate_arrays_3 points[] = { p, q, r, s };
+    const std::vector<std::size_t> undecided =
+      BP::apply_static_filter<BP::Orientation_3_filter>(n, points, result);
+
+    const typename K::Orientation_3 orientation = K().orientation_3_object();
+    for(std::size_t i : undecided)
+      result[i] = orientation(BP::point<K>(p, i), BP::point<K>(q, i),
+                              BP::point<K>(r, i), BP::point<K>(s, i));
+    return undecided.size();
+  }
+};
+
+template <typename K = Epick>
+class Batched_side_of_oriented_sphere_3
+{
+  static_assert(std::is_same<typename K::FT, double>::value,
+                "the coordinates must be doubles");
+
+public:
+  typedef typename K::Side_of_oriented_sphere_3::result_type result_type;
+
+  std::size_t operator()(std::size_t n,
+                         const Coordinate_arrays_3& p, const Coordinate_arrays_3& q,
+                         const Coordinate_arrays_3& r, const Coordinate_arrays_3& s,
+                         const Coordinate_arrays_3& t,
+                         result_type* result) const
+  {
+    namespace BP = internal::Batched_predicates;
+    const Coordinate_arrays_3 points[] = { p, q, r, s, t };
+    const std::vector<std::size_t> undecided =
+      BP::apply_static_filter<BP::Side_of_oriented_sphere_3_filter>(n, points, result);
+
+    const typename K::Side_of_oriented_sphere_3 side_of_oriented_sphere =
+      K().side_of_oriented_sphere_3_object();
+    for(std::size_t i : undecided)
+      result[i] = side_of_oriented_sphere(BP::point<K>(p, i), BP::point<K>(q, i),
+                                          BP::point<K>(r, i), BP::point<K>(s, i),
+                                          BP::point<K>(t, i));
+    return undecided.size();
+  }
+};
+
+template <typename K = Epick>
+class Batched_compare_distance_3
+{
+  static_assert(std::is_same<typename K::FT, double>::value,
+                "the coordinates must be doubles");
+
+public:
+  typedef typename K::Compare_distance_3::result_type result_type;
+
+  std::size_t operator()(std::size_t n,
+                         const Coordinate_arrays_3& p, const Coordinate_arrays_3& q,
+                         const Coordinate_arrays_3& r,
+                         result_type* result) const
+  {
+    namespace BP = internal::Batched_predicates;
+    const Coordinate_arrays_3 points[] = { p, q, r };
+    const std::vector<std::size_t> undecided =
+      BP::apply_static_filter<BP::Compare_distance_3_filter>(n, points, result);
+
+    const typename K::Compare_distance_3 compare_distance = K().compare_distance_3_object();
+    for(std::size_t i : undecided)
+      result[i] = compare_distance(BP::point<K>(p, i), BP::point<K>(q, i), BP::point<K>(r, i));
+    return undecided.size();
+  }
+};
+
+} // namespace CGAL
+
+#endif // CGAL_BATCHED_PREDICATES_3_H
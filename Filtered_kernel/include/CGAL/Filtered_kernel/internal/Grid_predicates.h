@@ -0,0 +1,303 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_INTERNAL_GRID_PREDICATES_H
+#define CGAL_INTERNAL_GRID_PREDICATES_H
+
+#include <CGAL/config.h>
+#include <CGAL/determinant.h>
+#include <CGAL/enum.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Profile_counter.h>
+#include <CGAL/Uncertain.h>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <cmath>
+#include <initializer_list>
+
+// Exact predicates for points whose coordinates are multiples of 2^-G of absolute
+// value at most 2^B. Such a coordinate, multiplied by 2^G, is an integer of at most
+// b = G + B bits, and the determinants of the predicates are computed exactly with
+// integers whose number of bits is bounded from b:
+//
+//   Orientation_2             : |det| < 2^(2b+3)
+//   Orientation_3             : |det| < 2^(3b+6)
+//   Side_of_oriented_circle_2 : |det| < 2^(4b+8)
+//   Side_of_oriented_sphere_3 : |det| < 2^(5b+14)
+//
+// and so are all the intermediate values (minors and partial sums).
+//
+// The integer evaluation replaces the exact number type only: the interval filter
+// is tried first, as it is cheaper and succeeds on most inputs on which the static
+// filters fail.
+//
+// When `CGAL_GRID_PREDICATES_VERIFY` is defined, each result computed with integers
+// is compared with the one of the usual filtered predicate.
+
+namespace CGAL { namespace internal { namespace Grid_predicates {
+
+// A signed integer type whose values can have `Bits` bits
+template <int Bits,
+          bool fits_in_64 = (Bits <= 63),
+#ifdef BOOST_HAS_INT128
+          bool fits_in_128 = (Bits <= 127)
+#else
+          bool fits_in_128 = false
+#endif
+          >
+struct Integer
+{
+  static constexpr unsigned size = ((Bits + 63) / 64) * 64;
+  typedef boost::multiprecision::number<
+            boost::multiprecision::cpp_int_backend<size, size,
+                                                   boost::multiprecision::signed_magnitude,
+                                                   boost::multiprecision::unchecked, void>,
+            boost::multiprecision::et_off> type;
+};
+
+template <int Bits, bool b>
+struct Integer<Bits, true, b>
+{
+  typedef long long type;
+};
+
+#ifdef BOOST_HAS_INT128
+template <int Bits>
+struct Integer<Bits, false, true>
+{
+  typedef boost::int128_type type;
+};
+#endif
+
+template <typename I>
+Sign sign_of(const I& i)
+{
+  return (i > 0) ? POSITIVE : ((i < 0) ? NEGATIVE : ZERO);
+}
+
+template <int G, int B>
+struct Grid
+{
+  static_assert(G >= 0 && B >= 0 && G + B <= 61, "the coordinates on the grid must fit in 61 bits");
+
+  static constexpr int bits = G + B;
+
+  // converts the coordinates to integers, or returns false if one of them is not on the grid
+  static bool to_integers(std::initializer_list<double> coordinates, long long* res)
+  {
+    const double scale = std::ldexp(1., G);
+    const double bound = std::ldexp(1., bits);
+    for(double c : coordinates)
+    {
+      const double s = c * scale; // exact, unless c is not on the grid
+      if(!(std::abs(s) <= bound) || s != std::trunc(s))
+        return false;
+      *res++ = static_cast<long long>(s);
+    }
+    return true;
+  }
+};
+
+// the interval filter of `Filtered_predicate`: returns true and sets `res` if
+// the approximate predicate `AP` is certain
+template <typename K_base, typename AP, typename Result, typename... Args>
+bool interval_filter(Result& res, const Args&... args)
+{
+  typename K_base::C2F c2f;
+  Protect_FPU_rounding<true> p;
+  try
+  {
+    const auto r = AP()(c2f(args)...);
+    if(is_certain(r))
+    {
+      res = get_certain(r);
+      return true;
+    }
+  }
+  catch (Uncertain_conversion_exception&) {}
+  return false;
+}
+
+#ifdef CGAL_GRID_PREDICATES_VERIFY
+template <typename Result>
+void verify(Result res, Result filtered_res)
+{
+  if(res != filtered_res)
+    CGAL_error_msg("the predicate computed on the grid differs from the filtered predicate");
+}
+#endif
+
+template <typename K_base, int G, int B>
+class Orientation_2
+  : public K_base::Orientation_2
+{
+  typedef typename K_base::Point_2       Point_2;
+  typedef typename K_base::Orientation_2 Base;
+  typedef typename Integer<2 * (G + B) + 3>::type I;
+
+public:
+  typedef typename Base::result_type result_type;
+
+  using Base::operator();
+
+  result_type operator()(const Point_2& p, const Point_2& q, const Point_2& r) const
+  {
+    result_type res;
+    if(interval_filter<K_base, typename K_base::Approximate_kernel::Orientation_2>(res, p, q, r))
+      return res;
+
+    CGAL_BRANCH_PROFILER("grid computations/calls to   : Orientation_2", tmp);
+    long long c[6];
+    if(!Grid<G, B>::to_integers({ p.x(), p.y(), q.x(), q.y(), r.x(), r.y() }, c))
+      return Base::operator()(p, q, r);
+    CGAL_BRANCH_PROFILER_BRANCH(tmp);
+
+    const I px = c[0], py = c[1];
+    res = sign_of(CGAL::determinant<I>(c[2] - px, c[3] - py,
+                                       c[4] - px, c[5] - py));
+#ifdef CGAL_GRID_PREDICATES_VERIFY
+    verify(res, Base::operator()(p, q, r));
+#endif
+    return res;
+  }
+};
+
+template <typename K_base, int G, int B>
+class Orientation_3
+  : public K_base::Orientation_3
+{
+  typedef typename K_base::Point_3       Point_3;
+  typedef typename K_base::Orientation_3 Base;
+  typedef typename Integer<3 * (G + B) + 6>::type I;
+
+public:
+  typedef typename Base::result_type result_type;
+
+  using Base::operator();
+
+  result_type operator()(const Point_3& p, const Point_3& q,
+                         const Point_3& r, const Point_3& s) const
+  {
+    result_type res;
+    if(interval_filter<K_base, typename K_base::Approximate_kernel::Orientation_3>(res, p, q, r, s))
+      return res;
+
+    CGAL_BRANCH_PROFILER("grid computations/calls to   : Orientation_3", tmp);
+    long long c[12];
+    if(!Grid<G, B>::to_integers({ p.x(), p.y(), p.z(), q.x(), q.y(), q.z(),
+                                  r.x(), r.y(), r.z(), s.x(), s.y(), s.z() }, c))
+      return Base::operator()(p, q, r, s);
+    CGAL_BRANCH_PROFILER_BRANCH(tmp);
+
+    const I px = c[0], py = c[1], pz = c[2];
+    res = sign_of(CGAL::determinant<I>(c[3] - px, c[6] - px, c[9] - px,
+                                       c[4] - py, c[7] - py, c[10] - py,
+                                       c[5] - pz, c[8] - pz, c[11] - pz));
+#ifdef CGAL_GRID_PREDICATES_VERIFY
+    verify(res, Base::operator()(p, q, r, s));
+#endif
+    return res;
+  }
+};
+
+template <typename K_base, int G, int B>
+class Side_of_oriented_circle_2
+  : public K_base::Side_of_oriented_circle_2
+{
+  typedef typename K_base::Point_2                   Point_2;
+  typedef typename K_base::Side_of_oriented_circle_2 Base;
+  typedef typename Integer<4 * (G + B) + 8>::type    I;
+
+public:
+  typedef typename Base::result_type result_type;
+
+  using Base::operator();
+
+  result_type operator()(const Point_2& p, const Point_2& q,
+                         const Point_2& r, const Point_2& t) const
+  {
+    result_type res;
+    if(interval_filter<K_base, typename K_base::Approximate_kernel::Side_of_oriented_circle_2>(res, p, q, r, t))
+      return res;
+
+    CGAL_BRANCH_PROFILER("grid computations/calls to   : Side_of_oriented_circle_2", tmp);
+    long long c[8];
+    if(!Grid<G, B>::to_integers({ p.x(), p.y(), q.x(), q.y(), r.x(), r.y(), t.x(), t.y() }, c))
+      return Base::operator()(p, q, r, t);
+    CGAL_BRANCH_PROFILER_BRANCH(tmp);
+
+    // same formula as side_of_oriented_circleC2()
+    const I px = c[0], py = c[1], qx = c[2], qy = c[3], rx = c[4], ry = c[5], tx = c[6], ty = c[7];
+    const I qpx = qx - px, qpy = qy - py;
+    const I rpx = rx - px, rpy = ry - py;
+    const I tpx = tx - px, tpy = ty - py;
+    res = sign_of(CGAL::determinant<I>(qpx*tpy - qpy*tpx, tpx*(tx-qx) + tpy*(ty-qy),
+                                       qpx*rpy - qpy*rpx, rpx*(rx-qx) + rpy*(ry-qy)));
+#ifdef CGAL_GRID_PREDICATES_VERIFY
+    verify(res, Base::operator()(p, q, r, t));
+#endif
+    return res;
+  }
+};
+
+template <typename K_base, int G, int B>
+class Side_of_oriented_sphere_3
+  : public K_base::Side_of_oriented_sphere_3
+{
+  typedef typename K_base::Point_3                   Point_3;
+  typedef typename K_base::Side_of_oriented_sphere_3 Base;
+  typedef typename Integer<5 * (G + B) + 14>::type   I;
+
+public:
+  typedef typename Base::result_type result_type;
+
+  using Base::operator();
+
+  result_type operator()(const Point_3& p, const Point_3& q, const Point_3& r,
+                         const Point_3& s, const Point_3& t) const
+  {
+    result_type res;
+    if(interval_filter<K_base, typename K_base::Approximate_kernel::Side_of_oriented_sphere_3>(res, p, q, r, s, t))
+      return res;
+
+    CGAL_BRANCH_PROFILER("grid computations/calls to   : Side_of_oriented_sphere_3", tmp);
+    long long c[15];
+    if(!Grid<G, B>::to_integers({ p.x(), p.y(), p.z(), q.x(), q.y(), q.z(), r.x(), r.y(), r.z(),
+                                  s.x(), s.y(), s.z(), t.x(), t.y(), t.z() }, c))
+      return Base::operator()(p, q, r, s, t);
+    CGAL_BRANCH_PROFILER_BRANCH(tmp);
+
+    // same formula as side_of_oriented_sphereC3()
+    const I tx = c[12], ty = c[13], tz = c[14];
+    const I ptx = c[0] - tx, pty = c[1] - ty, ptz = c[2] - tz;
+    const I qtx = c[3] - tx, qty = c[4] - ty, qtz = c[5] - tz;
+    const I rtx = c[6] - tx, rty = c[7] - ty, rtz = c[8] - tz;
+    const I stx = c[9] - tx, sty = c[10] - ty, stz = c[11] - tz;
+    const I pt2 = ptx*ptx + pty*pty + ptz*ptz;
+    const I qt2 = qtx*qtx + qty*qty + qtz*qtz;
+    const I rt2 = rtx*rtx + rty*rty + rtz*rtz;
+    const I st2 = stx*stx + sty*sty + stz*stz;
+    res = sign_of(CGAL::determinant<I>(ptx, pty, ptz, pt2,
+                                       rtx, rty, rtz, rt2,
+                                       qtx, qty, qtz, qt2,
+                                       stx, sty, stz, st2));
+#ifdef CGAL_GRID_PREDICATES_VERIFY
+    verify(res, Base::operator()(p, q, r, s, t));
+#endif
+    return res;
+  }
+};
+
+} } } // namespace CGAL::internal::Grid_predicates
+
+#endif // CGAL_INTERNAL_GRID_PREDICATES_H
@@ -22,6 +22,7 @@
 // If it should be provided again, it should probably be separate.
 
 #include <CGAL/config.h>
+#include <CGAL/Filtered_kernel_statistics.h>
 
 #include <CGAL/Kernel/function_objects.h>
 #include <CGAL/Cartesian/function_objects.h>
@@ -91,6 +92,28 @@
 
 namespace CGAL { namespace internal {
 
+#ifdef CGAL_FILTERED_KERNEL_STATISTICS
+// counts the calls of a predicate with a static filter (see Filtered_kernel_statistics.h)
+template < typename P >
+struct Static_filter_with_statistics
+  : public P
+{
+  typedef typename P::result_type result_type;
+
+  template < typename... A >
+  decltype(auto)
+  operator()(const A&... a) const
+  {
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(PREDICATE, P, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, STATIC_FILTER_CALLS);
+    return P::operator()(a...);
+  }
+};
+#  define CGAL_STATIC_FILTER_WITH_STATISTICS(...) Static_filter_with_statistics<__VA_ARGS__>
+#else
+#  define CGAL_STATIC_FILTER_WITH_STATISTICS(...) __VA_ARGS__
+#endif
+
 // The K_base argument is supposed to provide exact primitives.
 template < typename K_base >
 class Static_filters : public K_base
@@ -99,36 +122,36 @@ class Static_filters : public K_base
 
 public:
 #ifndef CGAL_NO_EQUAL_3_STATIC_FILTERS
-  typedef Static_filters_predicates::Equal_2<K_base>                        Equal_2;
-  typedef Static_filters_predicates::Equal_3<K_base>                        Equal_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Equal_2<K_base>) Equal_2;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Equal_3<K_base>) Equal_3;
 #endif // NOT CGAL_NO_EQUAL_3_STATIC_FILTERS
 
 #ifndef CGAL_NO_COMPARE_X_2_STATIC_FILTERS
-  typedef Static_filters_predicates::Compare_x_2<K_base>                    Compare_x_2;
-  typedef Static_filters_predicates::Compare_y_2<K_base>                    Compare_y_2;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Compare_x_2<K_base>) Compare_x_2;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Compare_y_2<K_base>) Compare_y_2;
 #endif // NOT CGAL_NO_COMPARE_X_2_STATIC_FILTERS
 
 #ifndef CGAL_NO_IS_DEGENERATE_3_STATIC_FILTERS
-  typedef Static_filters_predicates::Is_degenerate_3<K_base, Self>          Is_degenerate_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Is_degenerate_3<K_base, Self>) Is_degenerate_3;
 #endif // NOT CGAL_NO_IS_DEGENERATE_3_STATIC_FILTERS
-  typedef Static_filters_predicates::Orientation_2<K_base>                  Orientation_2;
-  typedef Static_filters_predicates::Orientation_3<K_base>                  Orientation_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Orientation_2<K_base>) Orientation_2;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Orientation_3<K_base>) Orientation_3;
 #ifndef CGAL_NO_ANGLE_3_STATIC_FILTERS
 
-  typedef Static_filters_predicates::Collinear_3<K_base>                    Collinear_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Collinear_3<K_base>) Collinear_3;
 
-  typedef Static_filters_predicates::Angle_3<K_base>                        Angle_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Angle_3<K_base>) Angle_3;
 #endif // NOT CGAL_NO_ANGLE_3_STATIC_FILTERS
-  typedef Static_filters_predicates::Side_of_oriented_circle_2<K_base>      Side_of_oriented_circle_2;
-  typedef Static_filters_predicates::Side_of_oriented_sphere_3<K_base>      Side_of_oriented_sphere_3;
-  typedef Static_filters_predicates::Compare_squared_radius_3<K_base>       Compare_squared_radius_3;
-  typedef Static_filters_predicates::Coplanar_3<K_base,Self>                Coplanar_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Side_of_oriented_circle_2<K_base>) Side_of_oriented_circle_2;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Side_of_oriented_sphere_3<K_base>) Side_of_oriented_sphere_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Compare_squared_radius_3<K_base>) Compare_squared_radius_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Coplanar_3<K_base,Self>) Coplanar_3;
 
-  typedef Static_filters_predicates::Compare_weighted_squared_radius_3<K_base>     Compare_weighted_squared_radius_3;
-  typedef Static_filters_predicates::Power_side_of_oriented_power_circle_2<K_base>                          Power_side_of_oriented_power_circle_2;
-  typedef Static_filters_predicates::Power_side_of_oriented_power_sphere_3<K_base>                          Power_side_of_oriented_power_sphere_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Compare_weighted_squared_radius_3<K_base>) Compare_weighted_squared_radius_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Power_side_of_oriented_power_circle_2<K_base>) Power_side_of_oriented_power_circle_2;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Power_side_of_oriented_power_sphere_3<K_base>) Power_side_of_oriented_power_sphere_3;
 
-  typedef Static_filters_predicates::Compare_distance_3<K_base>             Compare_distance_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Compare_distance_3<K_base>) Compare_distance_3;
 
   Orientation_2
   orientation_2_object() const
@@ -210,7 +233,7 @@ public:
   enum { Has_static_filters = true };
 
 
-  typedef Static_filters_predicates::Compare_y_at_x_2<K_base,Self>          Compare_y_at_x_2;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Compare_y_at_x_2<K_base,Self>) Compare_y_at_x_2;
 
   // The following do not require filtering as they only do
   // comparisons.  We must be careful that *all* their function
@@ -238,8 +261,8 @@ public:
   typedef CartesianKernelFunctors::Compare_xyz_3<Self> Compare_xyz_3;
 
 #ifndef CGAL_NO_DO_INTERSECT_STATIC_FILTERS
-  typedef Static_filters_predicates::Do_intersect_2<K_base,Self>            Do_intersect_2;
-  typedef Static_filters_predicates::Do_intersect_3<K_base,Self>            Do_intersect_3;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Do_intersect_2<K_base,Self>) Do_intersect_2;
+  typedef CGAL_STATIC_FILTER_WITH_STATISTICS(Static_filters_predicates::Do_intersect_3<K_base,Self>) Do_intersect_3;
 #endif // NOT CGAL_NO_DO_INTERSECT_STATIC_FILTERS
 
   Compare_xy_2
@@ -0,0 +1,392 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_FILTERED_KERNEL_STATISTICS_H
+#define CGAL_FILTERED_KERNEL_STATISTICS_H
+
+#include <CGAL/config.h>
+
+#include <boost/core/demangle.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+// Runtime statistics of the filtered predicates and of the lazy constructions.
+//
+// When `CGAL_FILTERED_KERNEL_STATISTICS` is defined, the static filters, `Filtered_predicate`,
+// and the lazy constructions update counters while the statistics are enabled, which
+// costs a relaxed atomic load per call while they are disabled. The counters of
+// an operation are identified by its kind and by the name of its functor without
+// namespace nor template arguments (e.g., "Orientation_3"), so that the counters of
+// all the kernels are merged.
+//
+// Each thread updates its own counters without atomic read-modify-write operations,
+// and the counters of a thread are added to the global ones when it exits. The counters
+// are read and reset by other threads with relaxed atomic operations, so a reset
+// concurrent with updates may be partially lost.
+
+namespace CGAL {
+
+class Filtered_kernel_statistics
+{
+public:
+  enum Kind { PREDICATE, CONSTRUCTION };
+
+  // the number of buckets of the histograms of the times of the exact evaluations:
+  // the bucket `i` counts the evaluations that took between 2^i and 2^(i+1) nanoseconds
+  static constexpr std::size_t histogram_size = 32;
+
+  struct Counters
+  {
+    Kind kind;
+    std::string name;
+    std::uint64_t static_filter_calls = 0;
+    std::uint64_t interval_calls = 0;
+    std::uint64_t interval_failures = 0;
+    std::uint64_t exact_evaluations = 0;
+    std::uint64_t exact_time = 0; // in nanoseconds
+    std::array<std::uint64_t, histogram_size> exact_time_histogram {};
+  };
+
+  enum Field { STATIC_FILTER_CALLS, INTERVAL_CALLS, INTERVAL_FAILURES,
+               EXACT_EVALUATIONS, EXACT_TIME, NUMBER_OF_FIELDS };
+
+  // The counters of an operation in a thread. Only that thread modifies them.
+  struct Slot
+  {
+    std::array<std::atomic<std::uint64_t>, NUMBER_OF_FIELDS + histogram_size> values;
+
+    Slot() { clear(); }
+
+    void clear()
+    {
+      for(std::atomic<std::uint64_t>& v : values)
+        v.store(0, std::memory_order_relaxed);
+    }
+
+    void add(std::size_t i, std::uint64_t n = 1)
+    {
+      values[i].store(values[i].load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    void increment(Field f) { add(f); }
+
+    void add_exact_time(std::uint64_t ns)
+    {
+      add(EXACT_EVALUATIONS);
+      add(EXACT_TIME, ns);
+      std::size_t bucket = 0;
+      while(ns > 1 && bucket + 1 < histogram_size)
+      {
+        ns >>= 1;
+        ++bucket;
+      }
+      add(NUMBER_OF_FIELDS + bucket);
+    }
+  };
+
+private:
+  static constexpr std::size_t chunk_size = 64;
+  static constexpr std::size_t number_of_chunks = 64; // at most 4096 operations
+
+  typedef std::array<Slot, chunk_size> Chunk;
+
+  struct Thread_counters
+  {
+    std::array<std::atomic<Chunk*>, number_of_chunks> chunks;
+
+    Thread_counters()
+    {
+      for(std::atomic<Chunk*>& c : chunks)
+        c.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~Thread_counters()
+    {
+      for(std::atomic<Chunk*>& c : chunks)
+        delete c.load(std::memory_order_relaxed);
+    }
+  };
+
+  struct Registry
+  {
+    std::mutex mutex;
+    std::map<std::pair<Kind, std::string>, std::size_t> ids;
+    std::vector<std::pair<Kind, std::string> > names;
+    std::vector<Thread_counters*> threads;
+    std::vector<std::array<std::uint64_t, NUMBER_OF_FIELDS + histogram_size> > exited;
+  };
+
+  static Registry& registry()
+  {
+    static Registry r;
+    return r;
+  }
+
+  static std::atomic<bool>& enabled_flag()
+  {
+    static std::atomic<bool> e { false };
+    return e;
+  }
+
+  // adds the counters of the thread to `exited` when it exits
+  struct Thread_owner
+  {
+    Thread_counters* counters;
+
+    Thread_owner() : counters(new Thread_counters())
+    {
+      Registry& r = registry();
+      std::lock_guard<std::mutex> lock(r.mutex);
+      r.threads.push_back(counters);
+    }
+
+    ~Thread_owner()
+    {
+      Registry& r = registry();
+      std::lock_guard<std::mutex> lock(r.mutex);
+      for(std::size_t c=0; c<number_of_chunks; ++c)
+      {
+        Chunk* chunk = counters->chunks[c].load(std::memory_order_relaxed);
+        if(chunk == nullptr)
+          continue;
+        for(std::size_t i=0; i<chunk_size; ++i)
+        {
+          const std::size_t id = c * chunk_size + i;
+          if(id >= r.exited.size())
+            break;
+          for(std::size_t f=0; f<NUMBER_OF_FIELDS + histogram_size; ++f)
+            r.exited[id][f] += (*chunk)[i].values[f].load(std::memory_order_relaxed);
+        }
+      }
+      for(std::size_t i=0; i<r.threads.size(); ++i)
+        if(r.threads[i] == counters)
+        {
+          r.threads[i] = r.threads.back();
+          r.threads.pop_back();
+          break;
+        }
+      delete counters;
+    }
+  };
+
+  static Thread_counters& thread_counters()
+  {
+    static thread_local Thread_owner owner;
+    return *owner.counters;
+  }
+
+  static std::size_t register_operation(Kind kind, const std::string& name)
+  {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    auto res = r.ids.emplace(std::make_pair(kind, name), r.names.size());
+    if(res.second)
+    {
+      r.names.emplace_back(kind, name);
+      r.exited.emplace_back();
+      r.exited.back().fill(0);
+    }
+    return res.first->second;
+  }
+
+  // "CGAL::CartesianKernelFunctors::Orientation_3<CGAL::Simple_cartesian<...> >" -> "Orientation_3"
+  static std::string short_name(const std::string& type_name)
+  {
+    std::string res;
+    int depth = 0;
+    for(char c : type_name)
+    {
+      if(c == '<')
+        ++depth;
+      else if(c == '>')
+        --depth;
+      else if(depth == 0)
+        res += c;
+    }
+    const std::size_t colons = res.rfind("::");
+    return (colons == std::string::npos) ? res : res.substr(colons + 2);
+  }
+
+public:
+  // enables or disables the update of the counters, in all the threads
+  static void enable(bool b = true) { enabled_flag().store(b, std::memory_order_relaxed); }
+  static void disable() { enable(false); }
+
+  static bool is_enabled() { return enabled_flag().load(std::memory_order_relaxed); }
+
+  // the counters of the current thread for the operation of kind `kind` whose functor is `F`,
+  // or null if the statistics are disabled
+  template <Kind kind, typename F>
+  static Slot* slot()
+  {
+    if(!is_enabled())
+      return nullptr;
+    static const std::size_t id = register_operation(kind, short_name(boost::core::demangle(typeid(F).name())));
+    if(id >= chunk_size * number_of_chunks)
+      return nullptr;
+    std::atomic<Chunk*>& c = thread_counters().chunks[id / chunk_size];
+    Chunk* chunk = c.load(std::memory_order_relaxed);
+    if(chunk == nullptr)
+    {
+      chunk = new Chunk();
+      // published under the mutex, as the counters are read under it
+      Registry& r = registry();
+      std::lock_guard<std::mutex> lock(r.mutex);
+      c.store(chunk, std::memory_order_relaxed);
+    }
+    return &(*chunk)[id % chunk_size];
+  }
+
+  // sets all the counters to zero
+  static void reset()
+  {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for(auto& e : r.exited)
+      e.fill(0);
+    for(Thread_counters* t : r.threads)
+      for(std::atomic<Chunk*>& c : t->chunks)
+      {
+        Chunk* chunk = c.load(std::memory_order_relaxed);
+        if(chunk != nullptr)
+          for(Slot& s : *chunk)
+            s.clear();
+      }
+  }
+
+  // returns the sums of the counters of all the threads, for the operations that were called
+  static std::vector<Counters> counters()
+  {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    std::vector<std::array<std::uint64_t, NUMBER_OF_FIELDS + histogram_size> > sums = r.exited;
+    for(Thread_counters* t : r.threads)
+      for(std::size_t c=0; c<number_of_chunks; ++c)
+      {
+        Chunk* chunk = t->chunks[c].load(std::memory_order_relaxed);
+        if(chunk == nullptr)
+          continue;
+        for(std::size_t i=0; i<chunk_size && c * chunk_size + i < sums.size(); ++i)
+          for(std::size_t f=0; f<NUMBER_OF_FIELDS + histogram_size; ++f)
+            sums[c * chunk_size + i][f] += (*chunk)[i].values[f].load(std::memory_order_relaxed);
+      }
+
+    std::vector<Counters> res;
+    for(std::size_t id=0; id<sums.size(); ++id)
+    {
+      const auto& s = sums[id];
+      if(s[STATIC_FILTER_CALLS] == 0 && s[INTERVAL_CALLS] == 0 && s[EXACT_EVALUATIONS] == 0)
+        continue;
+      Counters c;
+      c.kind = r.names[id].first;
+      c.name = r.names[id].second;
+      c.static_filter_calls = s[STATIC_FILTER_CALLS];
+      c.interval_calls = s[INTERVAL_CALLS];
+      c.interval_failures = s[INTERVAL_FAILURES];
+      c.exact_evaluations = s[EXACT_EVALUATIONS];
+      c.exact_time = s[EXACT_TIME];
+      for(std::size_t b=0; b<histogram_size; ++b)
+        c.exact_time_histogram[b] = s[NUMBER_OF_FIELDS + b];
+      res.push_back(c);
+    }
+    return res;
+  }
+
+  // writes the counters in JSON
+  static void write_json(std::ostream& os)
+  {
+    const std::vector<Counters> all = counters();
+    os << "{";
+    for(Kind kind : { PREDICATE, CONSTRUCTION })
+    {
+      os << (kind == PREDICATE ? "\n  \"predicates\": {" : ",\n  \"constructions\": {");
+      bool first = true;
+      for(const Counters& c : all)
+      {
+        if(c.kind != kind)
+          continue;
+        os << (first ? "\n" : ",\n") << "    \"" << c.name << "\": { ";
+        first = false;
+        if(kind == PREDICATE)
+          os << "\"static_filter_calls\": " << c.static_filter_calls << ", ";
+        os << "\"interval_calls\": " << c.interval_calls
+           << ", \"interval_failures\": " << c.interval_failures
+           << ", \"exact_evaluations\": " << c.exact_evaluations
+           << ", \"exact_time_ns\": " << c.exact_time
+           << ", \"exact_time_histogram\": [";
+        std::size_t n = histogram_size;
+        while(n > 0 && c.exact_time_histogram[n-1] == 0)
+          --n;
+        for(std::size_t b=0; b<n; ++b)
+          os << (b == 0 ? "" : ", ") << c.exact_time_histogram[b];
+        os << "] }";
+      }
+      os << (first ? "}" : "\n  }");
+    }
+    os << "\n}" << std::endl;
+  }
+};
+
+namespace internal {
+
+// measures the time of an exact evaluation, if `slot` is not null
+class Filtered_kernel_statistics_timer
+{
+  Filtered_kernel_statistics::Slot* slot;
+  std::chrono::steady_clock::time_point start;
+
+public:
+  Filtered_kernel_statistics_timer(Filtered_kernel_statistics::Slot* slot)
+    : slot(slot)
+  {
+    if(slot != nullptr)
+      start = std::chrono::steady_clock::now();
+  }
+
+  ~Filtered_kernel_statistics_timer()
+  {
+    if(slot != nullptr)
+      slot->add_exact_time(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             std::chrono::steady_clock::now() - start).count());
+  }
+};
+
+} // namespace internal
+
+} // namespace CGAL
+
+#ifdef CGAL_FILTERED_KERNEL_STATISTICS
+#  define CGAL_FILTERED_KERNEL_STATISTICS_SLOT(KIND, F, NAME) \
+     ::CGAL::Filtered_kernel_statistics::Slot* NAME = \
+       ::CGAL::Filtered_kernel_statistics::slot< ::CGAL::Filtered_kernel_statistics::KIND, F>()
+#  define CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(NAME, FIELD) \
+     do { if(NAME != nullptr) NAME->increment(::CGAL::Filtered_kernel_statistics::FIELD); } while(false)
+#  define CGAL_FILTERED_KERNEL_STATISTICS_TIMER(NAME) \
+     ::CGAL::internal::Filtered_kernel_statistics_timer NAME##_timer(NAME)
+#else
+#  define CGAL_FILTERED_KERNEL_STATISTICS_SLOT(KIND, F, NAME)
+#  define CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(NAME, FIELD)
+#  define CGAL_FILTERED_KERNEL_STATISTICS_TIMER(NAME)
+#endif
+
+#endif // CGAL_FILTERED_KERNEL_STATISTICS_H
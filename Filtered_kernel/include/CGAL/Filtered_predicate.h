@@ -18,6 +18,7 @@
 #include <CGAL/Interval_nt.h>
 #include <CGAL/Uncertain.h>
 #include <CGAL/Profile_counter.h>
+#include <CGAL/Filtered_kernel_statistics.h>
 
 #include <type_traits>
 
@@ -91,6 +92,8 @@ public:
 
 #ifndef CGAL_EPICK_NO_INTERVALS
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(PREDICATE, AP, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     // Protection is outside the try block as VC8 has the CGAL_CFG_FPU_ROUNDING_MODE_UNWINDING_VC_BUG
     {
       Protect_FPU_rounding<Protection> p;
@@ -103,6 +106,8 @@ public:
       catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> p(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
 #endif // CGAL_EPICK_NO_INTERVALS
@@ -159,6 +164,8 @@ public:
   {
 #ifndef CGAL_EPICK_NO_INTERVALS
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(PREDICATE, AP, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     // Protection is outside the try block as VC8 has the CGAL_CFG_FPU_ROUNDING_MODE_UNWINDING_VC_BUG
     {
       Protect_FPU_rounding<Protection> p;
@@ -171,6 +178,8 @@ public:
       catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> p(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
 #endif // CGAL_EPICK_NO_INTERVALS
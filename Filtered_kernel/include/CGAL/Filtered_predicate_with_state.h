@@ -18,6 +18,7 @@
 #include <CGAL/Interval_nt.h>
 #include <CGAL/Uncertain.h>
 #include <CGAL/Profile_counter.h>
+#include <CGAL/Filtered_kernel_statistics.h>
 #include <optional>
 
 namespace CGAL {
@@ -61,6 +62,8 @@ Filtered_predicate_with_state<EP,AP,C2E,C2A,O1,Protection>::
   operator()(const Args&... args) const
 {
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(PREDICATE, AP, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     // Protection is outside the try block as VC8 has the CGAL_CFG_FPU_ROUNDING_MODE_UNWINDING_VC_BUG
     {
       Protect_FPU_rounding<Protection> p;
@@ -73,6 +76,8 @@ Filtered_predicate_with_state<EP,AP,C2E,C2A,O1,Protection>::
       catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> p(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     if(! oep){
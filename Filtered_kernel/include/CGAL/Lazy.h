@@ -20,12 +20,14 @@
 #include <CGAL/Object.h>
 #include <CGAL/Kernel/Type_mapper.h>
 #include <CGAL/Profile_counter.h>
+#include <CGAL/Filtered_kernel_statistics.h>
 #include <CGAL/Kernel/Return_base_tag.h>
 #include <CGAL/min_max_n.h>
 #include <CGAL/Origin.h>
 #include <CGAL/Bbox_2.h>
 #include <CGAL/Bbox_3.h>
 #include <CGAL/Default.h>
+#include <CGAL/Lazy_arena.h>
 #include <CGAL/tss.h>
 #include <CGAL/type_traits/is_iterator.h>
 #include <CGAL/transforming_iterator.h>
@@ -48,6 +50,7 @@
 #include <atomic>
 #include <thread>
 #include <mutex>
+#include <unordered_set>
 
 namespace CGAL {
 
@@ -235,6 +238,148 @@ struct Depth_base {
 #endif
 };
 
+// Statistics of the exact evaluations of the lazy kernel in the calling thread
+struct Lazy_exact_evaluation_statistics
+{
+  // number of nodes of the DAGs whose exact value has been computed
+  std::size_t number_of_exact_evaluations = 0;
+  // number of calls to the iterative evaluation that computed some exact values
+  std::size_t number_of_iterative_evaluations = 0;
+  // maximal depth of the DAGs evaluated iteratively, which is the depth of
+  // the recursion that the usual evaluation would have needed
+  std::size_t max_depth = 0;
+};
+
+inline Lazy_exact_evaluation_statistics& lazy_exact_evaluation_statistics()
+{
+  CGAL_STATIC_THREAD_LOCAL_VARIABLE_0(Lazy_exact_evaluation_statistics, stats);
+  return stats;
+}
+
+// The interface of the nodes of the DAGs that is needed to evaluate them iteratively
+class Lazy_rep_base : public Rep
+{
+protected:
+  Lazy_rep_base(int count = 1) : Rep(count) {}
+
+public:
+  virtual bool is_lazy_node() const = 0;
+  // computes the exact value of the node, its children being already exact
+  virtual void evaluate_exact() const = 0;
+  // appends the children of a lazy node that are lazy. Nodes that do not give their
+  // children evaluate them recursively.
+  virtual void lazy_children(std::vector<const Lazy_rep_base*>&) const {}
+};
+
+inline const Lazy_rep_base* lazy_dag_node(const void*) { return nullptr; }
+template <typename AT, typename ET, typename E2A>
+const Lazy_rep_base* lazy_dag_node(const Lazy<AT,ET,E2A>* x);
+
+template <typename T>
+void add_lazy_child(const T& t, std::vector<const Lazy_rep_base*>& children)
+{
+  const Lazy_rep_base* c = lazy_dag_node(std::addressof(t));
+  if(c != nullptr && c->is_lazy_node())
+    children.push_back(c);
+}
+
+template <typename... T, std::size_t... I>
+void add_lazy_children(const std::tuple<T...>& t, std::vector<const Lazy_rep_base*>& children,
+                       std::index_sequence<I...>)
+{
+  auto ignore = [](auto&&...){};
+  ignore( (add_lazy_child(std::get<I>(t), children), 0) ... );
+}
+
+// Computes the exact value of a DAG without recursion: the lazy nodes are sorted
+// topologically, and evaluated from the leaves, each evaluation pruning the DAG.
+// The buffers are kept from one evaluation to the next.
+class Lazy_exact_evaluator
+{
+  std::vector<std::pair<const Lazy_rep_base*, bool> > stack;
+  std::vector<const Lazy_rep_base*> order;
+  std::vector<const Lazy_rep_base*> children;
+  std::unordered_set<const Lazy_rep_base*> visited;
+  bool in_use = false;
+
+  void evaluate_impl(const Lazy_rep_base* root)
+  {
+    std::size_t depth = 0, max_depth = 0;
+    stack.emplace_back(root, false);
+    while(!stack.empty())
+    {
+      const Lazy_rep_base* n = stack.back().first;
+      if(stack.back().second) // all the children of n are in order
+      {
+        stack.pop_back();
+        order.push_back(n);
+        --depth;
+        continue;
+      }
+      if(!visited.insert(n).second)
+      {
+        stack.pop_back();
+        continue;
+      }
+      stack.back().second = true;
+      max_depth = (std::max)(max_depth, ++depth);
+      children.clear();
+      n->lazy_children(children);
+      for(const Lazy_rep_base* c : children)
+        if(visited.count(c) == 0)
+          stack.emplace_back(c, false);
+    }
+
+    // A node can only be destroyed by the pruning of one of its parents,
+    // which are evaluated after it.
+    for(const Lazy_rep_base* n : order)
+      n->evaluate_exact();
+
+    Lazy_exact_evaluation_statistics& stats = lazy_exact_evaluation_statistics();
+    ++stats.number_of_iterative_evaluations;
+    stats.max_depth = (std::max)(stats.max_depth, max_depth);
+  }
+
+  void clear()
+  {
+    stack.clear();
+    order.clear();
+    visited.clear();
+  }
+
+public:
+  static void evaluate(const Lazy_rep_base* root)
+  {
+    if(!root->is_lazy_node())
+      return;
+    // The children of a node may be pruned concurrently by another thread
+    if(!is_currently_single_threaded())
+    {
+      root->evaluate_exact();
+      return;
+    }
+
+    CGAL_STATIC_THREAD_LOCAL_VARIABLE_0(Lazy_exact_evaluator, evaluator);
+    if(evaluator.in_use)
+    {
+      // called from a node that evaluates its children recursively
+      Lazy_exact_evaluator local;
+      local.evaluate_impl(root);
+      return;
+    }
+    evaluator.in_use = true;
+    try {
+      evaluator.evaluate_impl(root);
+    } catch(...) {
+      evaluator.clear();
+      evaluator.in_use = false;
+      throw;
+    }
+    evaluator.clear();
+    evaluator.in_use = false;
+  }
+};
+
 template<class T, bool=std::is_base_of<Handle, T>::value> struct Lazy_reset_member_1 {
   void operator()(T& t)const{ t = T(); }
 };
@@ -296,7 +441,7 @@ struct AT_ET_wrap : AT_wrap<AT> {
 
 // Abstract base class for lazy numbers and lazy objects
 template <typename AT_, typename ET, typename E2A, int=Lazy_rep_selector<AT_>::value /* 0 */>
-class Lazy_rep : public Rep, public Depth_base
+class Lazy_rep : public Lazy_rep_base, public Depth_base, public internal::Lazy_arena_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -306,6 +451,11 @@ public:
   typedef AT_ AT;
   typedef AT_ET_wrap<AT,ET> Indirect;
 
+  // The exact values are allocated in the current `Lazy_arena`, if any
+  template<class... A>
+  static Indirect* new_indirect(A&&... a) { return internal::lazy_arena_new<Indirect>(std::forward<A>(a)...); }
+  static void delete_indirect(Indirect* p) { internal::lazy_arena_delete(p); }
+
   AT_wrap<AT> at_orig{};
   mutable std::atomic<AT_wrap<AT>*> ptr_ { &at_orig };
   mutable std::once_flag once;
@@ -318,11 +468,11 @@ public:
 
   template<class A>
   Lazy_rep (int count, A&& a)
-    : Rep(count), at_orig(std::forward<A>(a)){}
+    : Lazy_rep_base(count), at_orig(std::forward<A>(a)){}
 
   template<class A, class E>
   Lazy_rep (A&& a, E&& e)
-      : ptr_(new AT_ET_wrap<AT,ET>(std::forward<A>(a), std::forward<E>(e))) {}
+      : ptr_(new_indirect(std::forward<A>(a), std::forward<E>(e))) {}
 
   AT const& approx() const
   {
@@ -339,7 +489,10 @@ public:
   {
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){
+      ++lazy_exact_evaluation_statistics().number_of_exact_evaluations;
+      this->update_exact();
+    });
     return exact_unsafe(); // call_once already synchronized memory
   }
 
@@ -389,17 +542,20 @@ public:
 #endif
 
   bool is_lazy() const { return ptr_.load(std::memory_order_relaxed) == &at_orig; }
+
+  bool is_lazy_node() const override { return is_lazy(); }
+  void evaluate_exact() const override { exact(); }
   virtual void update_exact() const = 0;
   virtual ~Lazy_rep() {
 #if !defined __SANITIZE_THREAD__ && !__has_feature(thread_sanitizer)
     auto* p = ptr_.load(std::memory_order_relaxed);
     if (p != &at_orig) {
       std::atomic_thread_fence(std::memory_order_acquire);
-      delete static_cast<Indirect*>(p);
+      delete_indirect(static_cast<Indirect*>(p));
     }
 #else
     auto* p = ptr_.load(std::memory_order_consume);
-    if (p != &at_orig) delete static_cast<Indirect*>(p);
+    if (p != &at_orig) delete_indirect(static_cast<Indirect*>(p));
 #endif
   }
 };
@@ -409,7 +565,7 @@ public:
  * For aggregate-like types (Simple_cartesian::Point_3), it should be ok for the same reason.
  * This is definitely NOT safe for a std::vector like a Point_d with Dynamic_dimension_tag, so it should only be enabled on a case by case basis, if at all. Storing a Point_3 piecewise with 6 atomic_double would be doable, but painful, and I didn't benchmark to check the performance. */
 template <typename AT_, typename ET, typename E2A>
-class Lazy_rep<AT_, ET, E2A, 1> : public Rep, public Depth_base
+class Lazy_rep<AT_, ET, E2A, 1> : public Lazy_rep_base, public Depth_base, public internal::Lazy_arena_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -419,6 +575,11 @@ public:
   typedef AT_ AT;
   typedef ET Indirect;
 
+  // The exact values are allocated in the current `Lazy_arena`, if any
+  template<class... A>
+  static Indirect* new_indirect(A&&... a) { return internal::lazy_arena_new<Indirect>(std::forward<A>(a)...); }
+  static void delete_indirect(Indirect* p) { internal::lazy_arena_delete(p); }
+
   mutable AT at;
   mutable std::atomic<ET*> ptr_ { nullptr };
 #ifdef CGAL_HAS_THREADS
@@ -433,11 +594,11 @@ public:
 
   template<class A>
   Lazy_rep (int count, A&& a)
-    : Rep(count), at(std::forward<A>(a)){}
+    : Lazy_rep_base(count), at(std::forward<A>(a)){}
 
   template<class A, class E>
   Lazy_rep (A&& a, E&& e)
-      : at(std::forward<A>(a)), ptr_(new ET(std::forward<E>(e))) {}
+      : at(std::forward<A>(a)), ptr_(new_indirect(std::forward<E>(e))) {}
 
   AT const& approx() const
   {
@@ -464,10 +625,15 @@ public:
 #ifdef CGAL_HAS_THREADS
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){
+      ++lazy_exact_evaluation_statistics().number_of_exact_evaluations;
+      this->update_exact();
+    });
 #else
-    if (is_lazy())
+    if (is_lazy()) {
+      ++lazy_exact_evaluation_statistics().number_of_exact_evaluations;
       this->update_exact();
+    }
 #endif
     return exact_unsafe(); // call_once already synchronized memory
   }
@@ -505,24 +671,27 @@ public:
 #endif
 
   bool is_lazy() const { return ptr_.load(std::memory_order_relaxed) == nullptr; }
+
+  bool is_lazy_node() const override { return is_lazy(); }
+  void evaluate_exact() const override { exact(); }
   virtual void update_exact() const = 0;
   virtual ~Lazy_rep() {
 #if !defined __SANITIZE_THREAD__ && !__has_feature(thread_sanitizer)
     auto* p = ptr_.load(std::memory_order_relaxed);
     if (p != nullptr) {
       std::atomic_thread_fence(std::memory_order_acquire);
-      delete p;
+      delete_indirect(p);
     }
 #else
     auto* p = ptr_.load(std::memory_order_consume);
-    if (p != nullptr) delete p;
+    if (p != nullptr) delete_indirect(p);
 #endif
   }
 };
 
 // do we need to (forward) declare Interval_nt?
 template <bool b, typename ET, typename E2A>
-class Lazy_rep<Interval_nt<b>, ET, E2A, 2> : public Rep, public Depth_base
+class Lazy_rep<Interval_nt<b>, ET, E2A, 2> : public Lazy_rep_base, public Depth_base, public internal::Lazy_arena_allocated
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -532,6 +701,11 @@ public:
   typedef Interval_nt<b> AT;
   typedef ET Indirect;
 
+  // The exact values are allocated in the current `Lazy_arena`, if any
+  template<class... A>
+  static Indirect* new_indirect(A&&... a) { return internal::lazy_arena_new<Indirect>(std::forward<A>(a)...); }
+  static void delete_indirect(Indirect* p) { internal::lazy_arena_delete(p); }
+
   mutable std::atomic<double> x, y; // -inf, +sup
   mutable std::atomic<ET*> ptr_ { nullptr };
   mutable std::once_flag once;
@@ -541,7 +715,7 @@ public:
 
   template<class E>
   Lazy_rep (AT a, E&& e)
-      : x(-a.inf()), y(a.sup()), ptr_(new ET(std::forward<E>(e))) {}
+      : x(-a.inf()), y(a.sup()), ptr_(new_indirect(std::forward<E>(e))) {}
 
   AT approx() const
   {
@@ -573,7 +747,10 @@ public:
   {
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){
+      ++lazy_exact_evaluation_statistics().number_of_exact_evaluations;
+      this->update_exact();
+    });
     return exact_unsafe(); // call_once already synchronized memory
   }
 
@@ -612,17 +789,20 @@ public:
 #endif
 
   bool is_lazy() const { return ptr_.load(std::memory_order_relaxed) == nullptr; }
+
+  bool is_lazy_node() const override { return is_lazy(); }
+  void evaluate_exact() const override { exact(); }
   virtual void update_exact() const = 0;
   virtual ~Lazy_rep() {
 #if !defined __SANITIZE_THREAD__ && !__has_feature(thread_sanitizer)
     auto* p = ptr_.load(std::memory_order_relaxed);
     if (p != nullptr) {
       std::atomic_thread_fence(std::memory_order_acquire);
-      delete p;
+      delete_indirect(p);
     }
 #else
     auto* p = ptr_.load(std::memory_order_consume);
-    if (p != nullptr) delete p;
+    if (p != nullptr) delete_indirect(p);
 #endif
   }
 };
@@ -640,7 +820,16 @@ class Lazy_rep_n final :
   const EC& ec() const { return *this; }
   template<std::size_t...I>
   void update_exact_helper(std::index_sequence<I...>) const {
-    auto* p = new typename Base::Indirect(ec()( CGAL::exact( std::get<I>(l) ) ... ) );
+#ifdef CGAL_FILTERED_KERNEL_STATISTICS
+    // only the time of this node is measured: the children are evaluated first
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    if(stats != nullptr) {
+      auto ignore = [](auto&&...){};
+      ignore( CGAL::exact( std::get<I>(l) ) ... );
+    }
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
+#endif
+    auto* p = Base::new_indirect(ec()( CGAL::exact( std::get<I>(l) ) ... ) );
     this->set_at(p);
     this->set_ptr(p);
     if(!noprune || is_currently_single_threaded())
@@ -650,6 +839,10 @@ class Lazy_rep_n final :
   void update_exact() const {
     update_exact_helper(std::make_index_sequence<sizeof...(L)>{});
   }
+  void lazy_children(std::vector<const Lazy_rep_base*>& children) const {
+    if(this->is_lazy())
+      add_lazy_children(l, children, std::make_index_sequence<sizeof...(L)>{});
+  }
   template<class...LL>
   Lazy_rep_n(const AC& ac, const EC& ec, LL&&...ll) :
     Lazy_rep<AT, ET, E2A>(ac(CGAL::approx(ll)...)), EC(ec), l(std::forward<LL>(ll)...)
@@ -692,7 +885,15 @@ class Lazy_rep_optional_n :
   template<std::size_t...I>
   void update_exact_helper(std::index_sequence<I...>) const {
     typedef Lazy_rep< AT, ET, E2A > Base;
-    auto* p = new typename Base::Indirect( * ec()( CGAL::exact( std::get<I>(l) ) ... ) );
+#ifdef CGAL_FILTERED_KERNEL_STATISTICS
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    if(stats != nullptr) {
+      auto ignore = [](auto&&...){};
+      ignore( CGAL::exact( std::get<I>(l) ) ... );
+    }
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
+#endif
+    auto* p = Base::new_indirect( * ec()( CGAL::exact( std::get<I>(l) ) ... ) );
     this->set_at(p);
     this->set_ptr(p);
     lazy_reset_member(l);
@@ -706,6 +907,11 @@ class Lazy_rep_optional_n :
     update_exact_helper(std::make_index_sequence<sizeof...(L)>{});
   }
 
+  void lazy_children(std::vector<const Lazy_rep_base*>& children) const {
+    if(this->is_lazy())
+      add_lazy_children(l, children, std::make_index_sequence<sizeof...(L)>{});
+  }
+
   template<class...LL>
   Lazy_rep_optional_n(const AT& a, const EC& ec, LL&&...ll) :
     Lazy_rep<AT, ET, E2A>(a), EC(ec), l(std::forward<LL>(ll)...)
@@ -762,7 +968,7 @@ public:
     // An alternative would be to add in the constructors taking an ET: std::call_once(this->once, [](){});
     if(!this->is_lazy()) return;
 #endif
-    auto* p = new typename Base::Indirect();
+    auto* p = Base::new_indirect();
     this->set_ptr(p);
   }
 
@@ -879,7 +1085,7 @@ public:
   void
   update_exact() const
   {
-    auto* p = new typename Base::Indirect();
+    auto* p = Base::new_indirect();
     // TODO : This looks really unfinished...
     std::vector<Object> vec;
     //this->et->reserve(this->at.size());
@@ -931,7 +1137,7 @@ public:
   void
   update_exact() const
   {
-    auto* p = new typename Base::Indirect();
+    auto* p = Base::new_indirect();
     p->et_.reserve(this->at_orig.at().size());
     ec()(CGAL::exact(l1_), CGAL::exact(l2_), std::back_inserter(p->et_));
     this->set_at(p);
@@ -982,7 +1188,7 @@ public:
   void
   update_exact() const
   {
-    auto* p = new typename Base::Indirect();
+    auto* p = Base::new_indirect();
     ec()(CGAL::exact(l1_), CGAL::exact(l2_), p->et_);
     this->set_at(p);
     this->set_ptr(p);
@@ -1036,7 +1242,7 @@ public:
   void
   update_exact() const
   {
-    auto* p = new typename Base::Indirect();
+    auto* p = Base::new_indirect();
     ec()(CGAL::exact(l1_), CGAL::exact(l2_), p->et_.first, p->et_.second );
     this->set_at(p);
     this->set_ptr(p);
@@ -1144,7 +1350,12 @@ public :
   { return ptr()->approx(); }
 
   const ET& exact() const
-  { return ptr()->exact(); }
+  {
+#ifdef CGAL_LAZY_ITERATIVE_EXACT
+    Lazy_exact_evaluator::evaluate(ptr());
+#endif
+    return ptr()->exact();
+  }
 
   unsigned depth() const
   {
@@ -1169,8 +1380,25 @@ public :
   }
 
   Self_rep * ptr() const { return (Self_rep*) PTR; }
+
+  template <typename A, typename E, typename F>
+  friend const Lazy_rep_base* lazy_dag_node(const Lazy<A,E,F>* x);
 };
 
+template <typename AT, typename ET, typename E2A>
+const Lazy_rep_base* lazy_dag_node(const Lazy<AT,ET,E2A>* x)
+{
+  return x->ptr(); // null if the handle was pruned
+}
+
+// Computes the exact value of `x` without recursion, see `Lazy_exact_evaluator`.
+template <typename AT, typename ET, typename E2A>
+const ET& exact_iteratively(const Lazy<AT,ET,E2A>& x)
+{
+  Lazy_exact_evaluator::evaluate(lazy_dag_node(&x));
+  return x.exact();
+}
+
 // The magic functor for Construct_bbox_[2,3], as there is no Lazy<Bbox>
 
 template <typename LK, typename AC, typename EC>
@@ -1189,6 +1417,8 @@ struct Lazy_construction_bbox
   operator()(const L1& l1) const
   {
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       // Protection is outside the try block as VC8 has the CGAL_CFG_FPU_ROUNDING_MODE_UNWINDING_VC_BUG
       Protect_FPU_rounding<Protection> P;
@@ -1197,6 +1427,8 @@ struct Lazy_construction_bbox
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     return ec(CGAL::exact(l1));
@@ -1313,6 +1545,8 @@ struct Lazy_construction_nt {
     typedef std::remove_cv_t<std::remove_reference_t<decltype(ec(CGAL::exact(l)...))>> ET;
     typedef std::remove_cv_t<std::remove_reference_t<decltype(ac(CGAL::approx(l)...))>> AT;
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -1320,6 +1554,8 @@ struct Lazy_construction_nt {
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     return new Lazy_rep_0<AT,ET,To_interval<ET> >(ec( CGAL::exact(l)... ));
@@ -1535,6 +1771,8 @@ public:
   operator()(const L1& l1, const L2& l2, R1& r1) const
   {
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -1544,6 +1782,8 @@ public:
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     typename R1::ET et;
@@ -1604,6 +1844,8 @@ public:
     typedef Lazy<typename R1::AT, typename R1::ET, E2A> Handle_1;
     typedef Lazy<typename R2::AT, typename R2::ET, E2A> Handle_2;
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -1616,6 +1858,8 @@ public:
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     typename R1::ET et1, et2;
@@ -1651,6 +1895,8 @@ public:
   operator()(const L1& l1, const L2& l2, OutputIterator it) const
   {
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -1674,6 +1920,8 @@ public:
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     // TODO: Instead of using a vector, write an iterator adapter
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
@@ -1731,6 +1979,8 @@ public:
   operator()(const L1& l1) const
   {
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -1755,6 +2005,8 @@ public:
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     ET eto = ec(CGAL::exact(l1));
@@ -1766,6 +2018,8 @@ public:
   operator()(const L1& l1, const L2& l2) const
   {
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -1811,6 +2065,8 @@ public:
       return Object();
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     ET eto = ec(CGAL::exact(l1), CGAL::exact(l2));
@@ -1822,6 +2078,8 @@ public:
   operator()(const L1& l1, const L2& l2, const L3& l3) const
   {
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -1845,6 +2103,8 @@ public:
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     ET eto = ec(CGAL::exact(l1), CGAL::exact(l2), CGAL::exact(l3));
@@ -1995,6 +2255,8 @@ struct Lazy_construction_variant {
     typedef decltype(std::declval<EC const&>()( CGAL::exact(l1),  CGAL::exact(l2))) ET;
 
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
 
@@ -2019,6 +2281,8 @@ struct Lazy_construction_variant {
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     ET exact_v = EC()(CGAL::exact(l1), CGAL::exact(l2));
@@ -2049,6 +2313,8 @@ struct Lazy_construction_variant {
     typedef decltype(std::declval<EC const&>()( CGAL::exact(l1),  CGAL::exact(l2),  CGAL::exact(l3))) ET;
 
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
 
@@ -2073,6 +2339,8 @@ struct Lazy_construction_variant {
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     ET exact_v = EC()(CGAL::exact(l1), CGAL::exact(l2), CGAL::exact(l3));
@@ -2122,6 +2390,8 @@ struct Lazy_construction<LK, AC, EC, E2A_, true> {
   operator()(const L&... l) const {
     typedef Lazy < AT, ET, E2A > Handle;
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -2129,6 +2399,8 @@ struct Lazy_construction<LK, AC, EC, E2A_, true> {
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     return result_type(Handle(new Lazy_rep_0< AT, ET, E2A >(ec(CGAL::exact(l)...))));
@@ -2180,6 +2452,8 @@ struct Lazy_construction<LK, AC, EC, E2A_, false>
     typedef Lazy<AT, ET, E2A> Handle;
     typedef typename result<Lazy_construction(L...)>::type result_type;
     CGAL_BRANCH_PROFILER(std::string(" failures/calls to   : ") + std::string(CGAL_PRETTY_FUNCTION), tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_SLOT(CONSTRUCTION, AC, stats);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_CALLS);
     {
       Protect_FPU_rounding<Protection> P;
       try {
@@ -2187,6 +2461,8 @@ struct Lazy_construction<LK, AC, EC, E2A_, false>
       } catch (Uncertain_conversion_exception&) {}
     }
     CGAL_BRANCH_PROFILER_BRANCH(tmp);
+    CGAL_FILTERED_KERNEL_STATISTICS_INCREMENT(stats, INTERVAL_FAILURES);
+    CGAL_FILTERED_KERNEL_STATISTICS_TIMER(stats);
     Protect_FPU_rounding<!Protection> P2(CGAL_FE_TONEAREST);
     CGAL_expensive_assertion(FPU_get_cw() == CGAL_FE_TONEAREST);
     return result_type(Handle(new Lazy_rep_0<AT, ET, E2A> (ec(CGAL::exact(l)...))));
@@ -0,0 +1,287 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_LAZY_ARENA_H
+#define CGAL_LAZY_ARENA_H
+
+#include <CGAL/config.h>
+#include <CGAL/assertions.h>
+#include <CGAL/tss.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+// Allocation of the nodes of the DAGs of the lazy kernel and of their exact values.
+//
+// When `CGAL_LAZY_USE_ARENA` is defined, every allocation is preceded by a header
+// giving the block of the arena it comes from (or null if it comes from the heap).
+// A block is reference counted: its counter is the number of 16-byte units of the block
+// that are not released, plus one while its arena is alive. All the units belong to the
+// arena when the block is created, and the memory freed in the thread of the arena
+// is kept in its free lists, so that the counter is only updated when an object is freed
+// by another thread or after the destruction of the arena. The block is released by its
+// arena if nothing else uses it, or else by the deallocation of its last object.
+// Objects can thus outlive their arena (e.g., a static object created in the scope
+// of an arena), and be destroyed by another thread.
+//
+// When `CGAL_LAZY_USE_ARENA` is not defined, `Lazy_arena` has no effect.
+class Lazy_arena
+{
+#ifdef CGAL_LAZY_USE_ARENA
+  struct Block
+  {
+    std::atomic<std::size_t> count;
+    std::atomic<Lazy_arena*> arena;
+  };
+
+  struct alignas(16) Header
+  {
+    Block* block;
+    std::size_t size_class;
+  };
+
+  static constexpr std::size_t alignment = 16;
+  static constexpr std::size_t block_header_size =
+    ((sizeof(Block) + alignment - 1) / alignment) * alignment;
+  static constexpr std::size_t number_of_size_classes = 64; // up to 1kB
+#endif
+
+public:
+  explicit Lazy_arena(std::size_t block_size = 1 << 16)
+#ifdef CGAL_LAZY_USE_ARENA
+    : block_size_(block_size), current_(nullptr), end_(nullptr),
+      previous_(current()), number_of_allocations_(0), number_of_reuses_(0)
+  {
+    for(std::size_t i=0; i<number_of_size_classes; ++i)
+      free_lists_[i] = nullptr;
+    current() = this;
+  }
+#else
+  { CGAL_USE(block_size); }
+#endif
+
+  Lazy_arena(const Lazy_arena&) = delete;
+  Lazy_arena& operator=(const Lazy_arena&) = delete;
+
+  ~Lazy_arena()
+  {
+#ifdef CGAL_LAZY_USE_ARENA
+    CGAL_precondition(current() == this);
+    current() = previous_;
+    for(Block* b : blocks_)
+      b->arena.store(nullptr, std::memory_order_relaxed);
+    for(std::size_t i=0; i<number_of_size_classes; ++i)
+      for(void* p = free_lists_[i]; p != nullptr; )
+      {
+        Block* b = (static_cast<Header*>(p) - 1)->block;
+        p = *static_cast<void**>(p);
+        release(b, i);
+      }
+    if(!blocks_.empty())
+      release(blocks_.back(), (end_ - current_) / alignment);
+    for(Block* b : blocks_)
+      release(b, 1);
+#endif
+  }
+
+  // Number of objects allocated in the arena.
+  std::size_t number_of_allocations() const
+  {
+#ifdef CGAL_LAZY_USE_ARENA
+    return number_of_allocations_;
+#else
+    return 0;
+#endif
+  }
+
+  // Number of allocations that reused the memory of an object destroyed in the arena.
+  std::size_t number_of_reuses() const
+  {
+#ifdef CGAL_LAZY_USE_ARENA
+    return number_of_reuses_;
+#else
+    return 0;
+#endif
+  }
+
+  // Memory reserved by the arena, in bytes.
+  std::size_t memory_size() const
+  {
+#ifdef CGAL_LAZY_USE_ARENA
+    return blocks_.size() * block_size_;
+#else
+    return 0;
+#endif
+  }
+
+  // The innermost arena of the calling thread, or null.
+  static Lazy_arena* current_arena()
+  {
+#ifdef CGAL_LAZY_USE_ARENA
+    return current();
+#else
+    return nullptr;
+#endif
+  }
+
+#ifdef CGAL_LAZY_USE_ARENA
+  static void* allocate(std::size_t n)
+  {
+    const std::size_t size_class = (n + sizeof(Header) + alignment - 1) / alignment;
+    Lazy_arena* a = current();
+    if(a != nullptr && size_class < number_of_size_classes)
+      return a->allocate_in_arena(size_class);
+
+    Header* h = static_cast<Header*>(::operator new(size_class * alignment));
+    h->block = nullptr;
+    h->size_class = size_class;
+    return h + 1;
+  }
+
+  static void deallocate(void* p)
+  {
+    Header* h = static_cast<Header*>(p) - 1;
+    Block* b = h->block;
+    if(b == nullptr)
+    {
+      ::operator delete(h);
+      return;
+    }
+
+    Lazy_arena* a = current();
+    if(a != nullptr && b->arena.load(std::memory_order_relaxed) == a)
+    {
+      // the memory goes back to the arena
+      *static_cast<void**>(p) = a->free_lists_[h->size_class];
+      a->free_lists_[h->size_class] = p;
+      return;
+    }
+    release(b, h->size_class);
+  }
+#endif
+
+private:
+#ifdef CGAL_LAZY_USE_ARENA
+  static Lazy_arena*& current()
+  {
+    CGAL_STATIC_THREAD_LOCAL_VARIABLE(Lazy_arena*, arena, nullptr);
+    return arena;
+  }
+
+  static void release(Block* b, std::size_t units)
+  {
+    if(units != 0 && b->count.fetch_sub(units, std::memory_order_acq_rel) == units)
+    {
+      b->~Block();
+      ::operator delete(static_cast<void*>(b));
+    }
+  }
+
+  void* allocate_in_arena(std::size_t size_class)
+  {
+    ++number_of_allocations_;
+    if(void* p = free_lists_[size_class])
+    {
+      ++number_of_reuses_;
+      free_lists_[size_class] = *static_cast<void**>(p);
+      return p;
+    }
+
+    const std::size_t size = size_class * alignment;
+    if(current_ == nullptr || current_ + size > end_)
+      new_block(size);
+
+    Header* h = reinterpret_cast<Header*>(current_);
+    current_ += size;
+    h->block = blocks_.back();
+    h->size_class = size_class;
+    return h + 1;
+  }
+
+  void new_block(std::size_t size)
+  {
+    const std::size_t s = (block_size_ < block_header_size + size) ? block_header_size + size
+                                                                   : block_size_;
+    if(!blocks_.empty()) // the end of the previous block is not used
+      release(blocks_.back(), (end_ - current_) / alignment);
+    char* m = static_cast<char*>(::operator new(s));
+    Block* b = new (m) Block;
+    b->count.store((s - block_header_size) / alignment + 1, std::memory_order_relaxed);
+    b->arena.store(this, std::memory_order_relaxed);
+    blocks_.push_back(b);
+    current_ = m + block_header_size;
+    end_ = m + s;
+  }
+
+  std::size_t block_size_;
+  std::vector<Block*> blocks_;
+  char* current_;
+  char* end_;
+  void* free_lists_[number_of_size_classes];
+  Lazy_arena* previous_;
+  std::size_t number_of_allocations_;
+  std::size_t number_of_reuses_;
+#endif
+};
+
+namespace internal {
+
+// Base of the reps of the lazy kernel, which allocates them in the current `Lazy_arena`.
+struct Lazy_arena_allocated
+{
+#ifdef CGAL_LAZY_USE_ARENA
+  static void* operator new(std::size_t n) { return Lazy_arena::allocate(n); }
+  static void* operator new(std::size_t, void* p) noexcept { return p; }
+  static void operator delete(void* p) { Lazy_arena::deallocate(p); }
+  static void operator delete(void*, void*) noexcept {}
+#endif
+};
+
+// Creation and destruction of the exact values of the lazy kernel
+template <typename T, typename... A>
+T* lazy_arena_new(A&&... a)
+{
+#ifdef CGAL_LAZY_USE_ARENA
+  static_assert(alignof(T) <= 16, "over-aligned types are not supported");
+  void* p = Lazy_arena::allocate(sizeof(T));
+  try {
+    return new (p) T(std::forward<A>(a)...);
+  } catch(...) {
+    Lazy_arena::deallocate(p);
+    throw;
+  }
+#else
+  return new T(std::forward<A>(a)...);
+#endif
+}
+
+template <typename T>
+void lazy_arena_delete(T* p)
+{
+#ifdef CGAL_LAZY_USE_ARENA
+  p->~T();
+  Lazy_arena::deallocate(p);
+#else
+  delete p;
+#endif
+}
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_LAZY_ARENA_H
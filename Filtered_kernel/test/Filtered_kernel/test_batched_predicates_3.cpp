@@ -0,0 +1,89 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Batched_predicates_3.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+// Checks that the batched predicates give the same results as the predicates of the kernel,
+// on random points and on degenerate configurations that are not decided by the static filters.
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+struct Points
+{
+  std::vector<double> x, y, z;
+
+  void push_back(const Point_3& p)
+  {
+    x.push_back(p.x());
+    y.push_back(p.y());
+    z.push_back(p.z());
+  }
+
+  Point_3 operator[](std::size_t i) const { return Point_3(x[i], y[i], z[i]); }
+  CGAL::Coordinate_arrays_3 arrays() const { return { x.data(), y.data(), z.data() }; }
+};
+
+Point_3 random_point(CGAL::Random& rng, bool on_grid)
+{
+  if(on_grid) // many coplanar and cospherical tuples
+    return Point_3(rng.get_int(0, 4), rng.get_int(0, 4), rng.get_int(0, 4));
+  return Point_3(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+}
+
+void test(std::size_t n, bool on_grid)
+{
+  CGAL::Random rng(n);
+  Points p, q, r, s, t;
+  for(std::size_t i=0; i<n; ++i)
+  {
+    p.push_back(random_point(rng, on_grid));
+    q.push_back(random_point(rng, on_grid));
+    r.push_back(random_point(rng, on_grid));
+    s.push_back(random_point(rng, on_grid));
+    t.push_back(random_point(rng, on_grid));
+  }
+  // a few tuples with huge and tiny coordinates, for the underflow and overflow protections
+  if(n > 2)
+  {
+    p.x[0] = 1e200; q.y[0] = -1e200;
+    p.x[1] = 1e-200; q.x[1] = 2e-200; r.y[1] = 1e-200; s.z[1] = 1e-200; t.x[1] = 0;
+  }
+
+  std::vector<CGAL::Orientation> orientations(n);
+  std::size_t nf = CGAL::Batched_orientation_3<K>()(n, p.arrays(), q.arrays(), r.arrays(), s.arrays(),
+                                                    orientations.data());
+  std::cout << n << (on_grid ? " points on a grid" : " random points")
+            << ": " << nf << " orientations not decided by the static filters" << std::endl;
+  for(std::size_t i=0; i<n; ++i)
+    assert(orientations[i] == CGAL::orientation(p[i], q[i], r[i], s[i]));
+  if(on_grid && n > 100)
+    assert(nf > 0);
+
+  std::vector<CGAL::Oriented_side> sides(n);
+  CGAL::Batched_side_of_oriented_sphere_3<K>()(n, p.arrays(), q.arrays(), r.arrays(), s.arrays(),
+                                               t.arrays(), sides.data());
+  for(std::size_t i=0; i<n; ++i)
+    assert(sides[i] == CGAL::side_of_oriented_sphere(p[i], q[i], r[i], s[i], t[i]));
+
+  std::vector<CGAL::Comparison_result> comparisons(n);
+  CGAL::Batched_compare_distance_3<K>()(n, p.arrays(), q.arrays(), r.arrays(), comparisons.data());
+  for(std::size_t i=0; i<n; ++i)
+    assert(comparisons[i] == CGAL::compare_distance_to_point(p[i], q[i], r[i]));
+}
+
+int main()
+{
+  for(std::size_t n : { 0, 1, 7, 13, 1000 })
+  {
+    test(n, false);
+    test(n, true);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
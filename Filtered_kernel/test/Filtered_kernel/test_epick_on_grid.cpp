@@ -0,0 +1,133 @@
+#define CGAL_GRID_PREDICATES_VERIFY
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel_on_grid.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+// Checks that the predicates of Epick_on_grid give the same results as the ones of Epick,
+// on degenerate configurations of points on the grid (where the integer arithmetic is used),
+// and on points that are not on the grid. The verification mode also compares each result
+// computed with integers with the one of the filtered predicate.
+
+typedef CGAL::Epick Epick;
+
+template <typename K>
+struct Points
+{
+  std::vector<typename K::Point_2> p2;
+  std::vector<typename K::Point_3> p3;
+};
+
+template <int G, int B>
+void test(double step, int n, double offset)
+{
+  typedef CGAL::Epick_on_grid<G, B> K;
+  CGAL::Random rng(G + B);
+
+  // points on a small lattice: many collinear, coplanar, cocircular, and cospherical tuples
+  std::vector<double> x, y, z;
+  const double shift = std::ldexp(1., B) - 4 * step; // close to the bound
+  for(int i=0; i<n; ++i)
+  {
+    x.push_back(shift - rng.get_int(0, 4) * step + offset);
+    y.push_back(-shift + rng.get_int(0, 4) * step);
+    z.push_back(rng.get_int(0, 4) * step);
+  }
+  if(offset == 0)
+    assert(K::is_on_grid(x[0]) && K::is_on_grid(y[0]) && K::is_on_grid(z[0]));
+
+  const typename K::Orientation_2 orientation_2 = K().orientation_2_object();
+  const typename K::Orientation_3 orientation_3 = K().orientation_3_object();
+  const typename K::Side_of_oriented_circle_2 side_of_oriented_circle_2 = K().side_of_oriented_circle_2_object();
+  const typename K::Side_of_oriented_sphere_3 side_of_oriented_sphere_3 = K().side_of_oriented_sphere_3_object();
+
+  int zeros = 0;
+  for(int i=0; i+4<n; ++i)
+  {
+    const typename K::Point_2 a(x[i], y[i]), b(x[i+1], y[i+1]), c(x[i+2], y[i+2]), d(x[i+3], y[i+3]);
+    const Epick::Point_2 ea(x[i], y[i]), eb(x[i+1], y[i+1]), ec(x[i+2], y[i+2]), ed(x[i+3], y[i+3]);
+    assert(orientation_2(a, b, c) == CGAL::orientation(ea, eb, ec));
+    assert(side_of_oriented_circle_2(a, b, c, d) == CGAL::side_of_oriented_circle(ea, eb, ec, ed));
+
+    const typename K::Point_3 p(x[i], y[i], z[i]), q(x[i+1], y[i+1], z[i+1]), r(x[i+2], y[i+2], z[i+2]),
+                              s(x[i+3], y[i+3], z[i+3]), t(x[i+4], y[i+4], z[i+4]);
+    const Epick::Point_3 ep(x[i], y[i], z[i]), eq(x[i+1], y[i+1], z[i+1]), er(x[i+2], y[i+2], z[i+2]),
+                         es(x[i+3], y[i+3], z[i+3]), et(x[i+4], y[i+4], z[i+4]);
+    const CGAL::Orientation o = orientation_3(p, q, r, s);
+    assert(o == CGAL::orientation(ep, eq, er, es));
+    assert(side_of_oriented_sphere_3(p, q, r, s, t) == CGAL::side_of_oriented_sphere(ep, eq, er, es, et));
+    if(o == CGAL::ZERO)
+      ++zeros;
+
+    // through the global functions and the other overloads of the base
+    assert(CGAL::orientation(p, q, r, s) == o);
+    assert(CGAL::coplanar(p, q, r, s) == (o == CGAL::ZERO));
+  }
+  assert(zeros > 0);
+}
+
+// degenerate configurations of points with large coordinates on the grid: the interval
+// filter fails on them, and the predicates are decided with integers
+template <int G, int B>
+void test_large(int n)
+{
+  typedef CGAL::Epick_on_grid<G, B> K;
+  typedef typename K::Point_2 Point_2;
+  typedef typename K::Point_3 Point_3;
+  CGAL::Random rng(G * B);
+
+  // a random multiple of 2^-G of absolute value at most 2^(B-2)
+  auto random_coordinate = [&]() {
+    return std::ldexp(double(rng.get_int(-(1 << 30), 1 << 30)) * (1 << (G + B - 32))
+                      + rng.get_int(0, 1 << (G + B - 32)), -G);
+  };
+
+  for(int i=0; i<n; ++i)
+  {
+    const double cx = random_coordinate(), cy = random_coordinate(), cz = random_coordinate();
+    const double ux = random_coordinate() / 2, uy = random_coordinate() / 2, uz = random_coordinate() / 2;
+    const double vx = random_coordinate() / 2, vy = random_coordinate() / 2, vz = random_coordinate() / 2;
+    const double r = std::abs(random_coordinate());
+
+    // collinear and cocircular
+    const Point_2 a(cx, cy), b(cx + ux, cy + uy), c(cx - ux, cy - uy);
+    assert(K().orientation_2_object()(a, b, c) == CGAL::COLLINEAR);
+    assert(K().side_of_oriented_circle_2_object()(Point_2(cx + r, cy), Point_2(cx, cy + r),
+                                                  Point_2(cx - r, cy), Point_2(cx, cy - r))
+           == CGAL::ON_ORIENTED_BOUNDARY);
+
+    // coplanar and cospherical
+    const Point_3 p(cx, cy, cz), q(cx + ux, cy + uy, cz + uz), s(cx + vx, cy + vy, cz + vz),
+                  t(cx + ux - vx, cy + uy - vy, cz + uz - vz);
+    assert(K().orientation_3_object()(p, q, s, t) == CGAL::COPLANAR);
+    assert(K().side_of_oriented_sphere_3_object()(Point_3(cx + r, cy, cz), Point_3(cx, cy + r, cz),
+                                                  Point_3(cx, cy, cz + r), Point_3(cx - r, cy, cz),
+                                                  Point_3(cx, cy - r, cz))
+           == CGAL::ON_ORIENTED_BOUNDARY);
+  }
+}
+
+int main()
+{
+  assert(CGAL::Epick_on_grid<>::is_on_grid(0.5));
+  assert(CGAL::Epick_on_grid<>::is_on_grid(std::ldexp(3., -20)));
+  assert(!CGAL::Epick_on_grid<>::is_on_grid(std::ldexp(1., -21)));
+  assert(!CGAL::Epick_on_grid<>::is_on_grid(std::ldexp(1., 21)));
+  assert(CGAL::Epick_on_grid<>::is_on_grid(CGAL::Epick_on_grid<>::snap_to_grid(0.1)));
+
+  test<20, 20>(std::ldexp(1., -20), 1000, 0);       // 128 and 256 bits
+  test<20, 20>(std::ldexp(1., -20), 1000, 1e-30);   // not on the grid
+  test<0, 20>(1, 1000, 0);                          // 64 and 128 bits
+  test<30, 30>(std::ldexp(1., -30), 1000, 0);       // 192 and 320 bits
+  test<20, 20>(std::ldexp(1., -18), 1000, 0);
+
+  test_large<20, 20>(1000);
+  test_large<16, 24>(1000);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
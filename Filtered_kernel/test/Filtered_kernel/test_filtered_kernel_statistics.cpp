@@ -0,0 +1,106 @@
+#define CGAL_FILTERED_KERNEL_STATISTICS
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Filtered_kernel_statistics.h>
+
+#include <cassert>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Checks the counters of the filtered predicates and of the lazy constructions:
+// static filter calls, interval filter failures, exact evaluations, threads, and JSON output.
+
+typedef CGAL::Filtered_kernel_statistics Statistics;
+typedef CGAL::Epick::Point_3 Point_3;
+typedef CGAL::Epeck Epeck;
+
+const Statistics::Counters* find(const std::vector<Statistics::Counters>& counters,
+                                 Statistics::Kind kind, const std::string& name)
+{
+  for(const Statistics::Counters& c : counters)
+    if(c.kind == kind && c.name == name)
+      return &c;
+  return nullptr;
+}
+
+void orientations(int n)
+{
+  for(int i=0; i<n; ++i)
+  {
+    // certain for the static filter
+    assert(CGAL::orientation(Point_3(0,0,0), Point_3(1,0,0), Point_3(0,1,0), Point_3(0,0,1)) == CGAL::POSITIVE);
+    // coplanar, with rounding errors in the determinant: the static and the interval filters fail
+    const Point_3 p(1000000007, 2000000011, 3000000019);
+    const Point_3 u(123456789, 987654321, 555555557), v(314159265, 271828183, 141421357);
+    assert(CGAL::orientation(p, Point_3(p.x() + u.x(), p.y() + u.y(), p.z() + u.z()),
+                             Point_3(p.x() + v.x(), p.y() + v.y(), p.z() + v.z()),
+                             Point_3(p.x() + u.x() + v.x(), p.y() + u.y() + v.y(), p.z() + u.z() + v.z()))
+           == CGAL::COPLANAR);
+  }
+}
+
+int main()
+{
+  // disabled: nothing is counted
+  orientations(10);
+  assert(!Statistics::is_enabled());
+  assert(Statistics::counters().empty());
+
+  Statistics::enable();
+  orientations(10);
+  std::vector<Statistics::Counters> counters = Statistics::counters();
+  const Statistics::Counters* o = find(counters, Statistics::PREDICATE, "Orientation_3");
+  assert(o != nullptr);
+  assert(o->static_filter_calls == 20);
+  assert(o->interval_calls == 10);
+  assert(o->interval_failures == 10);
+  assert(o->exact_evaluations == 10);
+  std::uint64_t histogram_total = 0;
+  for(std::uint64_t h : o->exact_time_histogram)
+    histogram_total += h;
+  assert(histogram_total == 10);
+
+  // lazy constructions, evaluated exactly
+  {
+    const Epeck::Point_3 p(0.1, 0.2, 0.3), q(0.4, 0.5, 0.6);
+    const Epeck::Point_3 m = CGAL::midpoint(p, q);
+    const Epeck::Point_3 c = CGAL::midpoint(m, p);
+    c.exact();
+  }
+  counters = Statistics::counters();
+  const Statistics::Counters* mid = find(counters, Statistics::CONSTRUCTION, "Construct_midpoint_3");
+  assert(mid != nullptr);
+  assert(mid->interval_calls == 2 && mid->interval_failures == 0);
+  assert(mid->exact_evaluations == 2);
+
+  // the counters of the threads, including those that have exited
+  Statistics::reset();
+  assert(Statistics::counters().empty());
+  std::vector<std::thread> threads;
+  for(int k=0; k<4; ++k)
+    threads.emplace_back([]() { orientations(5); });
+  for(std::thread& t : threads)
+    t.join();
+  orientations(5);
+  counters = Statistics::counters();
+  o = find(counters, Statistics::PREDICATE, "Orientation_3");
+  assert(o != nullptr && o->static_filter_calls == 50 && o->exact_evaluations == 25);
+
+  std::ostringstream json;
+  Statistics::write_json(json);
+  std::cout << json.str();
+  assert(json.str().find("\"predicates\"") != std::string::npos);
+  assert(json.str().find("\"Orientation_3\": { \"static_filter_calls\": 50, \"interval_calls\": 25") != std::string::npos);
+
+  Statistics::disable();
+  orientations(10);
+  counters = Statistics::counters();
+  assert(find(counters, Statistics::PREDICATE, "Orientation_3")->static_filter_calls == 50);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
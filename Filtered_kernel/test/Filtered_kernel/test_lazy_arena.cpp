@@ -0,0 +1,144 @@
+#define CGAL_LAZY_USE_ARENA
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Lazy_arena.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Checks the allocation of the DAGs of Epeck in a `Lazy_arena`: objects and exact values
+// created in an arena, objects outliving their arena, nested arenas, and objects destroyed
+// by another thread.
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::FT FT;
+typedef K::Point_3 Point_3;
+typedef K::Plane_3 Plane_3;
+
+Point_3 random_point(CGAL::Random& rng)
+{
+  return Point_3(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+}
+
+// builds a DAG of constructions
+Point_3 construct(CGAL::Random& rng, int n)
+{
+  Point_3 c = CGAL::circumcenter(random_point(rng), random_point(rng), random_point(rng));
+  for(int i=0; i<n; ++i)
+    c = CGAL::midpoint(c, random_point(rng));
+  return c;
+}
+
+void test_epeck()
+{
+  CGAL::Random rng(0);
+  Point_3 c;
+  std::vector<Point_3> kept;
+  {
+    CGAL::Lazy_arena arena;
+    assert(CGAL::Lazy_arena::current_arena() == &arena);
+
+    for(int i=0; i<10; ++i)
+    {
+      const Point_3 p = construct(rng, 10);
+      assert(CGAL::collinear(p, p, p));
+      if(i % 3 == 0)
+        kept.push_back(p);
+    }
+    c = construct(rng, 100);
+    kept.front().exact(); // the DAG is pruned inside the arena
+
+    std::cout << arena.number_of_allocations() << " allocations, "
+              << arena.number_of_reuses() << " reuses, "
+              << arena.memory_size() << " bytes" << std::endl;
+    assert(arena.number_of_allocations() > 0);
+    assert(arena.number_of_reuses() > 0);
+    assert(arena.memory_size() > 0);
+  }
+  assert(CGAL::Lazy_arena::current_arena() == nullptr);
+
+  // the objects outlive their arena
+  const Point_3 d = CGAL::midpoint(c, kept.back());
+  assert(CGAL::compare_distance_to_point(d, c, kept.back()) == CGAL::EQUAL);
+  for(const Point_3& p : kept)
+    p.exact();
+}
+
+void test_nested()
+{
+  CGAL::Random rng(1);
+  CGAL::Lazy_arena outer;
+  const Point_3 p = construct(rng, 10);
+  Point_3 q;
+  {
+    CGAL::Lazy_arena inner(1024);
+    assert(CGAL::Lazy_arena::current_arena() == &inner);
+    q = CGAL::midpoint(p, construct(rng, 10));
+    assert(inner.number_of_allocations() > 0);
+  }
+  assert(CGAL::Lazy_arena::current_arena() == &outer);
+  assert(CGAL::compare_distance_to_point(q, p, q) != CGAL::SMALLER);
+  const Point_3 r = CGAL::midpoint(p, q);
+  assert(CGAL::collinear(p, q, r));
+}
+
+void test_other_thread()
+{
+  CGAL::Random rng(2);
+  std::vector<Point_3> points;
+  {
+    CGAL::Lazy_arena arena;
+    for(int i=0; i<100; ++i)
+      points.push_back(construct(rng, 2));
+  }
+  // the last references are released by another thread, with its own arena
+  std::thread t([&points]()
+  {
+    CGAL::Lazy_arena arena;
+    for(const Point_3& p : points)
+      assert(CGAL::compare_xyz(p, CGAL::midpoint(p, p)) == CGAL::EQUAL);
+    points.clear();
+  });
+  t.join();
+  assert(points.empty());
+}
+
+void test_lazy_exact_nt()
+{
+  CGAL::Lazy_arena arena;
+  FT s = 0;
+  for(int i=1; i<=20; ++i)
+    s += FT(1) / FT(i);
+  FT t = 0;
+  for(int i=20; i>=1; --i)
+    t += FT(1) / FT(i);
+  assert(s == t);
+  assert(CGAL::square(s) > s);
+  s.exact();
+}
+
+void test_static_rep()
+{
+  // the intersection of three planes uses a static rep built by placement new
+  CGAL::Lazy_arena arena;
+  const Plane_3 p(1, 0, 0, -1), q(0, 1, 0, -2), r(0, 0, 1, -3);
+  const auto res = CGAL::intersection(p, q, r);
+  assert(res);
+  const Point_3* i = std::get_if<Point_3>(&*res);
+  assert(i != nullptr && *i == Point_3(1, 2, 3));
+}
+
+int main()
+{
+  test_epeck();
+  test_nested();
+  test_other_thread();
+  test_lazy_exact_nt();
+  test_static_rep();
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,156 @@
+#define CGAL_HANDLE_BIASED_REFERENCE_COUNTING
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Handle.h>
+#include <CGAL/Random.h>
+
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// Checks the biased reference counting of `CGAL::Handle`: objects released by their owner,
+// by other threads, after the exit of their owner, and the DAGs of Epeck shared by threads.
+
+std::atomic<int> number_of_objects { 0 };
+
+struct Counted_rep : CGAL::Rep
+{
+  int value;
+  Counted_rep(int v) : value(v) { ++number_of_objects; }
+  ~Counted_rep() { --number_of_objects; }
+};
+
+struct Counted : CGAL::Handle
+{
+  Counted(int v) { PTR = new Counted_rep(v); }
+  int value() const { return static_cast<const Counted_rep*>(PTR)->value; }
+};
+
+// makes the current thread merge the objects queued to it
+void process_queue()
+{
+  Counted c(0);
+}
+
+void test_handles()
+{
+  // released by the owner
+  {
+    Counted a(1);
+    Counted b = a, c = b;
+    assert(a.refs() == 3 && c.value() == 1);
+  }
+  assert(number_of_objects == 0);
+
+  // last reference released by another thread, after the owner released its own ones
+  {
+    std::vector<Counted> v(100, Counted(2));
+    std::vector<Counted> w;
+    std::thread t([&v, &w]() { w = v; });
+    t.join();
+    v.clear();
+    assert(number_of_objects == 1);
+    std::thread u([&w]() { w.clear(); });
+    u.join();
+  }
+  assert(number_of_objects == 0);
+
+  // references of the owner released by another thread: the object is queued to the owner
+  {
+    std::vector<Counted> v;
+    for(int i=0; i<100; ++i)
+      v.push_back(Counted(i));
+    std::thread t([&v]() { v.clear(); });
+    t.join();
+    assert(number_of_objects == 100);
+    process_queue();
+    assert(number_of_objects == 0);
+  }
+
+  // objects created by a thread that has exited
+  {
+    std::vector<Counted> v;
+    std::thread t([&v]() {
+      for(int i=0; i<100; ++i)
+        v.push_back(Counted(i));
+      Counted c = v[0];
+    });
+    t.join();
+    assert(number_of_objects == 100 && v[50].value() == 50);
+    Counted c = v[0];
+    v.clear();
+    assert(number_of_objects == 1);
+  }
+  assert(number_of_objects == 0);
+
+  // objects copied and released concurrently by several threads
+  {
+    std::vector<Counted> v;
+    for(int i=0; i<1000; ++i)
+      v.push_back(Counted(i));
+    std::vector<std::thread> threads;
+    for(int k=0; k<4; ++k)
+      threads.emplace_back([&v, k]() {
+        for(int r=0; r<100; ++r)
+        {
+          std::vector<Counted> w;
+          for(std::size_t i=k; i<v.size(); i+=4)
+            w.push_back(v[i]);
+          std::vector<Counted> x = w;
+        }
+      });
+    for(std::thread& t : threads)
+      t.join();
+    v.clear();
+    process_queue();
+  }
+  assert(number_of_objects == 0);
+}
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+
+// constructions on shared points, evaluated exactly by several threads
+void test_epeck()
+{
+  CGAL::Random rng(0);
+  std::vector<Point_3> points;
+  for(int i=0; i<1000; ++i)
+    points.emplace_back(rng.get_double(-1, 1), rng.get_double(-1, 1), rng.get_double(-1, 1));
+  std::vector<Point_3> midpoints;
+  for(int i=0; i+1<1000; ++i)
+    midpoints.push_back(CGAL::midpoint(points[i], points[i+1]));
+
+  std::vector<std::vector<Point_3> > results(4);
+  std::vector<std::thread> threads;
+  for(int k=0; k<4; ++k)
+    threads.emplace_back([&, k]() {
+      for(std::size_t i=0; i+1<midpoints.size(); ++i)
+      {
+        const Point_3 c = CGAL::midpoint(midpoints[i], midpoints[i+1]);
+        if(i % 4 == std::size_t(k))
+          c.exact();
+        results[k].push_back(c);
+      }
+    });
+  for(std::thread& t : threads)
+    t.join();
+
+  for(std::size_t i=0; i<results[0].size(); ++i)
+    for(int k=1; k<4; ++k)
+      assert(results[k][i] == results[0][i]);
+  midpoints.clear();
+  points.clear();
+  results.clear();
+}
+
+int main()
+{
+  test_handles();
+  test_epeck();
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,77 @@
+#define CGAL_LAZY_ITERATIVE_EXACT
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+// Checks the iterative evaluation of the exact values of Epeck: on DAGs too deep
+// for a recursive evaluation, on DAGs with shared nodes, and its statistics.
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::FT FT;
+typedef K::Point_3 Point_3;
+
+void test_deep_dag()
+{
+  const int n = 200000;
+  FT s = 0;
+  for(int i=0; i<n; ++i)
+    s = s + 1;
+
+  const CGAL::Lazy_exact_evaluation_statistics before = CGAL::lazy_exact_evaluation_statistics();
+  assert(s.exact() == n);
+  const CGAL::Lazy_exact_evaluation_statistics& after = CGAL::lazy_exact_evaluation_statistics();
+  std::cout << after.number_of_exact_evaluations - before.number_of_exact_evaluations
+            << " exact evaluations, max depth " << after.max_depth << std::endl;
+  assert(after.number_of_iterative_evaluations == before.number_of_iterative_evaluations + 1);
+  assert(after.number_of_exact_evaluations >= before.number_of_exact_evaluations + n);
+  assert(after.max_depth >= std::size_t(n));
+}
+
+void test_shared_nodes()
+{
+  // each node is used twice by its parent: the DAG has 2 * n nodes, but 2^n paths
+  const FT seven = FT(7);
+  FT x = seven;
+  for(int i=0; i<100; ++i)
+    x = (x + x) - x;
+  const CGAL::Lazy_exact_evaluation_statistics before = CGAL::lazy_exact_evaluation_statistics();
+  assert(x == seven);
+  const CGAL::Lazy_exact_evaluation_statistics& after = CGAL::lazy_exact_evaluation_statistics();
+  assert(after.number_of_exact_evaluations - before.number_of_exact_evaluations <= 2 * 100 + 3);
+}
+
+void test_constructions()
+{
+  CGAL::Random rng(0);
+  const Point_3 o(0, 0, 0);
+  std::vector<Point_3> points;
+  Point_3 p(rng.get_double(), rng.get_double(), rng.get_double());
+  for(int i=0; i<1000; ++i)
+  {
+    const Point_3 q(rng.get_double(), rng.get_double(), rng.get_double());
+    p = CGAL::midpoint(p, q);
+    points.push_back(p);
+  }
+  // the points are exactly on their segments, which is only decided by the exact evaluation
+  for(std::size_t i=1; i<points.size(); i+=100)
+  {
+    const Point_3 m = CGAL::midpoint(points[i-1], points[i]);
+    assert(CGAL::collinear(points[i-1], m, points[i]));
+    assert(CGAL::exact_iteratively(m) == CGAL::midpoint(points[i-1].exact(), points[i].exact()));
+  }
+  assert(CGAL::lazy_exact_evaluation_statistics().max_depth > 0);
+}
+
+int main()
+{
+  test_deep_dag();
+  test_shared_nodes();
+  test_constructions();
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
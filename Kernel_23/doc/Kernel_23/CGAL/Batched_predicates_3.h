@@ -0,0 +1,100 @@
+namespace CGAL {
+
+/*!
+\ingroup kernel_classes
+
+The coordinates of points stored as a structure of arrays: the `i`-th point
+has the coordinates `(x[i], y[i], z[i])`. It is the input of the batched predicates.
+
+\sa `CGAL::Batched_orientation_3<K>`
+\sa `CGAL::Batched_side_of_oriented_sphere_3<K>`
+\sa `CGAL::Batched_compare_distance_3<K>`
+*/
+struct Coordinate_arrays_3
+{
+  /// The array of the \f$ x\f$-coordinates.
+  const double* x;
+  /// The array of the \f$ y\f$-coordinates.
+  const double* y;
+  /// The array of the \f$ z\f$-coordinates.
+  const double* z;
+};
+
+/*!
+\ingroup kernel_classes
+
+A function object evaluating the orientation predicate of the kernel `K`
+on many quadruples of points at once.
+
+The semi-static filter of the predicate is evaluated on several quadruples
+simultaneously using AVX or AVX-512 instructions, when the code is compiled with
+them (for example with the `-march=native` option of g++ and clang). The quadruples
+for which the filter cannot certify the result are then evaluated by `K::Orientation_3`.
+
+\tparam K a kernel with `double` coordinates, such as `CGAL::Exact_predicates_inexact_constructions_kernel`,
+which is the default.
+*/
+template <typename K>
+class Batched_orientation_3
+{
+public:
+  /*!
+  writes in `result[i]` the orientation of the `i`-th points of `p`, `q`, `r`, and `s`,
+  for `i` in `[0, n)`, and returns the number of quadruples that were not decided by the static filter.
+  */
+  std::size_t operator()(std::size_t n,
+                         const Coordinate_arrays_3& p, const Coordinate_arrays_3& q,
+                         const Coordinate_arrays_3& r, const Coordinate_arrays_3& s,
+                         Orientation* result) const;
+};
+
+/*!
+\ingroup kernel_classes
+
+A function object evaluating the predicate `K::Side_of_oriented_sphere_3`
+on many quintuples of points at once, like `CGAL::Batched_orientation_3<K>`.
+
+\tparam K a kernel with `double` coordinates, such as `CGAL::Exact_predicates_inexact_constructions_kernel`,
+which is the default.
+*/
+template <typename K>
+class Batched_side_of_oriented_sphere_3
+{
+public:
+  /*!
+  writes in `result[i]` the side of the `i`-th point of `t` with respect to the oriented sphere
+  through the `i`-th points of `p`, `q`, `r`, and `s`, for `i` in `[0, n)`, and returns
+  the number of quintuples that were not decided by the static filter.
+  */
+  std::size_t operator()(std::size_t n,
+                         const Coordinate_arrays_3& p, const Coordinate_arrays_3& q,
+                         const Coordinate_arrays_3& r, const Coordinate_arrays_3& s,
+                         const Coordinate_arrays_3& t,
+                         Oriented_side* result) const;
+};
+
+/*!
+\ingroup kernel_classes
+
+A function object evaluating the predicate `K::Compare_distance_3`
+on many triples of points at once, like `CGAL::Batched_orientation_3<K>`.
+
+\tparam K a kernel with `double` coordinates, such as `CGAL::Exact_predicates_inexact_constructions_kernel`,
+which is the default.
+*/
+template <typename K>
+class Batched_compare_distance_3
+{
+public:
+  /*!
+  writes in `result[i]` the comparison of the distance of the `i`-th points of `p` and `q`
+  with the distance of the `i`-th points of `p` and `r`, for `i` in `[0, n)`, and returns
+  the number of triples that were not decided by the static filter.
+  */
+  std::size_t operator()(std::size_t n,
+                         const Coordinate_arrays_3& p, const Coordinate_arrays_3& q,
+                         const Coordinate_arrays_3& r,
+                         Comparison_result* result) const;
+};
+
+} /* end namespace CGAL */
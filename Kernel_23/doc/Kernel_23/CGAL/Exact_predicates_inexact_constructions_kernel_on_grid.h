@@ -0,0 +1,55 @@
+
+namespace CGAL {
+
+/*!
+\ingroup kernel_predef
+
+A kernel that is the same as `CGAL::Exact_predicates_inexact_constructions_kernel`,
+except for the evaluation of the predicates `Orientation_2`, `Orientation_3`,
+`Side_of_oriented_circle_2`, and `Side_of_oriented_sphere_3`, when both the static
+and the interval filters fail.
+
+If all the coordinates of their arguments are on the grid, that is, are multiples of
+\f$ 2^{-GridExponent}\f$ of absolute value at most \f$ 2^{BoundExponent}\f$,
+these predicates are computed exactly with fixed size integers (64 or 128 bit
+integers, or the fixed size integers of \boost Multiprecision), instead of the exact number type.
+This is faster on degenerate inputs, and does not need \gmp. The coordinates are checked
+at each evaluation, and the predicates fall back to the exact number type on the other inputs.
+
+Defining the macro `CGAL_GRID_PREDICATES_VERIFY` compares each result computed with integers
+with the one of the exact number type, and raises an error if they differ.
+
+\tparam GridExponent the exponent of the step of the grid, `20` by default.
+\tparam BoundExponent the exponent of the bound of the coordinates, `20` by default.
+`GridExponent + BoundExponent` must be at most `61`.
+
+\cgalModels{Kernel}
+
+\sa `CGAL::Exact_predicates_inexact_constructions_kernel`
+
+*/
+template <int GridExponent = 20, int BoundExponent = 20>
+class Epick_on_grid {
+public:
+
+/*!
+returns whether `x` is a multiple of \f$ 2^{-GridExponent}\f$ of absolute value at most \f$ 2^{BoundExponent}\f$.
+*/
+static bool is_on_grid(double x);
+
+/*!
+returns the multiple of \f$ 2^{-GridExponent}\f$ closest to `x`.
+*/
+static double snap_to_grid(double x);
+
+}; /* end Epick_on_grid */
+
+/*!
+\ingroup kernel_predef
+
+An alias of `CGAL::Epick_on_grid`.
+*/
+template <int GridExponent = 20, int BoundExponent = 20>
+using Exact_predicates_inexact_constructions_kernel_on_grid = Epick_on_grid<GridExponent, BoundExponent>;
+
+} /* end namespace CGAL */
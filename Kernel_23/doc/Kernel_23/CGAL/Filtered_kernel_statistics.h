@@ -0,0 +1,82 @@
+namespace CGAL {
+
+/*!
+\ingroup kernel_classes
+
+Statistics of the filtered predicates and of the lazy constructions of the kernels
+with filtered predicates, such as `CGAL::Exact_predicates_inexact_constructions_kernel`
+and `CGAL::Exact_predicates_exact_constructions_kernel`.
+
+The counters are updated only if the macro `CGAL_FILTERED_KERNEL_STATISTICS` is defined
+before the inclusion of any \cgal header, and while the statistics are enabled.
+While they are disabled, the cost is a test per call of a predicate or of a construction.
+
+For each predicate, the counters give the number of calls of its static filter (if it has one),
+the number of calls of its interval filter, which is the number of failures of the static filter,
+the number of failures of the interval filter, and the number and the duration of
+its exact evaluations. For each lazy construction, they give the number of calls,
+the number of failures of the interval arithmetic, which lead to an immediate exact construction,
+and the number and the duration of the exact evaluations. The predicates and the constructions
+are identified by the name of their functor, for example `"Orientation_3"` or `"Construct_midpoint_3"`,
+and the counters of all the kernels are merged.
+
+Each thread updates its own counters, and the functions of this class return the sums of the
+counters of all the threads, including those that have exited.
+
+\cgalHeading{Example}
+
+\code
+CGAL::Filtered_kernel_statistics::reset();
+CGAL::Filtered_kernel_statistics::enable();
+CGAL::Delaunay_triangulation_3<CGAL::Epick> dt(points.begin(), points.end());
+CGAL::Filtered_kernel_statistics::disable();
+CGAL::Filtered_kernel_statistics::write_json(std::cout);
+\endcode
+*/
+class Filtered_kernel_statistics
+{
+public:
+  /// the kind of an operation
+  enum Kind { PREDICATE, CONSTRUCTION };
+
+  /// the number of buckets of the histograms of the durations of the exact evaluations
+  static constexpr std::size_t histogram_size = 32;
+
+  /// the counters of an operation
+  struct Counters
+  {
+    Kind kind;
+    /// the name of the functor, without namespace nor template arguments
+    std::string name;
+    std::uint64_t static_filter_calls;
+    std::uint64_t interval_calls;
+    std::uint64_t interval_failures;
+    std::uint64_t exact_evaluations;
+    /// the total duration of the exact evaluations, in nanoseconds
+    std::uint64_t exact_time;
+    /// the bucket `i` counts the exact evaluations that took between \f$ 2^i\f$ and \f$ 2^{i+1}\f$ nanoseconds.
+    /// The exact evaluation of a lazy object does not include the exact evaluation of its arguments.
+    std::array<std::uint64_t, histogram_size> exact_time_histogram;
+  };
+
+  /// enables (or disables if `b` is `false`) the update of the counters in all the threads.
+  static void enable(bool b = true);
+
+  /// disables the update of the counters in all the threads.
+  static void disable();
+
+  /// returns whether the counters are updated.
+  static bool is_enabled();
+
+  /// sets all the counters to zero. Updates of the counters by other threads at the same time may be lost.
+  static void reset();
+
+  /// returns the counters of the operations that were called since the last reset.
+  static std::vector<Counters> counters();
+
+  /// writes the counters in JSON, as an object with the members `"predicates"` and `"constructions"`,
+  /// which map the names of the operations to their counters.
+  static void write_json(std::ostream& os);
+};
+
+} /* end namespace CGAL */
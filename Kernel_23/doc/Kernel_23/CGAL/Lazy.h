@@ -0,0 +1,52 @@
+namespace CGAL {
+
+/*!
+\ingroup kernel_classes
+
+Statistics of the computations of exact values by the lazy kernels, such as
+`CGAL::Exact_predicates_exact_constructions_kernel`, and by `CGAL::Lazy_exact_nt`,
+in a thread. They are returned by `CGAL::lazy_exact_evaluation_statistics()`.
+
+\sa `CGAL::exact_iteratively()`
+*/
+struct Lazy_exact_evaluation_statistics
+{
+  /// the number of nodes of the DAGs whose exact value has been computed.
+  std::size_t number_of_exact_evaluations;
+  /// the number of iterative evaluations of DAGs that computed some exact values.
+  std::size_t number_of_iterative_evaluations;
+  /// the maximal depth of the DAGs evaluated iteratively, that is the depth of
+  /// the recursion that their recursive evaluation would have needed.
+  std::size_t max_depth;
+};
+
+/*!
+\ingroup kernel_classes
+
+returns the statistics of the exact evaluations of the calling thread. They can be reset
+by assigning a default constructed `Lazy_exact_evaluation_statistics` to the result.
+*/
+Lazy_exact_evaluation_statistics& lazy_exact_evaluation_statistics();
+
+/*!
+\ingroup kernel_classes
+
+returns the exact value of the lazy object `x`, an object of a lazy kernel
+or a `CGAL::Lazy_exact_nt`, like `x.exact()`.
+
+By default, the exact value of a lazy object is computed recursively from the exact
+values of the objects it was constructed from, which may overflow the stack for
+objects built by long sequences of constructions. This function instead sorts
+the nodes of the DAG of `x` whose exact value is unknown in topological order,
+and computes their exact values one after the other, each node releasing its
+children once its exact value is known.
+
+The DAGs are always evaluated this way if the macro `CGAL_LAZY_ITERATIVE_EXACT` is
+defined. When several threads are running, the evaluation is recursive.
+
+\sa `CGAL::lazy_exact_evaluation_statistics()`
+*/
+template <typename Lazy_object>
+const typename Lazy_object::Exact_type& exact_iteratively(const Lazy_object& x);
+
+} /* end namespace CGAL */
@@ -0,0 +1,66 @@
+namespace CGAL {
+
+/*!
+\ingroup kernel_classes
+
+A scope in which the nodes of the DAGs of the lazy kernels, such as
+`CGAL::Exact_predicates_exact_constructions_kernel`, and of `CGAL::Lazy_exact_nt`,
+as well as their exact values, are allocated in large blocks of memory
+instead of being allocated one by one on the heap.
+
+The arena is used only if the macro `CGAL_LAZY_USE_ARENA` is defined before
+the inclusion of any \cgal header (it must then be defined in all the translation
+units of the program); otherwise this class has no effect.
+
+Creating a `Lazy_arena` makes it the current arena of the calling thread, until
+its destruction, after which the previously current arena, if any, is current again.
+Arenas must thus be destroyed in the reverse order of their creation, which is
+the case of local variables. Each thread has its own current arena, and the objects
+created by a thread while no arena is current are allocated on the heap.
+
+The memory of the objects destroyed in the scope of their arena is reused by
+the arena, and all the memory of the arena is released at once at the end of the scope.
+Objects can nevertheless outlive their arena and be destroyed by any thread:
+a block of memory is then released when its last object is destroyed.
+
+\cgalHeading{Example}
+
+\code
+std::vector<Point_3> result;
+{
+  CGAL::Lazy_arena arena;
+  // constructions whose intermediate DAG nodes are released with the arena
+  ...
+}
+\endcode
+*/
+class Lazy_arena
+{
+public:
+  /*!
+  creates an arena allocating memory by blocks of `block_size` bytes,
+  and makes it the current arena of the calling thread.
+  */
+  explicit Lazy_arena(std::size_t block_size = 1 << 16);
+
+  /*!
+  restores the previously current arena of the calling thread, and releases
+  the memory that is not used by objects that outlive the arena.
+  \pre `*this` is the current arena of the calling thread.
+  */
+  ~Lazy_arena();
+
+  /// returns the number of objects allocated in the arena.
+  std::size_t number_of_allocations() const;
+
+  /// returns the number of allocations that reused the memory of an object destroyed in the arena.
+  std::size_t number_of_reuses() const;
+
+  /// returns the size in bytes of the memory reserved by the arena.
+  std::size_t memory_size() const;
+
+  /// returns the current arena of the calling thread, or `nullptr` if there is none or if `CGAL_LAZY_USE_ARENA` is not defined.
+  static Lazy_arena* current_arena();
+};
+
+} /* end namespace CGAL */
@@ -29,13 +29,25 @@
 #include <CGAL/Cartesian_converter.h>
 #include <CGAL/Homogeneous_converter.h>
 
+#ifdef CGAL_EPICK_USE_STACK_MPZF
+#include <CGAL/Stack_mpzf.h>
+#include <type_traits>
+#endif
+
 namespace CGAL {
 
 template <class CK, class Rep = typename CK::Rep_tag /* (Cartesian_tag) */>
 struct Exact_kernel_selector
 {
   typedef typename internal::Exact_field_selector<typename CK::RT>::Type  Exact_nt;
+#ifdef CGAL_EPICK_USE_STACK_MPZF
+  // the predicates on doubles that do not need a field use Stack_mpzf
+  typedef std::conditional_t<std::is_same<typename CK::RT, double>::value,
+                             Stack_mpzf,
+                             typename internal::Exact_ring_selector<typename CK::RT>::Type> Exact_rt;
+#else
   typedef typename internal::Exact_ring_selector <typename CK::RT>::Type  Exact_rt;
+#endif
   typedef Simple_cartesian<Exact_nt>                                      Exact_kernel;
   typedef Simple_cartesian<Exact_rt>                                      Exact_kernel_rt;
 
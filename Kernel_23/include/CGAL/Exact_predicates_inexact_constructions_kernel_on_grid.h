@@ -0,0 +1,110 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_EXACT_PREDICATES_INEXACT_CONSTRUCTIONS_KERNEL_ON_GRID_H
+#define CGAL_EXACT_PREDICATES_INEXACT_CONSTRUCTIONS_KERNEL_ON_GRID_H
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Filtered_kernel/internal/Grid_predicates.h>
+
+#include <cmath>
+#include <type_traits>
+
+namespace CGAL {
+
+template <int GridExponent, int BoundExponent>
+class Epick_on_grid;
+
+namespace internal {
+
+  // Filtered_kernel_base, whose predicates evaluate exactly with integers the inputs
+  // on the grid on which the interval filter fails, instead of the exact number type
+  template <typename CK, int G, int B>
+  struct Filtered_kernel_base_on_grid
+    : public Filtered_kernel_base<CK>
+  {
+    typedef Filtered_kernel_base<CK> K_base;
+
+    template < typename Kernel2 >
+    struct Base {
+      typedef typename CK::template Base<Kernel2>::Type CK2;
+      typedef Filtered_kernel_base_on_grid<CK2, G, B>   Type;
+    };
+
+    typedef Grid_predicates::Orientation_2<K_base, G, B>             Orientation_2;
+    typedef Grid_predicates::Orientation_3<K_base, G, B>             Orientation_3;
+    typedef Grid_predicates::Side_of_oriented_circle_2<K_base, G, B> Side_of_oriented_circle_2;
+    typedef Grid_predicates::Side_of_oriented_sphere_3<K_base, G, B> Side_of_oriented_sphere_3;
+
+    Orientation_2 orientation_2_object() const { return Orientation_2(); }
+    Orientation_3 orientation_3_object() const { return Orientation_3(); }
+    Side_of_oriented_circle_2 side_of_oriented_circle_2_object() const { return Side_of_oriented_circle_2(); }
+    Side_of_oriented_sphere_3 side_of_oriented_sphere_3_object() const { return Side_of_oriented_sphere_3(); }
+  };
+
+  template <typename CK, int G, int B>
+  struct Static_filters_base_on_grid
+    : public Static_filters< Filtered_kernel_base_on_grid<CK, G, B> >
+  {
+    template < typename Kernel2 >
+    struct Base {
+      typedef typename CK::template Base<Kernel2>::Type CK2;
+      typedef Static_filters_base_on_grid<CK2, G, B>    Type;
+    };
+  };
+
+  template <int G, int B>
+  using Epick_on_grid_base =
+      std::conditional_t<epick_use_static_filter,
+                         Static_filters_base_on_grid<Epick_base_with_type_equality<double, Epick_on_grid<G, B> >, G, B>,
+                         Filtered_kernel_base_on_grid<Epick_base_with_type_equality<double, Epick_on_grid<G, B> >, G, B> >;
+
+} // namespace internal
+
+// Epick, whose predicates `Orientation_2`, `Orientation_3`, `Side_of_oriented_circle_2`,
+// and `Side_of_oriented_sphere_3` are computed exactly with fixed size integers, instead
+// of the exact number type, when the static and interval filters fail and the coordinates of their
+// arguments are multiples of 2^-GridExponent of absolute value at most 2^BoundExponent.
+template <int GridExponent = 20, int BoundExponent = 20>
+class Epick_on_grid
+  : public internal::Epick_on_grid_base<GridExponent, BoundExponent>
+{
+  typedef internal::Grid_predicates::Grid<GridExponent, BoundExponent> Grid;
+
+public:
+  enum { Has_static_filters = epick_use_static_filter };
+
+  // returns whether `x` is a multiple of 2^-GridExponent of absolute value at most 2^BoundExponent
+  static bool is_on_grid(double x)
+  {
+    long long i;
+    return Grid::to_integers({ x }, &i);
+  }
+
+  // returns the closest multiple of 2^-GridExponent to `x`
+  static double snap_to_grid(double x)
+  {
+    return std::ldexp(std::nearbyint(std::ldexp(x, GridExponent)), -GridExponent);
+  }
+};
+
+template <int GridExponent = 20, int BoundExponent = 20>
+using Exact_predicates_inexact_constructions_kernel_on_grid = Epick_on_grid<GridExponent, BoundExponent>;
+
+template <int GridExponent, int BoundExponent>
+struct Triangulation_structural_filtering_traits<Epick_on_grid<GridExponent, BoundExponent> > {
+  using Use_structural_filtering_tag = Tag_true;
+};
+
+} //namespace CGAL
+
+#endif // CGAL_EXACT_PREDICATES_INEXACT_CONSTRUCTIONS_KERNEL_ON_GRID_H
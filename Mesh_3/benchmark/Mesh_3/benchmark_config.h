@@ -74,7 +74,7 @@ const double DEFAULT_CELL_RADIUS_RATIO  = 3;    // cannot be relative
 #  pragma message(" : Warning: CGAL_LINKED_WITH_TBB not defined: EVERYTHING WILL BE SEQUENTIAL.")
 # endif
 
-// # define BENCHMARK_WITH_1_TO_MAX_THREADS
+// # define BENCHMARK_WITH_1_TO_MAX_THREADS // 1, 2, 4, ... threads, up to the maximum
 
 // # define CGAL_MESH_3_USE_LAZY_SORTED_REFINEMENT_QUEUE // default behavior
 // # define CGAL_MESH_3_USE_LAZY_UNSORTED_REFINEMENT_QUEUE
@@ -16,6 +16,7 @@ std::string XML_perf_data::default_filename;
 #include <CGAL/Mesh_domain_with_polyline_features_3.h>
 #include <CGAL/make_mesh_3.h>
 #include <CGAL/refine_mesh_3.h>
+#include <CGAL/Mesh_3/Mesh_statistics.h>
 
 #include <CGAL/boost/graph/IO/polygon_mesh_io.h>
 #include <CGAL/Polygon_mesh_processing/self_intersections.h>
@@ -162,6 +163,7 @@ Exit_code make_mesh(const Domain& domain,
   CGAL::Real_timer t;
   t.start();
 
+  CGAL::Mesh_3::Mesh_statistics stats;
   C3t3 c3t3 = CGAL::make_mesh_3<C3t3>(domain
                                    , criteria
 # ifdef CGAL_MESH_3_BENCHMARK_LLOYD
@@ -191,9 +193,18 @@ Exit_code make_mesh(const Domain& domain,
 #else
                                    , non_manifold()
 #endif
+                                   , statistics = &stats
                                     );
   t.stop();
 
+  // contention of the parallel refinement
+  CGAL_MESH_3_SET_PERFORMANCE_DATA("Lock_conflicts",
+                                   stats.facet_refinement.number_of_lock_conflicts
+                                     + stats.cell_refinement.number_of_lock_conflicts);
+  CGAL_MESH_3_SET_PERFORMANCE_DATA("Rollbacks",
+                                   stats.facet_refinement.number_of_rollbacks
+                                     + stats.cell_refinement.number_of_rollbacks);
+
   CGAL_MESH_3_SET_PERFORMANCE_DATA("V", c3t3.triangulation().number_of_vertices());
   CGAL_MESH_3_SET_PERFORMANCE_DATA("F", c3t3.number_of_facets_in_complex());
   CGAL_MESH_3_SET_PERFORMANCE_DATA("C", c3t3.number_of_cells_in_complex());
@@ -567,7 +578,10 @@ int main(int argc, char** argv)
 
 #ifdef CGAL_CONCURRENT_MESH_3
  #ifdef BENCHMARK_WITH_1_TO_MAX_THREADS
-  for(int num_threads=1; num_threads<=max_nb_threads; ++num_threads)
+  // scaling curve: 1, 2, 4, ... threads, and finally `max_nb_threads`
+  for(int num_threads=1; num_threads<=max_nb_threads;
+      num_threads = (num_threads < max_nb_threads && 2*num_threads > max_nb_threads)
+                      ? max_nb_threads : 2*num_threads)
  #else
   int num_threads = max_nb_threads;
  #endif // BENCHMARK_WITH_1_TO_MAX_THREADS
@@ -71,6 +71,8 @@ protected:
     subelements.push_back("Lock_radius");
     subelements.push_back("Statgrid_size");
     subelements.push_back("Num_work_items_per_batch");
+    subelements.push_back("Lock_conflicts");
+    subelements.push_back("Rollbacks");
 
     subelements.push_back("V");
     subelements.push_back("F");
@@ -0,0 +1,43 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgMesh3Domains
+
+The class `Sparse_image_3` stores a 3D image, with the same conventions as `Image_3`,
+in cubic bricks of `brick_size`^3 voxels. The bricks whose voxels all have the same
+value only store that value, which makes it suitable for large segmented images
+that mostly consist of background.
+
+A domain can be created from a labeled sparse image with
+`Labeled_mesh_domain_3::create_labeled_image_mesh_domain()`.
+
+\tparam Word_type the type of the values of the voxels
+\tparam brick_size the size of the bricks, a power of two (default: 8)
+*/
+template <typename Word_type, std::size_t brick_size = 8>
+class Sparse_image_3 {
+public:
+
+  /// Copies `image`, whose voxels have type `Word_type`.
+  explicit Sparse_image_3(const Image_3& image);
+
+  /// Builds the image of dimensions `xdim` x `ydim` x `zdim`, of voxel size `(vx, vy, vz)`
+  /// and origin `(tx, ty, tz)`, whose voxel `(i, j, k)` has value `value(i, j, k)`.
+  /// The image is filled brick by brick, and never stored densely.
+  template <typename Function>
+  Sparse_image_3(std::size_t xdim, std::size_t ydim, std::size_t zdim,
+                 double vx, double vy, double vz,
+                 const Function& value,
+                 double tx = 0, double ty = 0, double tz = 0);
+
+  /// Returns the value of the voxel `(i, j, k)`.
+  Word_type value(std::size_t i, std::size_t j, std::size_t k) const;
+
+  /// Returns the number of bricks whose voxels are stored.
+  std::size_t number_of_stored_bricks() const;
+
+  /// Returns the number of bytes used to store the image.
+  std::size_t memory_size() const;
+
+};
+} /* end namespace CGAL */
@@ -40,6 +40,9 @@
 #include <CGAL/Image_3.h>
 #include <CGAL/Mesh_3/Image_to_labeled_function_wrapper.h>
 #include <CGAL/Mesh_3/Image_plus_weights_to_labeled_function_wrapper.h>
+// support for `CGAL::Sparse_image_3`
+#include <CGAL/Sparse_image_3.h>
+#include <CGAL/Mesh_3/Sparse_image_to_labeled_function_wrapper.h>
 
 // support for implicit functions
 #include <CGAL/Implicit_to_labeling_function_wrapper.h>
@@ -87,6 +90,16 @@ namespace internal {
                   double(im.zdim())*im.vz()+im.tz()+1);
   }
 
+  // Returns a box enclosing the sparse image `im`
+  template <typename Word_type, std::size_t brick_size>
+  Bbox_3 compute_bounding_box(const Sparse_image_3<Word_type, brick_size>& im)
+  {
+    return Bbox_3(-1+im.tx(),-1+im.ty(),-1+im.tz(),
+                  double(im.xdim())*im.vx()+im.tx()+1,
+                  double(im.ydim())*im.vy()+im.ty()+1,
+                  double(im.zdim())*im.vz()+im.tz()+1);
+  }
+
   template <typename Image_values_to_subdom_indices>
   struct Create_gray_image_values_to_subdomain_indices {
     typedef Image_values_to_subdom_indices type;
@@ -775,6 +788,54 @@ public:
 
     return domain;
   }
+
+  /*!
+   * \brief Construction from a 3D labeled image stored in bricks
+   *
+   * Same as above, for an image stored in a `Sparse_image_3`, whose uniform
+   * bricks are not stored. The labeling function keeps, for each thread,
+   * a cache of the bricks of the image it accessed recently.
+   *
+   * \tparam Word_type the word type of the image
+   * \tparam brick_size the size of the bricks of the image
+   * \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+   * \param image_ the input 3D image. It must be kept alive as long as the domain is used.
+   * \param np an optional sequence of \ref bgl_namedparameters "Named Parameters"
+   *   among `value_outside` and `relative_error_bound` (see above).
+   */
+  template<typename Word_type, std::size_t brick_size, typename CGAL_NP_TEMPLATE_PARAMETERS>
+  static Labeled_mesh_domain_3
+  create_labeled_image_mesh_domain(const CGAL::Sparse_image_3<Word_type, brick_size>& image_,
+                                   const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    using parameters::get_parameter;
+    using parameters::choose_parameter;
+
+    auto value_outside_ = choose_parameter(get_parameter(np, internal_np::voxel_value), 0);
+    FT relative_error_bound_ = choose_parameter(get_parameter(np, internal_np::error_bound), FT(1e-3));
+    auto image_values_to_subdomain_indices_ = choose_parameter(get_parameter(np, internal_np::image_subdomain_index), Null_functor());
+    CGAL::Random* p_rng_ = choose_parameter(get_parameter(np, internal_np::rng), nullptr);
+    auto null_subdomain_index_ = choose_parameter(get_parameter(np, internal_np::null_subdomain_index_param), Null_functor());
+    auto construct_surface_patch_index_ = choose_parameter(get_parameter(np, internal_np::surface_patch_index), Null_functor());
+
+    static_assert(parameters::is_default_parameter<CGAL_NP_CLASS, internal_np::weights_param_t>::value &&
+                  parameters::is_default_parameter<CGAL_NP_CLASS, internal_np::features_detector_param_t>::value &&
+                  parameters::is_default_parameter<CGAL_NP_CLASS, internal_np::input_features_param_t>::value,
+                  "Weights and features are not supported with a sparse image");
+
+    namespace p = CGAL::parameters;
+    return Labeled_mesh_domain_3
+      (p::function = create_sparse_labeled_image_wrapper(image_,
+                                                         image_values_to_subdomain_indices_,
+                                                         value_outside_),
+       p::bounding_object = Mesh_3::internal::compute_bounding_box(image_),
+       p::relative_error_bound = relative_error_bound_,
+       p::p_rng = p_rng_,
+       p::null_subdomain_index =
+               create_null_subdomain_index(null_subdomain_index_),
+       p::construct_surface_patch_index =
+               create_construct_surface_patch_index(construct_surface_patch_index_));
+  }
 /// @}
 
 #ifndef DOXYGEN_RUNNING
@@ -862,6 +923,19 @@ public:
   {
     return create_labeled_image_mesh_domain(internal_np::combine_named_parameters(np1, np2, nps...));
   }
+  // Overload handling parameters passed with operator=
+  template<typename Word_type, std::size_t brick_size,
+           typename CGAL_NP_TEMPLATE_PARAMETERS_NO_DEFAULT_1,
+           typename CGAL_NP_TEMPLATE_PARAMETERS_NO_DEFAULT_2,
+           typename ... NP>
+  static Labeled_mesh_domain_3
+  create_labeled_image_mesh_domain(const CGAL::Sparse_image_3<Word_type, brick_size>& image_,
+                                   const CGAL_NP_CLASS_1& np1,
+                                   const CGAL_NP_CLASS_2& np2,
+                                   const NP& ... nps)
+  {
+    return create_labeled_image_mesh_domain(image_, internal_np::combine_named_parameters(np1, np2, nps...));
+  }
 #endif
 
 /// \name Creation of domains from implicit functions
@@ -1441,6 +1515,29 @@ protected:
     return Function();
   }
 
+  template <typename Word_type, std::size_t brick_size,
+            typename FT, typename Functor>
+  static
+  Function
+  create_sparse_labeled_image_wrapper(const CGAL::Sparse_image_3<Word_type, brick_size>& image,
+                                      const Functor& image_values_to_subdomain_indices,
+                                      const FT& value_outside)
+  {
+    using Mesh_3::internal::Create_labeled_image_values_to_subdomain_indices;
+    typedef Create_labeled_image_values_to_subdomain_indices<Functor> C_i_v_t_s_i;
+    typedef typename C_i_v_t_s_i::type Image_values_to_subdomain_indices;
+    Image_values_to_subdomain_indices transform_fct =
+      C_i_v_t_s_i()(image_values_to_subdomain_indices);
+
+    typedef Mesh_3::Sparse_image_to_labeled_function_wrapper<
+      CGAL::Sparse_image_3<Word_type, brick_size>,
+      int,
+      Subdomain_index> Wrapper;
+    return Wrapper(image,
+                   transform_fct,
+                   transform_fct(value_outside));
+  }
+
   template <typename FT, typename Functor>
   static
   Function
@@ -27,6 +27,9 @@
 
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <CGAL/use.h>
 
 // class Concurrent_mesher_config
@@ -37,7 +40,10 @@ class Concurrent_mesher_config
   Concurrent_mesher_config()
   : num_threads(-1),
     locking_grid_num_cells_per_axis(50),
+    max_locking_grid_num_cells_per_axis(128),
+    num_vertices_per_locking_grid_cell(1.f),
     first_grid_lock_radius(0),
+    num_lock_attempts_before_deferral(8),
     work_stats_grid_num_cells_per_axis(5),
     num_work_items_per_batch(50),
     refinement_grainsize(10),
@@ -67,7 +73,10 @@ public:
   // From config file (or default)
   int     num_threads;
   int     locking_grid_num_cells_per_axis;
+  int     max_locking_grid_num_cells_per_axis;
+  float   num_vertices_per_locking_grid_cell;
   int     first_grid_lock_radius;
+  int     num_lock_attempts_before_deferral;
   int     work_stats_grid_num_cells_per_axis;
   int     num_work_items_per_batch;
   int     refinement_grainsize;
@@ -78,6 +87,21 @@ public:
 
   // Others
 
+  // Number of cells per axis of the locking grid, for a triangulation with
+  // `number_of_vertices` vertices: the grid is refined as the mesh gets denser,
+  // so that the threads refining distinct regions do not lock the same cells,
+  // from `locking_grid_num_cells_per_axis` up to `max_locking_grid_num_cells_per_axis`.
+  int locking_grid_num_cells_per_axis_for(std::size_t number_of_vertices) const
+  {
+    if (max_locking_grid_num_cells_per_axis <= locking_grid_num_cells_per_axis
+        || num_vertices_per_locking_grid_cell <= 0.f)
+      return locking_grid_num_cells_per_axis;
+
+    const int n = static_cast<int>(std::cbrt(
+      static_cast<double>(number_of_vertices) / num_vertices_per_locking_grid_cell));
+    return (std::min)(max_locking_grid_num_cells_per_axis,
+                      (std::max)(locking_grid_num_cells_per_axis, n));
+  }
 
   //================================================
 
@@ -107,7 +131,10 @@ protected:
       desc.add_options()
         ("num_threads", po::value<int>(), "")
         ("locking_grid_num_cells_per_axis", po::value<int>(), "")
+        ("max_locking_grid_num_cells_per_axis", po::value<int>(), "")
+        ("num_vertices_per_locking_grid_cell", po::value<float>(), "")
         ("first_grid_lock_radius", po::value<int>(), "")
+        ("num_lock_attempts_before_deferral", po::value<int>(), "")
         ("work_stats_grid_num_cells_per_axis", po::value<int>(), "")
         ("num_work_items_per_batch", po::value<int>(), "")
         ("refinement_grainsize", po::value<int>(), "")
@@ -131,8 +158,14 @@ protected:
       get_config_file_option_value<int>("num_threads");
     locking_grid_num_cells_per_axis =
       get_config_file_option_value<int>("locking_grid_num_cells_per_axis");
+    max_locking_grid_num_cells_per_axis =
+      get_config_file_option_value<int>("max_locking_grid_num_cells_per_axis");
+    num_vertices_per_locking_grid_cell =
+      get_config_file_option_value<float>("num_vertices_per_locking_grid_cell");
     first_grid_lock_radius =
       get_config_file_option_value<int>("first_grid_lock_radius");
+    num_lock_attempts_before_deferral =
+      get_config_file_option_value<int>("num_lock_attempts_before_deferral");
     work_stats_grid_num_cells_per_axis =
       get_config_file_option_value<int>("work_stats_grid_num_cells_per_axis");
     num_work_items_per_batch =
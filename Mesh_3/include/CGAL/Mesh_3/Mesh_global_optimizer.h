@@ -35,6 +35,7 @@
 #include <CGAL/tuple.h>
 
 #include <CGAL/Mesh_3/Concurrent_mesher_config.h>
+#include <CGAL/Incident_cells_map_3.h>
 
 #ifdef CGAL_MESH_3_PROFILING
   #include <CGAL/Mesh_3/Profiling_tools.h>
@@ -340,6 +341,11 @@ private:
    */
   bool check_convergence() const;
 
+  /**
+   * Fills `cells` with the cells incident to `v`.
+   */
+  void get_incident_cells(const Vertex_handle& v, Cell_vector& cells) const;
+
   /**
    * Returns the average circumradius length of cells incident to `v`.
    */
@@ -586,6 +592,18 @@ private:
 #endif
 #ifdef CGAL_LINKED_WITH_TBB
   tbb::task_group_context tbb_task_group_context;
+
+  // In the parallel version, the stars of the vertices are cached and reused
+  // across iterations, as long as none of their cells is erased
+  typedef Incident_cells_map_3<
+    typename Tr::Triangulation_data_structure>   Incident_cells_map;
+  static constexpr bool use_incident_cells_map =
+    std::is_convertible<Concurrency_tag, Parallel_tag>::value &&
+    Incident_cells_map::Tracks_erased_cells;
+
+  Incident_cells_map incident_cells_map_;
+  // vertices whose star was not in `incident_cells_map_`, or was outdated
+  mutable tbb::concurrent_vector<Vertex_handle> outdated_stars_;
 #endif
 };
 
@@ -599,7 +617,8 @@ Mesh_global_optimizer(C3T3& c3t3,
                       const FT& convergence_ratio,
                       const Mf move_function)
 : Base(c3t3.bbox(),
-       Concurrent_mesher_config::get().locking_grid_num_cells_per_axis)
+       Concurrent_mesher_config::get().locking_grid_num_cells_per_axis_for(
+           c3t3.triangulation().number_of_vertices()))
 , c3t3_(c3t3)
 , tr_(c3t3_.triangulation())
 , domain_(domain)
@@ -618,6 +637,14 @@ Mesh_global_optimizer(C3T3& c3t3,
   // If we're multi-thread
   tr_.set_lock_data_structure(get_lock_data_structure());
 
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (use_incident_cells_map)
+  {
+    if(tr_.dimension() == 3)
+      incident_cells_map_.build(tr_.tds(), Parallel_tag());
+  }
+#endif
+
 #ifdef CGAL_MESH_3_OPTIMIZER_VERBOSE
   std::cerr << "Fill sizing field...";
   CGAL::Real_timer timer;
@@ -820,6 +847,13 @@ compute_moves(Moving_vertices_set& moving_vertices)
     {
       moving_vertices.erase(*it);
     }
+
+    if constexpr (use_incident_cells_map)
+    {
+      incident_cells_map_.update(tr_.tds(), outdated_stars_.begin(), outdated_stars_.end(),
+                                 Parallel_tag());
+      outdated_stars_.clear();
+    }
   }
   // Sequential
   else
@@ -883,18 +917,7 @@ compute_move(const Vertex_handle& v)
   typename GT::Construct_vector_3 vector = tr_.geom_traits().construct_vector_3_object();
 
   Cell_vector incident_cells;
-  incident_cells.reserve(64);
-#ifdef CGAL_LINKED_WITH_TBB
-  // Parallel
-  if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
-  {
-    tr_.incident_cells_threadsafe(v, std::back_inserter(incident_cells));
-  }
-  else
-#endif //CGAL_LINKED_WITH_TBB
-  {
-    tr_.incident_cells(v, std::back_inserter(incident_cells));
-  }
+  get_incident_cells(v, incident_cells);
 
   // Get move from move function
   Vector_3 move = move_function_(v, incident_cells, c3t3_, sizing_field_);
@@ -928,6 +951,38 @@ compute_move(const Vertex_handle& v)
 }
 
 
+template <typename C3T3, typename Md, typename Mf, typename V_>
+void
+Mesh_global_optimizer<C3T3,Md,Mf,V_>::
+get_incident_cells(const Vertex_handle& v, Cell_vector& cells) const
+{
+#ifdef CGAL_LINKED_WITH_TBB
+  // Parallel
+  if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    if constexpr (use_incident_cells_map)
+    {
+      if(incident_cells_map_.is_up_to_date(v))
+      {
+        const auto cached_cells = incident_cells_map_.incident_cells(v);
+        cells.assign(cached_cells.begin(), cached_cells.end());
+        return;
+      }
+      outdated_stars_.push_back(v);
+    }
+
+    cells.reserve(64);
+    tr_.incident_cells_threadsafe(v, std::back_inserter(cells));
+  }
+  else
+#endif //CGAL_LINKED_WITH_TBB
+  {
+    cells.reserve(64);
+    tr_.incident_cells(v, std::back_inserter(cells));
+  }
+}
+
+
 template <typename C3T3, typename Md, typename Mf, typename V_>
 void
 Mesh_global_optimizer<C3T3,Md,Mf,V_>::
@@ -1106,18 +1161,7 @@ Mesh_global_optimizer<C3T3,Md,Mf,V_>::
 average_circumradius_length(const Vertex_handle& v) const
 {
   Cell_vector incident_cells;
-  incident_cells.reserve(64);
-#ifdef CGAL_LINKED_WITH_TBB
-  // Parallel
-  if (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
-  {
-    tr_.incident_cells_threadsafe(v, std::back_inserter(incident_cells));
-  }
-  else
-#endif //CGAL_LINKED_WITH_TBB
-  {
-    tr_.incident_cells(v, std::back_inserter(incident_cells));
-  }
+  get_incident_cells(v, incident_cells);
 
   FT sum_len (0);
   unsigned int nb = 0;
@@ -0,0 +1,244 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+//
+//******************************************************************************
+// File Description : Statistics gathered at runtime during mesh generation
+//******************************************************************************
+
+#ifndef CGAL_MESH_3_MESH_STATISTICS_H
+#define CGAL_MESH_3_MESH_STATISTICS_H
+
+#include <CGAL/license/Mesh_3.h>
+
+#include <CGAL/Mesh_optimization_return_code.h>
+#include <CGAL/Memory_sizer.h>
+#include <CGAL/Real_timer.h>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+
+namespace CGAL {
+namespace Mesh_3 {
+
+/*!
+\ingroup PkgMesh3MeshClasses
+
+The statistics of one phase of the mesh generation.
+When a phase is run several times (for example by successive calls to
+`refine_mesh_3()` with the same `Mesh_statistics`), the values are accumulated.
+
+\sa `Mesh_statistics`
+*/
+struct Mesh_phase_statistics
+{
+  /// The wall-clock time spent in the phase, in seconds.
+  double time = 0.;
+
+  /// The number of points inserted in the triangulation.
+  std::size_t number_of_insertions = 0;
+
+  /// The number of times an element could not be locked by a thread,
+  /// and its refinement was postponed. Always `0` with `Sequential_tag`.
+  std::size_t number_of_lock_conflicts = 0;
+
+  /// The number of times the conflict zone of a refinement point
+  /// could not be locked by a thread, and the refinement was rolled back.
+  /// Always `0` with `Sequential_tag`.
+  std::size_t number_of_rollbacks = 0;
+
+  /// The maximal number of elements in the refinement queue.
+  std::size_t maximal_queue_size = 0;
+
+  /// The number of vertices of the triangulation at the end of the phase.
+  std::size_t number_of_vertices = 0;
+
+  /// For the optimization phases, the reason why the optimization stopped.
+  Mesh_optimization_return_code return_code = MESH_OPTIMIZATION_UNKNOWN_ERROR;
+};
+
+/*!
+\ingroup PkgMesh3MeshClasses
+
+The statistics gathered by the mesh generation functions, when a pointer to an object
+of this type is passed with the named parameter `statistics`, per phase of the mesh generation.
+When the named parameter is not passed, no statistics are gathered.
+
+\sa `make_mesh_3()`
+\sa `refine_mesh_3()`
+*/
+struct Mesh_statistics
+{
+  /// The protection of the 0- and 1-dimensional features with protecting balls.
+  Mesh_phase_statistics protection;
+  /// The insertion of the initial points and the scan of the initial surface facets.
+  Mesh_phase_statistics initialization;
+  /// The refinement of the surface facets.
+  Mesh_phase_statistics facet_refinement;
+  /// The refinement of the cells, including the refinement of the facets encroached by cells.
+  Mesh_phase_statistics cell_refinement;
+  /// The ODT-smoothing.
+  Mesh_phase_statistics odt;
+  /// The Lloyd-smoothing.
+  Mesh_phase_statistics lloyd;
+  /// The sliver perturbation.
+  Mesh_phase_statistics perturbation;
+  /// The sliver exudation.
+  Mesh_phase_statistics exudation;
+
+  /// The peak resident memory of the process at the end of the mesh generation, in bytes,
+  /// or `0` if it is not known on the platform.
+  std::size_t peak_memory = 0;
+
+  /// Returns the total time of all the phases, in seconds.
+  double total_time() const
+  {
+    return protection.time + initialization.time + facet_refinement.time + cell_refinement.time
+         + odt.time + lloyd.time + perturbation.time + exudation.time;
+  }
+};
+
+/// \cond SKIP_IN_MANUAL
+inline std::ostream& operator<<(std::ostream& os, const Mesh_phase_statistics& s)
+{
+  os << s.time << " s, " << s.number_of_insertions << " insertions, "
+     << s.number_of_vertices << " vertices";
+  if(s.maximal_queue_size != 0)
+    os << ", queue size " << s.maximal_queue_size;
+  if(s.number_of_lock_conflicts != 0 || s.number_of_rollbacks != 0)
+    os << ", " << s.number_of_lock_conflicts << " lock conflicts, "
+       << s.number_of_rollbacks << " rollbacks";
+  return os;
+}
+
+inline std::ostream& operator<<(std::ostream& os, const Mesh_statistics& s)
+{
+  os << "Protection:       " << s.protection << "\n"
+     << "Initialization:   " << s.initialization << "\n"
+     << "Facet refinement: " << s.facet_refinement << "\n"
+     << "Cell refinement:  " << s.cell_refinement << "\n"
+     << "ODT:              " << s.odt.time << " s\n"
+     << "Lloyd:            " << s.lloyd.time << " s\n"
+     << "Perturbation:     " << s.perturbation.time << " s\n"
+     << "Exudation:        " << s.exudation.time << " s\n"
+     << "Total:            " << s.total_time() << " s, peak memory "
+     << s.peak_memory / (1024 * 1024) << " MB" << std::endl;
+  return os;
+}
+/// \endcond
+
+namespace internal {
+
+// Counters of the refinement, shared by the mesher levels.
+// They are only updated when statistics are requested.
+struct Refinement_counters
+{
+  std::atomic<std::size_t> number_of_insertions{0};
+  std::atomic<std::size_t> number_of_lock_conflicts{0};
+  std::atomic<std::size_t> number_of_rollbacks{0};
+  std::atomic<std::size_t> maximal_queue_size{0};
+
+  static void increment(std::atomic<std::size_t>& counter)
+  {
+    counter.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void update_maximal_queue_size(std::size_t size)
+  {
+    std::size_t current = maximal_queue_size.load(std::memory_order_relaxed);
+    while(current < size &&
+          !maximal_queue_size.compare_exchange_weak(current, size, std::memory_order_relaxed))
+    { }
+  }
+
+  void clear()
+  {
+    number_of_insertions = 0;
+    number_of_lock_conflicts = 0;
+    number_of_rollbacks = 0;
+    maximal_queue_size = 0;
+  }
+
+  // adds the counters to `s`, and clears them
+  void flush(Mesh_phase_statistics& s)
+  {
+    s.number_of_insertions += number_of_insertions;
+    s.number_of_lock_conflicts += number_of_lock_conflicts;
+    s.number_of_rollbacks += number_of_rollbacks;
+    if(s.maximal_queue_size < maximal_queue_size)
+      s.maximal_queue_size = maximal_queue_size;
+    clear();
+  }
+};
+
+// Records the time of one phase of the mesh generation in `s`, if it is not null,
+// as well as the number of vertices of `tr` at the end of the phase and,
+// if `count_insertions` is `true`, the number of vertices added during the phase
+template <typename Tr>
+class Phase_recorder
+{
+public:
+  Phase_recorder(Mesh_phase_statistics* s, const Tr& tr, bool count_insertions = true)
+    : s_(s), tr_(tr), count_insertions_(count_insertions), initial_number_of_vertices_(0)
+  {
+    if(s_ != nullptr)
+    {
+      initial_number_of_vertices_ = tr_.number_of_vertices();
+      timer_.start();
+    }
+  }
+
+  ~Phase_recorder() { stop(); }
+
+  // ends the phase before the destruction of the recorder
+  void stop()
+  {
+    if(s_ == nullptr)
+      return;
+
+    timer_.stop();
+    s_->time += timer_.time();
+    s_->number_of_vertices = tr_.number_of_vertices();
+    if(count_insertions_ && s_->number_of_vertices > initial_number_of_vertices_)
+      s_->number_of_insertions += s_->number_of_vertices - initial_number_of_vertices_;
+    s_ = nullptr;
+  }
+
+private:
+  Mesh_phase_statistics* s_;
+  const Tr& tr_;
+  bool count_insertions_;
+  std::size_t initial_number_of_vertices_;
+  Real_timer timer_;
+};
+
+template <typename Tr>
+Phase_recorder<Tr> record_phase(Mesh_statistics* s,
+                                Mesh_phase_statistics Mesh_statistics::* phase,
+                                const Tr& tr,
+                                bool count_insertions = true)
+{
+  return Phase_recorder<Tr>((s == nullptr) ? nullptr : &(s->*phase), tr, count_insertions);
+}
+
+inline void update_peak_memory(Mesh_statistics* s)
+{
+  if(s != nullptr)
+    s->peak_memory = Memory_sizer().peak_resident_size();
+}
+
+} // namespace internal
+
+} // namespace Mesh_3
+} // namespace CGAL
+
+#endif // CGAL_MESH_3_MESH_STATISTICS_H
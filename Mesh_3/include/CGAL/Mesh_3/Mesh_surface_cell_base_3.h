@@ -92,12 +92,17 @@ public:
     bits_ = 0;
   }
 
+  Mesh_surface_cell_base_3_base(const Mesh_surface_cell_base_3_base& rhs)
+  {
+    bits_ = rhs.bits_.load();
+  }
+
   /// Marks `facet` as visited.
   void set_facet_visited (const int facet)
   {
     CGAL_precondition(facet>=0 && facet<4);
     char current_bits = bits_;
-    while (bits_.compare_exchange_weak(current_bits, current_bits | (1 << facet)) )
+    while (!bits_.compare_exchange_weak(current_bits, char(current_bits | (1 << facet))))
     {
       current_bits = bits_;
     }
@@ -108,7 +113,7 @@ public:
   {
     CGAL_precondition(facet>=0 && facet<4);
     char current_bits = bits_;
-    while (bits_.compare_exchange_weak(current_bits, current_bits & (15 & ~(1 << facet))))
+    while (!bits_.compare_exchange_weak(current_bits, char(current_bits & (15 & ~(1 << facet)))))
     {
       current_bits = bits_;
     }
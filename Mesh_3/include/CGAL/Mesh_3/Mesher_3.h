@@ -52,6 +52,7 @@
 #endif
 
 #include <CGAL/Mesh_3/Concurrent_mesher_config.h>
+#include <CGAL/Mesh_3/Mesh_statistics.h>
 #include <CGAL/Real_timer.h>
 
 #ifdef CGAL_MESH_3_PROFILING
@@ -86,6 +87,7 @@ protected:
   Lock_data_structure *get_lock_data_structure() const { return 0; }
   WorksharingDataStructureType *get_worksharing_data_structure() const { return 0; }
   void set_bbox(const Bbox_3 &) {}
+  void adapt_lock_data_structure(std::size_t) {}
 };
 
 #ifdef CGAL_LINKED_WITH_TBB
@@ -120,6 +122,14 @@ protected:
     m_worksharing_ds.set_bbox(bbox);
   }
 
+  // Adapts the resolution of the lock grid to the density of the mesh.
+  // Must be called when no thread is refining.
+  void adapt_lock_data_structure(std::size_t number_of_vertices)
+  {
+    m_lock_ds.set_num_grid_cells_per_axis(
+      Concurrent_mesher_config::get().locking_grid_num_cells_per_axis_for(number_of_vertices));
+  }
+
   /// Lock data structure
   Lock_data_structure m_lock_ds;
   /// Worksharing data structure
@@ -236,6 +246,15 @@ public:
   /// Launch mesh refinement
   double refine_mesh(std::string dump_after_refine_surface_prefix = "");
 
+  /// Sets the statistics updated by `refine_mesh()`, if not null
+  void set_statistics(Mesh_statistics* statistics)
+  {
+    statistics_ = statistics;
+    internal::Refinement_counters* counters = (statistics == nullptr) ? nullptr : &counters_;
+    facets_mesher_.set_refinement_counters(counters);
+    cells_mesher_.set_refinement_counters(counters);
+  }
+
   /// Debug
   std::string debug_info() const;
   std::string debug_info_header() const;
@@ -297,6 +316,30 @@ private:
   std::atomic<bool>* const stop_ptr;
 #endif
 
+  /// Statistics, and the counters of the mesher levels
+  Mesh_statistics* statistics_;
+  internal::Refinement_counters counters_;
+
+  internal::Phase_recorder<Triangulation>
+  record_phase(Mesh_phase_statistics Mesh_statistics::* phase)
+  {
+    // the number of insertions is given by the counters
+    return internal::record_phase(statistics_, phase, r_c3t3_.triangulation(), false);
+  }
+
+  void flush_refinement_counters(Mesh_phase_statistics Mesh_statistics::* phase)
+  {
+    if(statistics_ != nullptr)
+      counters_.flush(statistics_->*phase);
+  }
+
+  /// Adapts the lock grid to the current number of vertices, between two
+  /// parallel refinement stages
+  void adapt_lock_data_structure()
+  {
+    Base::adapt_lock_data_structure(r_c3t3_.triangulation().number_of_vertices());
+  }
+
 #ifdef CGAL_LINKED_WITH_TBB
   std::size_t approximate_number_of_vertices(CGAL::Parallel_tag) const {
 #  if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
@@ -394,6 +437,7 @@ Mesher_3<C3T3,MC,MD>::Mesher_3(C3T3& c3t3,
 #ifndef CGAL_NO_ATOMIC
 , stop_ptr(stop_ptr)
 #endif
+, statistics_(nullptr)
 {
   facets_mesher_.set_lock_ds(this->get_lock_data_structure());
   facets_mesher_.set_worksharing_ds(this->get_worksharing_data_structure());
@@ -436,7 +480,11 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
 #ifndef CGAL_MESH_3_VERBOSE
   // Scan surface and refine it
   CGAL_MESH_3_TASK_BEGIN(initialize_task_handle);
-  initialize();
+  {
+    auto recorder = record_phase(&Mesh_statistics::initialization);
+    initialize();
+    flush_refinement_counters(&Mesh_statistics::initialization);
+  }
   CGAL_MESH_3_TASK_END(initialize_task_handle);
 
 #ifdef CGAL_MESH_3_PROFILING
@@ -444,13 +492,20 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
   WallClockTimer t;
 #endif
   CGAL_MESH_3_TASK_BEGIN(refine_surface_mesh_task_handle);
-  facets_mesher_.refine(facets_visitor_);
-  facets_mesher_.scan_edges();
-  refinement_stage = REFINE_FACETS_AND_EDGES;
-  facets_mesher_.refine(facets_visitor_);
-  facets_mesher_.scan_vertices();
-  refinement_stage = REFINE_FACETS_AND_EDGES_AND_VERTICES;
-  facets_mesher_.refine(facets_visitor_);
+  {
+    auto recorder = record_phase(&Mesh_statistics::facet_refinement);
+    adapt_lock_data_structure();
+    facets_mesher_.refine(facets_visitor_);
+    facets_mesher_.scan_edges();
+    refinement_stage = REFINE_FACETS_AND_EDGES;
+    adapt_lock_data_structure();
+    facets_mesher_.refine(facets_visitor_);
+    facets_mesher_.scan_vertices();
+    refinement_stage = REFINE_FACETS_AND_EDGES_AND_VERTICES;
+    adapt_lock_data_structure();
+    facets_mesher_.refine(facets_visitor_);
+    flush_refinement_counters(&Mesh_statistics::facet_refinement);
+  }
   CGAL_MESH_3_TASK_END(refine_surface_mesh_task_handle);
 #ifdef CGAL_MESH_3_PROFILING
   double facet_ref_time = t.elapsed();
@@ -483,6 +538,9 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
 
   if(!forced_stop())
   {
+    auto recorder = record_phase(&Mesh_statistics::cell_refinement);
+    adapt_lock_data_structure();
+
     // Then scan volume and refine it
     CGAL_MESH_3_TASK_BEGIN(scan_cells_task_handle);
     cells_mesher_.scan_triangulation();
@@ -495,6 +553,7 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
     CGAL_MESH_3_TASK_BEGIN(refine_volume_mesh_task_handle);
     cells_mesher_.refine(cells_visitor_);
     CGAL_MESH_3_TASK_END(refine_volume_mesh_task_handle);
+    flush_refinement_counters(&Mesh_statistics::cell_refinement);
 #ifdef CGAL_MESH_3_PROFILING
     double cell_ref_time = t.elapsed();
     std::cerr << "==== Cell refinement: " << cell_ref_time << " seconds ===="
@@ -518,7 +577,11 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
 #else // ifdef CGAL_MESH_3_VERBOSE
   std::cerr << "Start surface scan...";
   CGAL_MESH_3_TASK_BEGIN(initialize_task_handle);
-  initialize();
+  {
+    auto recorder = record_phase(&Mesh_statistics::initialization);
+    initialize();
+    flush_refinement_counters(&Mesh_statistics::initialization);
+  }
   CGAL_MESH_3_TASK_END(initialize_task_handle);
   std::cerr << "end scan. [Bad facets:" << facets_mesher_.size() << "]";
   std::cerr << std::endl << std::endl;
@@ -536,6 +599,8 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
             << nbsteps << "," << cells_mesher_.debug_info() << ")";
 
   CGAL_MESH_3_TASK_BEGIN(refine_surface_mesh_task_handle);
+  auto facet_recorder = record_phase(&Mesh_statistics::facet_refinement);
+  adapt_lock_data_structure();
   while ( ! facets_mesher_.is_algorithm_done() &&
           ! forced_stop() )
   {
@@ -562,6 +627,8 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
     }
     ++nbsteps;
   }
+  flush_refinement_counters(&Mesh_statistics::facet_refinement);
+  facet_recorder.stop();
   CGAL_MESH_3_TASK_END(refine_surface_mesh_task_handle);
   std::cerr << std::endl;
   std::cerr << "Total refining surface time: " << timer.time() << "s" << std::endl;
@@ -576,6 +643,8 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
   facets_visitor_.activate();
 
   std::cerr << "Start volume scan...";
+  auto cell_recorder = record_phase(&Mesh_statistics::cell_refinement);
+  adapt_lock_data_structure();
   CGAL_MESH_3_TASK_BEGIN(scan_cells_task_handle);
   cells_mesher_.scan_triangulation();
   CGAL_MESH_3_TASK_END(scan_cells_task_handle);
@@ -607,6 +676,8 @@ refine_mesh(std::string dump_after_refine_surface_prefix)
     ++nbsteps;
   }
   CGAL_MESH_3_TASK_END(refine_volume_mesh_task_handle);
+  flush_refinement_counters(&Mesh_statistics::cell_refinement);
+  cell_recorder.stop();
   std::cerr << std::endl;
 
   std::cerr << "Total refining volume time: " << timer.time() << "s" << std::endl;
@@ -672,7 +743,9 @@ initialize()
 
 # ifndef CGAL_PARALLEL_MESH_3_DO_NOT_ADD_OUTSIDE_POINTS_ON_A_FAR_SPHERE
 
-    if (r_c3t3_.number_of_far_points() == 0 && r_c3t3_.number_of_facets() == 0)
+    // periodic triangulations have no infinite vertex to shield from the conflict zones
+    if (!std::is_same<typename Triangulation::Periodic_tag, Tag_true>::value &&
+        r_c3t3_.number_of_far_points() == 0 && r_c3t3_.number_of_facets() == 0)
     {
       const Bbox_3 &bbox = r_oracle_.bbox();
 
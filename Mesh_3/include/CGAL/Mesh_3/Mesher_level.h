@@ -24,6 +24,7 @@
 #endif
 
 #include <CGAL/Mesher_level.h>
+#include <CGAL/Mesh_3/Mesh_statistics.h>
 #include <CGAL/Mesh_3/Worksharing_data_structures.h>
 
 #ifdef CGAL_CONCURRENT_MESH_3_PROFILING
@@ -185,6 +186,10 @@ protected:
   WallClockTimer m_timer;
 #endif
 
+protected:
+  /** Counters updated during the refinement, if not null. */
+  internal::Refinement_counters* m_counters;
+
 public:
   typedef Mesher_level_base<Tr,
                        Derived,
@@ -195,9 +200,15 @@ public:
   /** \name CONSTRUCTORS */
   Mesher_level_base(Previous_level& previous)
     : previous_level(previous)
+    , m_counters(nullptr)
   {
   }
 
+  void set_refinement_counters(internal::Refinement_counters* counters)
+  {
+    m_counters = counters;
+  }
+
   /** \name FUNCTIONS IMPLEMENTED IN THE CLASS `Derived` */
 
   /**  Access to the triangulation */
@@ -389,6 +400,9 @@ public:
   template <class Mesh_visitor>
   bool process_one_element(Mesh_visitor visitor)
   {
+    if(m_counters != nullptr)
+      m_counters->update_maximal_queue_size(static_cast<std::size_t>(number_of_elements_in_queue()));
+
     Element e = get_next_element();
 
     const Mesher_level_conflict_status result
@@ -603,6 +617,9 @@ public:
 
       Vertex_handle vh = insert(p, zone);
 
+      if(this->m_counters != nullptr)
+        this->m_counters->increment(this->m_counters->number_of_insertions);
+
       this->after_insertion(vh, visitor);
     }
     else
@@ -736,6 +753,8 @@ public:
     Concurrent_mesher_config::get().first_grid_lock_radius)
     , REFINEMENT_BATCH_SIZE(
     Concurrent_mesher_config::get().refinement_batch_size)
+    , NUM_LOCK_ATTEMPTS_BEFORE_DEFERRAL(
+    Concurrent_mesher_config::get().num_lock_attempts_before_deferral)
     , m_lock_ds(0)
     , m_worksharing_ds(0)
     , m_task_group(0)
@@ -897,6 +916,9 @@ public:
 
     m_task_group = new tbb::task_group;
 
+    if(this->m_counters != nullptr)
+      this->m_counters->update_maximal_queue_size(static_cast<std::size_t>(this->number_of_elements_in_queue()));
+
     while (!no_longer_element_to_refine())
     {
       Container_quality_and_element qe = derived().get_next_raw_element_impl();
@@ -1001,6 +1023,9 @@ public:
       }
       else
       {
+        if(this->m_counters != nullptr)
+          this->m_counters->increment(this->m_counters->number_of_insertions);
+
         this->after_insertion(vh, visitor);
       }
     }
@@ -1055,6 +1080,8 @@ public:
 #ifdef CGAL_CONCURRENT_MESH_3_PROFILING
             bcounter.increment_branch_1(); // THIS is a late withdrawal!
 #endif
+            if(this->m_counters != nullptr)
+              this->m_counters->increment(this->m_counters->number_of_rollbacks);
           }
           else
           {
@@ -1077,6 +1104,8 @@ public:
 #ifdef CGAL_CONCURRENT_MESH_3_PROFILING
         bcounter.increment_branch_2(); // THIS is an early withdrawal!
 #endif
+        if(this->m_counters != nullptr)
+          this->m_counters->increment(this->m_counters->number_of_lock_conflicts);
         // Unlock
         unlock_all_thread_local_elements();
 
@@ -1162,6 +1191,7 @@ protected:
   const int FIRST_GRID_LOCK_RADIUS;
   const int MESH_3_REFINEMENT_GRAINSIZE;
   const int REFINEMENT_BATCH_SIZE;
+  const int NUM_LOCK_ATTEMPTS_BEFORE_DEFERRAL;
   Lock_data_structure *m_lock_ds;
   WorksharingDataStructureType *m_worksharing_ds;
 
@@ -1200,6 +1230,15 @@ private:
       typedef typename ML::Derived_::Container::value_type
                                                  Container_quality_and_element;
 
+      // After `NUM_LOCK_ATTEMPTS_BEFORE_DEFERRAL` failures to lock the element
+      // or its zone, the element is deferred: it is put back in the work buffer
+      // of this thread, which goes on with other elements instead of waiting
+      // for the other thread. The deferred element is then refined later,
+      // by this thread or by a thread which stole its batch.
+      const int max_attempts = m_mesher_level.NUM_LOCK_ATTEMPTS_BEFORE_DEFERRAL;
+      int attempts = 0;
+      bool deferred = false;
+
       Mesher_level_conflict_status status;
       do
       {
@@ -1209,8 +1248,16 @@ private:
 
         status = m_mesher_level.try_lock_and_refine_element(m_container_element,
                                                             m_visitor);
+
+        if (max_attempts > 0
+            && (status == COULD_NOT_LOCK_ELEMENT || status == COULD_NOT_LOCK_ZONE)
+            && ++attempts >= max_attempts)
+        {
+          deferred = true;
+        }
       }
-      while (status != NO_CONFLICT
+      while (!deferred
+        && status != NO_CONFLICT
         && status != CONFLICT_AND_ELEMENT_SHOULD_BE_DROPPED
         && status != CONFLICT_BUT_ELEMENT_CAN_BE_RECONSIDERED
         && status != ELEMENT_WAS_A_ZOMBIE);
@@ -1219,7 +1266,7 @@ private:
       m_mesher_level.before_next_element_refinement(m_visitor);
 
       // We can now reconsider the element if requested
-      if (status == CONFLICT_BUT_ELEMENT_CAN_BE_RECONSIDERED)
+      if (deferred || status == CONFLICT_BUT_ELEMENT_CAN_BE_RECONSIDERED)
         m_mesher_level.enqueue_task(m_container_element, m_quality, m_visitor);
 
       // Finally we add the new local bad_elements to the feeder
@@ -58,11 +58,17 @@
 #include <boost/unordered_map.hpp>
 #include <boost/unordered_set.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#endif
+
 #include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <iterator>
 #include <list>
+#include <map>
 #include <sstream>
 #include <set>
 #include <stack>
@@ -140,6 +146,8 @@ public:
   typedef typename MeshDomain::Corner_index         Corner_index;
   typedef typename MeshDomain::Index                Index;
 
+  typedef typename C3T3::Concurrency_tag            Concurrency_tag;
+
   using Distance_Function =
     typename CGAL::Default::Get<DistanceFunction, NoDistanceFunction>::type;
 
@@ -196,6 +204,42 @@ private:
   typedef CGAL::Hash_handles_with_or_without_timestamps      Hash_fct;
   typedef boost::unordered_set<Vertex_handle, Hash_fct>      Vertex_set;
 
+  typedef std::tuple<Curve_index,
+                     std::pair<Bare_point,Index>,
+                     std::pair<Bare_point,Index> >           Feature_tuple;
+  typedef std::vector<Feature_tuple>                         Input_features;
+
+  struct Bare_point_less
+  {
+    bool operator()(const Bare_point& p, const Bare_point& q) const
+    {
+      if(p.x() != q.x()) return p.x() < q.x();
+      if(p.y() != q.y()) return p.y() < q.y();
+      return p.z() < q.z();
+    }
+    bool operator()(const std::pair<Bare_point, FT>& p,
+                    const std::pair<Bare_point, FT>& q) const
+    {
+      if(p.second != q.second) return p.second < q.second;
+      return operator()(p.first, q.first);
+    }
+  };
+
+  /// Results of the queries to the domain and to the sizing field made
+  /// while inserting the balls of a curve. With `Parallel_tag`, they are
+  /// computed beforehand, in parallel for all the curves, by a dry run of
+  /// `insert_balls()` that ignores the other curves. The actual insertion
+  /// then only queries the domain where it differs from the dry run.
+  struct Curve_queries
+  {
+    Curve_index curve_index;
+    Index index;
+    std::optional<FT> curve_length;
+    std::map<std::pair<Bare_point, FT>, Bare_point, Bare_point_less> points_on_curve;
+    std::map<Bare_point, FT, Bare_point_less> sizes;
+    std::vector<std::tuple<Bare_point, Bare_point, CGAL::Orientation, FT> > segment_lengths;
+  };
+
 private:
   /// Insert corners of the mesh.
   void insert_corners();
@@ -265,6 +309,62 @@ private:
                              const Curve_index& curve_index,
                              ErasedVeOutIt out);
 
+  /// Computes the centers and the weights of the balls inserted by
+  /// `insert_balls()` between `p` and the point at geodesic distance `d`
+  /// along the curve, when the sizes of the balls grow linearly from `sp`
+  /// to `sq`. `n` is the initial number of balls, and `is_cycle` is `true`
+  /// when the balls cover a whole cycle.
+  template <typename OutputIterator>
+  OutputIterator sample_curve_segment(const Bare_point& p,
+                                      const FT sp,
+                                      const FT sq,
+                                      const FT d,
+                                      const CGAL::Orientation d_sign,
+                                      const Curve_index& curve_index,
+                                      int n,
+                                      const bool is_cycle,
+                                      Curve_queries* queries,
+                                      OutputIterator out) const;
+
+  /// Dry run of `insert_balls()` on the curve of `feature`, whose
+  /// extremities are the vertices `vp` and `vq` (null if the extremity
+  /// of a cycle is not a vertex yet). Fills `queries`.
+  void plan_balls_on_curve(const Feature_tuple& feature,
+                           const Vertex_handle& vp,
+                           const Vertex_handle& vq,
+                           Curve_queries& queries) const;
+
+  void plan_balls(const Bare_point& p,
+                  const Bare_point& q,
+                  const FT sp,
+                  const FT sq,
+                  const FT d,
+                  const CGAL::Orientation d_sign,
+                  const bool is_cycle,
+                  Curve_queries& queries) const;
+
+  /// Returns the radius of the ball that `smart_insert_point()` inserts at
+  /// `p` with weight `w`, if no other ball is close.
+  FT planned_radius(const Bare_point& p, FT w, const Index& index,
+                    Curve_queries& queries) const;
+
+  /// Cached queries to the domain and to the sizing field. If `queries` is
+  /// not null, the results are stored in it. Otherwise, they are looked for in
+  /// the queries of the curve being protected, if any.
+  Bare_point construct_point_on_curve(const Bare_point& p,
+                                      const Curve_index& curve_index,
+                                      const FT& distance,
+                                      Curve_queries* queries = nullptr) const;
+  FT curve_length(const Curve_index& curve_index,
+                  Curve_queries* queries = nullptr) const;
+  FT domain_curve_segment_length(const Bare_point& p,
+                                 const Bare_point& q,
+                                 const Curve_index& curve_index,
+                                 const CGAL::Orientation orientation,
+                                 Curve_queries* queries = nullptr) const;
+  FT sizing_field(const Bare_point& p, int dim, const Index& index,
+                  Curve_queries* queries = nullptr) const;
+
   /// Returns `true` if the balls of `va` and `vb` intersect, and `(va,vb)` is not
   /// an edge of the complex.
   bool non_adjacent_but_intersect(const Vertex_handle& va,
@@ -479,9 +579,12 @@ private:
   }
 
   /// Query the sizing field and return its value at the point `p`
-  FT query_size(const Bare_point& p, int dim, const Index& index) const
+  FT query_size(const Bare_point& p, int dim, const Index& index,
+                Curve_queries* queries = nullptr) const
   {
-    FT s = query_field(p, dim, index, size_);
+    FT s = query_field(p, dim, index,
+                       [this, queries](const Bare_point& q, int d, const Index& i)
+                       { return sizing_field(q, d, i, queries); });
     return s;
   }
 
@@ -526,6 +629,8 @@ private:
   /// Pointer to the atomic Boolean that can stop the process
   std::atomic<bool>* const stop_ptr_;
 #endif
+  /// Queries of the curve being protected, computed beforehand
+  const Curve_queries* curve_queries_;
 };
 
 
@@ -554,6 +659,7 @@ Protect_edges_sizing_field(C3T3& c3t3, const MD& domain,
 #ifndef CGAL_NO_ATOMIC
   , stop_ptr_(stop_ptr)
 #endif
+  , curve_queries_(nullptr)
 {
 #ifndef CGAL_MESH_3_NO_PROTECTION_NON_LINEAR
   set_nonlinear_growth_of_balls();
@@ -626,24 +732,22 @@ insert_corners()
 #endif
 
   Dt dt;
+  std::vector<typename Dt::Vertex_handle> dt_vertices;
+  dt_vertices.reserve(corners.size());
   for ( typename Initial_corners::iterator it = corners.begin(),
        end = corners.end() ; it != end ; ++it )
   {
-    if(forced_stop()) break;
+    if(forced_stop()) return;
     const Bare_point& p = it->second;
-    dt.insert(p);
+    dt_vertices.push_back(dt.insert(p));
   }
 
-  for ( typename Initial_corners::iterator cit = corners.begin(),
-          end = corners.end() ; cit != end ; ++cit )
+  // The weights only depend on the sizing field and on the other corners,
+  // and can thus be computed independently
+  auto corner_weight = [&](const std::size_t i, auto tag) -> FT
   {
-    if(forced_stop()) break;
-    const Bare_point& p = cit->second;
-    Index p_index = domain_.index_from_corner_index(cit->first);
-
-#if CGAL_MESH_3_PROTECTION_DEBUG & 1
-      std::cerr << "\n** treat corner #" << CGAL::IO::oformat(p_index) << std::endl;
-#endif
+    const Bare_point& p = corners[i].second;
+    const Index p_index = domain_.index_from_corner_index(corners[i].first);
 
     // Get weight (the ball radius is given by the 'query_size' function)
     const FT query_weight = CGAL::square(query_size(p, 0, p_index));
@@ -652,29 +756,72 @@ insert_corners()
          : query_weight;
 
 #if CGAL_MESH_3_PROTECTION_DEBUG & 1
-      std::cerr << "Weight from sizing field: " << w << std::endl;
+      std::cerr << "Weight from sizing field at corner #"
+                << CGAL::IO::oformat(p_index) << ": " << w << std::endl;
 #endif
 
     // The following lines ensure that the weight w is small enough so that
     // corners balls do not intersect
     if(dt.number_of_vertices() >= 2)
     {
-      typename Dt::Vertex_handle vh;
-      CGAL_assertion_code( bool p_found = )
-        dt.is_vertex(p, vh);
-      CGAL_assertion(p_found);
+      const typename Dt::Vertex_handle vh = dt_vertices[i];
 
       std::vector<typename Dt::Cell_handle> finite_incident_cells;
       finite_incident_cells.reserve(64);
-      dt.finite_incident_cells(vh, std::back_inserter(finite_incident_cells));
 
       Dt_helpers helpers;
-      const FT nearest_sq_dist = helpers.template get_sq_distance_to_closest_vertex
-                                   <CGAL_NTS internal::Has_member_visited<typename Dt::Vertex> >(
-                                     dt, vh, finite_incident_cells);
+      FT nearest_sq_dist;
+      if constexpr (std::is_same<decltype(tag), Parallel_tag>::value)
+      {
+        dt.finite_incident_cells_threadsafe(vh, std::back_inserter(finite_incident_cells));
+        nearest_sq_dist = helpers.template get_sq_distance_to_closest_vertex
+                            <CGAL::Tag_false>(dt, vh, finite_incident_cells);
+      }
+      else
+      {
+        dt.finite_incident_cells(vh, std::back_inserter(finite_incident_cells));
+        nearest_sq_dist = helpers.template get_sq_distance_to_closest_vertex
+                            <CGAL_NTS internal::Has_member_visited<typename Dt::Vertex> >(
+                              dt, vh, finite_incident_cells);
+      }
 
       w = (std::min)(w, nearest_sq_dist / FT(9));
     }
+    return w;
+  };
+
+  std::vector<FT> weights(corners.size());
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, corners.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t i = r.begin(); i != r.end(); ++i)
+        weights[i] = corner_weight(i, Parallel_tag());
+    });
+  }
+  else
+#endif // CGAL_LINKED_WITH_TBB
+  {
+    for(std::size_t i = 0; i < corners.size(); ++i)
+    {
+      if(forced_stop()) return;
+      weights[i] = corner_weight(i, Sequential_tag());
+    }
+  }
+
+  for ( typename Initial_corners::iterator cit = corners.begin(),
+          end = corners.end() ; cit != end ; ++cit )
+  {
+    if(forced_stop()) break;
+    const Bare_point& p = cit->second;
+    Index p_index = domain_.index_from_corner_index(cit->first);
+    const FT w = weights[cit - corners.begin()];
+
+#if CGAL_MESH_3_PROTECTION_DEBUG & 1
+      std::cerr << "\n** treat corner #" << CGAL::IO::oformat(p_index) << std::endl;
+#endif
 
     // Insert corner with ball (dim is zero because p is a corner)
     Vertex_handle v = smart_insert_point(p, w, 0, p_index,
@@ -1019,24 +1166,74 @@ Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
 insert_balls_on_edges()
 {
   // Get features
-  typedef std::tuple<Curve_index,
-                             std::pair<Bare_point,Index>,
-                             std::pair<Bare_point,Index> >    Feature_tuple;
-  typedef std::vector<Feature_tuple>                          Input_features;
-
   Input_features input_features;
   domain_.get_curves(std::back_inserter(input_features));
 
+  std::vector<Curve_queries> queries;
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    // The queries to the domain and to the sizing field dominate the cost
+    // of the protection of long curves. They are made in parallel, by a dry
+    // run of the insertion of the balls of each curve, while the balls are
+    // then inserted sequentially, as their insertion can modify the balls
+    // of the other curves.
+    std::vector<std::pair<Vertex_handle, Vertex_handle> > extremities(input_features.size());
+    std::vector<std::size_t> curves_to_plan;
+    for (std::size_t i = 0; i < input_features.size(); ++i)
+    {
+      const Feature_tuple& ft = input_features[i];
+      const Curve_index& curve_index = std::get<0>(ft);
+      if ( is_treated(curve_index) )
+        continue;
+
+      const Bare_point& p = std::get<1>(ft).first;
+      if ( ! domain_.is_loop(curve_index) )
+      {
+        extremities[i].first = get_vertex_corner_from_point(p, std::get<1>(ft).second);
+        extremities[i].second = get_vertex_corner_from_point(std::get<2>(ft).first,
+                                                             std::get<2>(ft).second);
+      }
+      else
+      {
+        typename GT::Construct_weighted_point_3 cwp =
+          c3t3_.triangulation().geom_traits().construct_weighted_point_3_object();
+        c3t3_.triangulation().is_vertex(cwp(p), extremities[i].first);
+        extremities[i].second = extremities[i].first;
+      }
+      curves_to_plan.push_back(i);
+    }
+
+    queries.resize(input_features.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, curves_to_plan.size(), 1),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t j = r.begin(); j != r.end(); ++j)
+      {
+        if(forced_stop()) return;
+        const std::size_t i = curves_to_plan[j];
+        plan_balls_on_curve(input_features[i],
+                            extremities[i].first, extremities[i].second,
+                            queries[i]);
+      }
+    });
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
   // Iterate on edges
-  for (const Feature_tuple& ft : input_features)
+  for (std::size_t i = 0; i < input_features.size(); ++i)
   {
     if(forced_stop()) break;
+    const Feature_tuple& ft = input_features[i];
     const Curve_index& curve_index = std::get<0>(ft);
     if ( ! is_treated(curve_index) )
     {
 #if CGAL_MESH_3_PROTECTION_DEBUG & 1
       std::cerr << "\n** treat curve #" << curve_index << std::endl;
 #endif
+      if(!queries.empty())
+        curve_queries_ = &queries[i];
+
       const Bare_point& p = std::get<1>(ft).first;
       const Bare_point& q = std::get<2>(ft).first;
 
@@ -1064,12 +1261,12 @@ insert_balls_on_edges()
           // with the third of the distance from 'p' to 'q'.
           FT p_size = query_size(p, 1, p_index);
 
-          FT curve_length = domain_.curve_length(curve_index);
+          FT length = curve_length(curve_index);
 
           Bare_point other_point =
-            domain_.construct_point_on_curve(p,
-                                             curve_index,
-                                             curve_length / 2);
+            construct_point_on_curve(p,
+                                     curve_index,
+                                     length / 2);
           p_size = (std::min)(p_size,
                               compute_distance(p, other_point) / 3);
           vp = smart_insert_point(p,
@@ -1092,6 +1289,7 @@ insert_balls_on_edges()
         insert_balls(vp, vq, curve_index, CGAL::POSITIVE, Emptyset_iterator());
       }
       set_treated(curve_index);
+      curve_queries_ = nullptr;
     }
     // std::stringstream s;
     // s << "dump-mesh-curve-" << curve_index << ".binary.cgal";
@@ -1139,7 +1337,7 @@ insert_balls(const Vertex_handle& vp,
 
   // Compute geodesic distance
   const FT pq_length = (vp == vq) ?
-    domain_.curve_length(curve_index)
+    curve_length(curve_index)
     :
     curve_segment_length(vp, vq, curve_index, orientation);
 
@@ -1250,12 +1448,12 @@ insert_balls(const Vertex_handle& vp,
                 << ")\n";
 #endif
       const Bare_point new_point =
-        domain_.construct_point_on_curve(cp(vp_wp),
-                                         curve_index,
-                                         d_signF * d / 2);
+        construct_point_on_curve(cp(vp_wp),
+                                 curve_index,
+                                 d_signF * d / 2);
       const int dim = 1; // new_point is on edge
       const Index index = domain_.index_from_curve_index(curve_index);
-      const FT point_weight = CGAL::square(size_(new_point, dim, index));
+      const FT point_weight = CGAL::square(sizing_field(new_point, dim, index));
 #if CGAL_MESH_3_PROTECTION_DEBUG & 1
       std::cerr << "  middle point: " << new_point << std::endl;
       std::cerr << "  new weight: " << point_weight << std::endl;
@@ -1284,6 +1482,61 @@ insert_balls(const Vertex_handle& vp,
     }
   } // nonlinear_growth_of_balls
 
+  std::vector<std::pair<Bare_point, FT> > balls;
+  const Bare_point p = cp(vp_wp);
+  sample_curve_segment(p, sp, sq, d, d_sign, curve_index, n, vp == vq,
+                       nullptr, std::back_inserter(balls));
+
+  // Launch balls
+  Vertex_handle prev = vp;
+  for(const std::pair<Bare_point, FT>& ball : balls)
+  {
+    // Index and dimension
+    Index index = domain_.index_from_curve_index(curve_index);
+    int dim = 1; // new_point is on edge
+
+    // Insert point into c3t3
+    std::pair<Vertex_handle, ErasedVeOutIt> pair =
+      smart_insert_point(ball.first, ball.second, dim, index, out);
+    Vertex_handle new_vertex = pair.first;
+    out = pair.second;
+
+    // Add edge to c3t3
+    if(!c3t3_.is_in_complex(prev, new_vertex)) {
+      c3t3_.add_to_complex(prev, new_vertex, curve_index);
+    }
+    prev = new_vertex;
+  }
+
+  // Insert last edge into c3t3
+  // Warning: if vp==vq (cycle) and if only 1 point was inserted,
+  // then (prev,vp) == (prev,vq)
+  if ( vp != vq || balls.size() > 1 )
+  {
+    if(!c3t3_.is_in_complex(prev, vq)) {
+      c3t3_.add_to_complex(prev, vq, curve_index);
+    }
+  }
+  return out;
+}
+
+
+template <typename C3T3, typename MD, typename Sf, typename Df>
+template <typename OutputIterator>
+OutputIterator
+Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
+sample_curve_segment(const Bare_point& p,
+                     const FT sp,
+                     const FT sq,
+                     const FT d,
+                     const CGAL::Orientation d_sign,
+                     const Curve_index& curve_index,
+                     int n,
+                     const bool is_cycle,
+                     Curve_queries* queries,
+                     OutputIterator out) const
+{
+  const FT d_signF = static_cast<FT>(d_sign);
   FT r = (sq - sp) / FT(n+1);
 
 #if CGAL_MESH_3_PROTECTION_DEBUG & 1
@@ -1303,8 +1556,6 @@ insert_balls(const Vertex_handle& vp,
 
   // Initial distance
   FT pt_dist = d_signF * norm_step_size;
-  Vertex_handle prev = vp;
-  const Bare_point& p = cp(c3t3_.triangulation().point(vp));
 
   // if ( (0 == n) &&
   //      ( (d >= sp+sq) || !is_sampling_dense_enough(vp, vq) ) )
@@ -1316,7 +1567,7 @@ insert_balls(const Vertex_handle& vp,
     step_size = sp + (d-sp-sq) / FT(2);
     pt_dist = d_signF * step_size;
     norm_step_size = step_size;
-  } else if(vp == vq && n == 1) {
+  } else if(is_cycle && n == 1) {
     // In case we sample a full cycle, we want to add at least 2
     // balls, equally distributed.
     n = 2;
@@ -1338,32 +1589,16 @@ insert_balls(const Vertex_handle& vp,
 #endif
   }
 
-  // Launch balls
   for ( int i = 1 ; i <= n ; ++i )
   {
     // New point position
     Bare_point new_point =
-      domain_.construct_point_on_curve(p, curve_index, pt_dist);
+      construct_point_on_curve(p, curve_index, pt_dist, queries);
 
     // Weight (use as size the min between norm_step_size and linear interpolation)
     FT current_size = (std::min)(norm_step_size, sp + CGAL::abs(pt_dist)/d*(sq-sp));
     FT point_weight = current_size * current_size;
-
-    // Index and dimension
-    Index index = domain_.index_from_curve_index(curve_index);
-    int dim = 1; // new_point is on edge
-
-    // Insert point into c3t3
-    std::pair<Vertex_handle, ErasedVeOutIt> pair =
-      smart_insert_point(new_point, point_weight, dim, index, out);
-    Vertex_handle new_vertex = pair.first;
-    out = pair.second;
-
-    // Add edge to c3t3
-    if(!c3t3_.is_in_complex(prev, new_vertex)) {
-      c3t3_.add_to_complex(prev, new_vertex, curve_index);
-    }
-    prev = new_vertex;
+    *out++ = std::make_pair(new_point, point_weight);
 
     // Step size
     step_size += r;
@@ -1372,17 +1607,223 @@ insert_balls(const Vertex_handle& vp,
     // Increment distance
     pt_dist += d_signF * norm_step_size;
   }
+  return out;
+}
 
-  // Insert last edge into c3t3
-  // Warning: if vp==vq (cycle) and if only 1 point was inserted,
-  // then (prev,vp) == (prev,vq)
-  if ( vp != vq || n > 1 )
+
+template <typename C3T3, typename MD, typename Sf, typename Df>
+void
+Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
+plan_balls_on_curve(const Feature_tuple& ft,
+                    const Vertex_handle& vp,
+                    const Vertex_handle& vq,
+                    Curve_queries& queries) const
+{
+  typename GT::Construct_point_3 cp =
+    c3t3_.triangulation().geom_traits().construct_point_3_object();
+
+  const Curve_index& curve_index = std::get<0>(ft);
+  queries.curve_index = curve_index;
+  queries.index = domain_.index_from_curve_index(curve_index);
+
+  if ( ! domain_.is_loop(curve_index) )
   {
-    if(!c3t3_.is_in_complex(prev, vq)) {
-      c3t3_.add_to_complex(prev, vq, curve_index);
-    }
+    const Bare_point p = cp(c3t3_.triangulation().point(vp));
+    const Bare_point q = cp(c3t3_.triangulation().point(vq));
+    const FT sp = get_radius(vp);
+    const FT sq = get_radius(vq);
+    const FT d = domain_curve_segment_length(p, q, curve_index, CGAL::POSITIVE,
+                                             &queries);
+    if(sp <= sq)
+      plan_balls(p, q, sp, sq, d, CGAL::POSITIVE, false, queries);
+    else
+      plan_balls(q, p, sq, sp, d, CGAL::NEGATIVE, false, queries);
+    return;
   }
-  return out;
+
+  // See insert_balls_on_edges()
+  const Bare_point& p = std::get<1>(ft).first;
+  const FT length = curve_length(curve_index, &queries);
+  FT sp;
+  if(vp == Vertex_handle())
+  {
+    const Index& p_index = std::get<1>(ft).second;
+    FT p_size = query_size(p, 1, p_index, &queries);
+    const Bare_point other_point =
+      construct_point_on_curve(p, curve_index, length / 2, &queries);
+    p_size = (std::min)(p_size, compute_distance(p, other_point) / 3);
+    sp = planned_radius(p, CGAL::square(p_size), p_index, queries);
+  }
+  else
+  {
+    sp = get_radius(vp);
+  }
+  plan_balls(p, p, sp, sp, length, CGAL::POSITIVE, true, queries);
+}
+
+
+template <typename C3T3, typename MD, typename Sf, typename Df>
+void
+Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
+plan_balls(const Bare_point& p,
+           const Bare_point& q,
+           const FT sp,
+           const FT sq,
+           const FT d,
+           const CGAL::Orientation d_sign,
+           const bool is_cycle,
+           Curve_queries& queries) const
+{
+  // See insert_balls()
+  if(forced_stop() || !(d > 0))
+    return;
+
+  const FT d_signF = static_cast<FT>(d_sign);
+  int n = static_cast<int>(std::floor(FT(2)*(d-sq) / (sp+sq))+.5);
+
+  if(nonlinear_growth_of_balls && refine_balls_iteration_nb < 3 &&
+     n >= internal::max_nb_vertices_to_reevaluate_size &&
+     d >= (internal::max_nb_vertices_to_reevaluate_size * minimal_weight()))
+  {
+    const Bare_point new_point =
+      construct_point_on_curve(p, queries.curve_index, d_signF * d / 2, &queries);
+    const FT point_weight = CGAL::square(sizing_field(new_point, 1, queries.index,
+                                                      &queries));
+    const FT sn = planned_radius(new_point, point_weight, queries.index, queries);
+    if(sp <= sn)
+      plan_balls(p, new_point, sp, sn, d/2, d_sign, false, queries);
+    else
+      plan_balls(new_point, p, sn, sp, d/2, -d_sign, false, queries);
+    if(sn <= sq)
+      plan_balls(new_point, q, sn, sq, d/2, d_sign, false, queries);
+    else
+      plan_balls(q, new_point, sq, sn, d/2, -d_sign, false, queries);
+    return;
+  }
+
+  std::vector<std::pair<Bare_point, FT> > balls;
+  sample_curve_segment(p, sp, sq, d, d_sign, queries.curve_index, n, is_cycle,
+                       &queries, std::back_inserter(balls));
+  for(const std::pair<Bare_point, FT>& ball : balls)
+    query_size(ball.first, 1, queries.index, &queries);
+}
+
+
+template <typename C3T3, typename MD, typename Sf, typename Df>
+typename Protect_edges_sizing_field<C3T3, MD, Sf, Df>::FT
+Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
+planned_radius(const Bare_point& p, FT w, const Index& index,
+               Curve_queries& queries) const
+{
+  // See smart_insert_point() and insert_point()
+  using CGAL::Mesh_3::internal::weight_modifier;
+
+  w = (std::min)(w, CGAL::square(query_size(p, 1, index, &queries)));
+  if(w < minimal_weight())
+    w = minimal_weight();
+
+  const FT wwm = use_minimal_size()
+               ? (std::max)(w * weight_modifier, minimal_weight())
+               : w * weight_modifier;
+  return CGAL::sqrt(wwm);
+}
+
+
+template <typename C3T3, typename MD, typename Sf, typename Df>
+typename Protect_edges_sizing_field<C3T3, MD, Sf, Df>::Bare_point
+Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
+construct_point_on_curve(const Bare_point& p,
+                         const Curve_index& curve_index,
+                         const FT& distance,
+                         Curve_queries* queries) const
+{
+  if(queries != nullptr)
+  {
+    CGAL_precondition(queries->curve_index == curve_index);
+    auto it = queries->points_on_curve.find(std::make_pair(p, distance));
+    if(it == queries->points_on_curve.end())
+      it = queries->points_on_curve.emplace(std::make_pair(p, distance),
+             domain_.construct_point_on_curve(p, curve_index, distance)).first;
+    return it->second;
+  }
+
+  if(curve_queries_ != nullptr && curve_queries_->curve_index == curve_index)
+  {
+    auto it = curve_queries_->points_on_curve.find(std::make_pair(p, distance));
+    if(it != curve_queries_->points_on_curve.end())
+      return it->second;
+  }
+  return domain_.construct_point_on_curve(p, curve_index, distance);
+}
+
+
+template <typename C3T3, typename MD, typename Sf, typename Df>
+typename Protect_edges_sizing_field<C3T3, MD, Sf, Df>::FT
+Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
+curve_length(const Curve_index& curve_index, Curve_queries* queries) const
+{
+  if(queries != nullptr)
+  {
+    CGAL_precondition(queries->curve_index == curve_index);
+    if(!queries->curve_length)
+      queries->curve_length = domain_.curve_length(curve_index);
+    return *queries->curve_length;
+  }
+
+  if(curve_queries_ != nullptr && curve_queries_->curve_index == curve_index &&
+     curve_queries_->curve_length)
+    return *curve_queries_->curve_length;
+  return domain_.curve_length(curve_index);
+}
+
+
+template <typename C3T3, typename MD, typename Sf, typename Df>
+typename Protect_edges_sizing_field<C3T3, MD, Sf, Df>::FT
+Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
+domain_curve_segment_length(const Bare_point& p,
+                            const Bare_point& q,
+                            const Curve_index& curve_index,
+                            const CGAL::Orientation orientation,
+                            Curve_queries* queries) const
+{
+  const Curve_queries* cached = (queries != nullptr) ? queries : curve_queries_;
+  if(cached != nullptr && cached->curve_index == curve_index)
+  {
+    for(const auto& l : cached->segment_lengths)
+      if(std::get<0>(l) == p && std::get<1>(l) == q && std::get<2>(l) == orientation)
+        return std::get<3>(l);
+  }
+
+  const FT length = domain_.curve_segment_length(p, q, curve_index, orientation);
+  if(queries != nullptr)
+    queries->segment_lengths.emplace_back(p, q, orientation, length);
+  return length;
+}
+
+
+template <typename C3T3, typename MD, typename Sf, typename Df>
+typename Protect_edges_sizing_field<C3T3, MD, Sf, Df>::FT
+Protect_edges_sizing_field<C3T3, MD, Sf, Df>::
+sizing_field(const Bare_point& p, int dim, const Index& index,
+             Curve_queries* queries) const
+{
+  if(queries != nullptr)
+  {
+    if(dim != 1 || !(index == queries->index))
+      return size_(p, dim, index);
+    auto it = queries->sizes.find(p);
+    if(it == queries->sizes.end())
+      it = queries->sizes.emplace(p, size_(p, dim, index)).first;
+    return it->second;
+  }
+
+  if(curve_queries_ != nullptr && dim == 1 && index == curve_queries_->index)
+  {
+    auto it = curve_queries_->sizes.find(p);
+    if(it != curve_queries_->sizes.end())
+      return it->second;
+  }
+  return size_(p, dim, index);
 }
 
 
@@ -1836,10 +2277,10 @@ curve_segment_length(const Vertex_handle v1,
   const Weighted_point& v2_wp = c3t3_.triangulation().point(v2);
 
   FT arc_length = (v1_valid_curve_index && v2_valid_curve_index)
-    ? domain_.curve_segment_length(cp(v1_wp),
-                                   cp(v2_wp),
-                                   curve_index,
-                                   orientation)
+    ? domain_curve_segment_length(cp(v1_wp),
+                                  cp(v2_wp),
+                                  curve_index,
+                                  orientation)
     : compute_distance(v1, v2); //curve polyline may not be consistent
   return arc_length;
 }
@@ -735,7 +735,8 @@ Sliver_perturber(C3T3& c3t3,
                  const Md& domain,
                  const Sc& criterion)
   : Base(c3t3.bbox(),
-         Concurrent_mesher_config::get().locking_grid_num_cells_per_axis)
+         Concurrent_mesher_config::get().locking_grid_num_cells_per_axis_for(
+           c3t3.triangulation().number_of_vertices()))
   , c3t3_(c3t3)
   , tr_(c3t3_.triangulation())
   , domain_(domain)
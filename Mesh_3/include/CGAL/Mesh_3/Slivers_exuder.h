@@ -859,7 +859,8 @@ template <typename C3T3, typename SC, typename V_>
 Slivers_exuder<C3T3,SC,V_>::
 Slivers_exuder(C3T3& c3t3, const SC& criteria, const FT d)
   : Base(c3t3.bbox(),
-         Concurrent_mesher_config::get().locking_grid_num_cells_per_axis)
+         Concurrent_mesher_config::get().locking_grid_num_cells_per_axis_for(
+           c3t3.triangulation().number_of_vertices()))
   , c3t3_(c3t3)
   , tr_(c3t3_.triangulation())
   , sq_delta_(d*d)
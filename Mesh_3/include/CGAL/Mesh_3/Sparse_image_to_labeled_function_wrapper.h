@@ -0,0 +1,176 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+//
+//******************************************************************************
+// File Description :
+// Sparse_image_to_labeled_function_wrapper declaration and implementation. See
+// class description.
+//******************************************************************************
+
+#ifndef CGAL_MESH_3_SPARSE_IMAGE_TO_LABELED_FUNCTION_WRAPPER_H
+#define CGAL_MESH_3_SPARSE_IMAGE_TO_LABELED_FUNCTION_WRAPPER_H
+
+#include <CGAL/license/Mesh_3.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/Sparse_image_3.h>
+#include <CGAL/function_objects.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/enumerable_thread_specific.h>
+#endif
+
+#include <cstddef>
+#include <functional>
+
+namespace CGAL {
+
+namespace Mesh_3 {
+
+/**
+ * @class Sparse_image_to_labeled_function_wrapper
+ *
+ * Same as `Image_to_labeled_function_wrapper`, for a `Sparse_image_3`.
+ * Each thread keeps a cache of the bricks of the image it accessed recently:
+ * the successive queries of the bisection of `Construct_intersection`
+ * are close to each other, and mostly hit the same bricks.
+ */
+template<typename Sparse_image,
+         typename Interpolation_type = typename Sparse_image::word_type,
+         typename Return_type = int,
+         bool labeled_image = true,
+         bool use_trilinear_interpolation=true>
+class Sparse_image_to_labeled_function_wrapper
+{
+public:
+  typedef std::function<Return_type(Interpolation_type)>
+                                                    Image_values_to_labels;
+
+  // Types
+  typedef Return_type return_type;
+  typedef typename Sparse_image::word_type word_type;
+  typedef Sparse_image Image_;
+  typedef typename Sparse_image::Brick_cache Brick_cache;
+
+  /// Constructor
+  Sparse_image_to_labeled_function_wrapper
+  (const Image_& image,
+   Image_values_to_labels transform = Identity<Return_type>(),
+   const Interpolation_type value_outside = Interpolation_type())
+    : r_im_(image)
+    , transform(transform)
+    , value_outside(value_outside)
+  {
+  }
+
+  // Default copy constructor and assignment operator are ok
+
+  /**
+   * Returns an int corresponding to the label at point `p`.
+   * @param p the input point
+   * @return the label at point `p`
+   */
+  template <typename Point_3>
+  return_type operator()(const Point_3& p) const
+  {
+    return eval(p,
+                CGAL::Boolean_tag<use_trilinear_interpolation>(),
+                CGAL::Boolean_tag<labeled_image>());
+  }
+
+private:
+  Brick_cache& cache() const
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    return brick_cache.local();
+#else
+    return brick_cache;
+#endif
+  }
+
+  template <typename Point_3>
+  return_type eval(const Point_3& p,
+                   CGAL::Tag_true /*trilinear*/,
+                   CGAL::Tag_true /*labeled*/) const
+  {
+    return static_cast<return_type>(transform(
+       r_im_.labellized_trilinear_interpolation(
+          CGAL::to_double(p.x()-r_im_.tx()),
+          CGAL::to_double(p.y()-r_im_.ty()),
+          CGAL::to_double(p.z()-r_im_.tz()),
+          value_outside,
+          cache())));
+  }
+
+  template <typename Point_3>
+  return_type eval(const Point_3& p,
+                   CGAL::Tag_true /*trilinear*/,
+                   CGAL::Tag_false /*labeled*/) const
+  {
+    return transform(
+        r_im_.template trilinear_interpolation<Interpolation_type>(
+          CGAL::to_double(p.x()-r_im_.tx()),
+          CGAL::to_double(p.y()-r_im_.ty()),
+          CGAL::to_double(p.z()-r_im_.tz()),
+          value_outside,
+          cache()));
+  }
+
+  template <typename Labeled_tag, typename Point_3>
+  return_type eval(const Point_3& p,
+                   CGAL::Tag_false /*trilinear*/,
+                   Labeled_tag /*labeled*/) const
+  {
+    const std::ptrdiff_t px = static_cast<std::ptrdiff_t>((p.x()-r_im_.tx())/r_im_.vx());
+    const std::ptrdiff_t py = static_cast<std::ptrdiff_t>((p.y()-r_im_.ty())/r_im_.vy());
+    const std::ptrdiff_t pz = static_cast<std::ptrdiff_t>((p.z()-r_im_.tz())/r_im_.vz());
+
+    const std::ptrdiff_t dimx = static_cast<std::ptrdiff_t>(r_im_.xdim());
+    const std::ptrdiff_t dimy = static_cast<std::ptrdiff_t>(r_im_.ydim());
+    const std::ptrdiff_t dimz = static_cast<std::ptrdiff_t>(r_im_.zdim());
+
+    if(px < 0 ||
+       py < 0 ||
+       pz < 0 ||
+       px+1 >= dimx ||
+       py+1 >= dimy ||
+       pz+1 >= dimz)
+    {
+      return 0;
+    }
+
+    return static_cast<return_type>(transform(r_im_.value(px, py, pz, cache())));
+  }
+
+  /// Labeled image to wrap
+  const Image_& r_im_;
+  const Image_values_to_labels transform;
+  const Interpolation_type value_outside;
+
+  /// Bricks accessed recently, per thread
+#ifdef CGAL_LINKED_WITH_TBB
+  mutable tbb::enumerable_thread_specific<Brick_cache> brick_cache;
+#else
+  mutable Brick_cache brick_cache;
+#endif
+
+};  // end class Sparse_image_to_labeled_function_wrapper
+
+
+}  // end namespace Mesh_3
+
+}  // end namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_MESH_3_SPARSE_IMAGE_TO_LABELED_FUNCTION_WRAPPER_H
@@ -70,6 +70,13 @@ template <>
 class Mesh_cell_base_3_base<Parallel_tag>
 {
 public:
+  Mesh_cell_base_3_base() {}
+
+  // the atomic counter is not copyable, its value is (e.g. for temporary copies of cells)
+  Mesh_cell_base_3_base(const Mesh_cell_base_3_base& rhs)
+    : m_erase_counter(rhs.erase_counter())
+  {}
+
   // Erase counter (cf. Compact_container)
   unsigned int erase_counter() const
   {
@@ -25,6 +25,7 @@
 #include <CGAL/Mesh_3/Protect_edges_sizing_field.h>
 #include <CGAL/STL_Extension/internal/Has_features.h>
 #include <CGAL/Mesh_3/C3T3_helpers.h>
+#include <CGAL/Mesh_3/Mesh_statistics.h>
 
 #include <boost/mpl/has_xxx.hpp>
 
@@ -221,6 +222,8 @@ struct C3t3_initializer < C3T3, MD, MC, false, HasFeatures >
                 << " without features !" << std::endl;
     }
 
+    auto recorder = record_phase(mesh_options.pointer_to_statistics,
+                                 &Mesh_statistics::initialization, c3t3.triangulation());
     init_c3t3(c3t3,domain,criteria,
               mesh_options.number_of_initial_points);
   }
@@ -260,7 +263,11 @@ struct C3t3_initializer < C3T3, MD, MC, true, CGAL::Tag_true >
                   Mesh_3_options mesh_options = Mesh_3_options())
   {
     if ( with_features ) {
-      this->initialize_features(c3t3, domain, criteria,mesh_options);
+      {
+        auto recorder = record_phase(mesh_options.pointer_to_statistics,
+                                     &Mesh_statistics::protection, c3t3.triangulation());
+        this->initialize_features(c3t3, domain, criteria,mesh_options);
+      }
 
       // If c3t3 initialization is not sufficient (may happen if there is only
       // a planar curve as feature for example), add some surface points
@@ -282,12 +289,18 @@ struct C3t3_initializer < C3T3, MD, MC, true, CGAL::Tag_true >
         }
       }
       if(need_more_init) {
+        auto recorder = record_phase(mesh_options.pointer_to_statistics,
+                                     &Mesh_statistics::initialization, c3t3.triangulation());
         init_c3t3(c3t3, domain, criteria,
                   mesh_options.number_of_initial_points);
       }
     }
-    else { init_c3t3(c3t3,domain,criteria,
-                     mesh_options.number_of_initial_points); }
+    else {
+      auto recorder = record_phase(mesh_options.pointer_to_statistics,
+                                   &Mesh_statistics::initialization, c3t3.triangulation());
+      init_c3t3(c3t3,domain,criteria,
+                mesh_options.number_of_initial_points);
+    }
   }
 };
 
@@ -310,6 +323,8 @@ struct C3t3_initializer < C3T3, MD, MC, true, CGAL::Tag_false >
                 << " without features !" << std::endl;
     }
 
+    auto recorder = record_phase(mesh_options.pointer_to_statistics,
+                                 &Mesh_statistics::initialization, c3t3.triangulation());
     init_c3t3(c3t3,domain,criteria,
               mesh_options.number_of_initial_points);
   }
@@ -442,6 +457,14 @@ struct C3t3_initializer < C3T3, MD, MC, true, CGAL::Tag_false >
  *                           </UL>}
  *     \cgalParamDefault{`parameters::exude()`}
  *   \cgalParamSectionEnd
+ *   \cgalParamSectionBegin{Statistics}
+ *     \cgalParamDescription{`parameters::statistics(s)`, where `s` is a pointer to a `Mesh_3::Mesh_statistics`,
+ *                           fills `s` with the time, the number of insertions, the number of lock conflicts
+ *                           and the maximal size of the refinement queue of each phase of the mesh generation,
+ *                           and with the peak memory of the process.}
+ *     \cgalParamType{`Mesh_3::Mesh_statistics*`}
+ *     \cgalParamDefault{`nullptr`: no statistics are gathered}
+ *   \cgalParamSectionEnd
  * \cgalNamedParamsEnd
  *
  * Note that regardless of which optimization processes are activated,
@@ -476,6 +499,7 @@ C3T3 make_mesh_3(const MeshDomain& domain, const MeshCriteria& criteria, const C
     parameters::internal::Lloyd_options lloyd_param = choose_parameter(get_parameter(np, internal_np::lloyd_options_param), parameters::no_lloyd().v);
     parameters::internal::Features_options features_param = choose_parameter(get_parameter(np, internal_np::features_options_param), parameters::features(domain).v);
     parameters::internal::Mesh_3_options mesh_options_param = choose_parameter(get_parameter(np, internal_np::mesh_param), parameters::internal::Mesh_3_options());
+    mesh_options_param.pointer_to_statistics = choose_parameter(get_parameter(np, internal_np::statistics_param), mesh_options_param.pointer_to_statistics);
     parameters::internal::Manifold_options manifold_options_param = choose_parameter(get_parameter(np, internal_np::manifold_param), parameters::internal::Manifold_options());
 
     make_mesh_3_impl(c3t3, domain, criteria,
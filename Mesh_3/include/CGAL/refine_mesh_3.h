@@ -22,6 +22,7 @@
 #include <CGAL/config.h>
 #include <CGAL/Mesh_3/config.h>
 #include <CGAL/Mesh_3/Mesher_3.h>
+#include <CGAL/Mesh_3/Mesh_statistics.h>
 #include <CGAL/Mesh_error_code.h>
 #include <CGAL/optimize_mesh_3.h>
 #include <CGAL/SMDS_3/Dump_c3t3.h>
@@ -224,6 +225,14 @@ private:
  *                           </UL>}
  *     \cgalParamDefault{`parameters::exude()`}
  *   \cgalParamSectionEnd
+ *   \cgalParamSectionBegin{Statistics}
+ *     \cgalParamDescription{`parameters::statistics(s)`, where `s` is a pointer to a `Mesh_3::Mesh_statistics`,
+ *                           fills `s` with the time, the number of insertions, the number of lock conflicts
+ *                           and the maximal size of the refinement queue of each phase of the mesh generation,
+ *                           and with the peak memory of the process.}
+ *     \cgalParamType{`Mesh_3::Mesh_statistics*`}
+ *     \cgalParamDefault{`nullptr`: no statistics are gathered}
+ *   \cgalParamSectionEnd
  * \cgalNamedParamsEnd
  *
  * The optimization parameters can be passed in arbitrary order. If one parameter
@@ -271,6 +280,7 @@ void refine_mesh_3(C3T3& c3t3, const MeshDomain& domain, const MeshCriteria& cri
     parameters::internal::Lloyd_options lloyd_param = choose_parameter(get_parameter(np, internal_np::lloyd_options_param), parameters::no_lloyd().v);
     bool reset = choose_parameter(get_parameter(np, internal_np::do_reset_c3t3), false);
     parameters::internal::Mesh_3_options mesh_options_param = choose_parameter(get_parameter(np, internal_np::mesh_param), parameters::internal::Mesh_3_options());
+    mesh_options_param.pointer_to_statistics = choose_parameter(get_parameter(np, internal_np::statistics_param), mesh_options_param.pointer_to_statistics);
     parameters::internal::Manifold_options manifold_options_param = choose_parameter(get_parameter(np, internal_np::manifold_param), parameters::internal::Manifold_options());
 
     return refine_mesh_3_impl(c3t3,
@@ -333,6 +343,9 @@ void refine_mesh_3_impl(C3T3& c3t3,
   // and any change to this function should likely be ported to the periodic version.
 
   typedef Mesh_3::Mesher_3<C3T3, MeshCriteria, MeshDomain> Mesher;
+  typedef Mesh_3::Mesh_statistics Mesh_statistics;
+  Mesh_statistics* statistics = mesh_options.pointer_to_statistics;
+  const typename C3T3::Triangulation& tr = c3t3.triangulation();
 
   // Reset c3t3 (i.e. remove weights) if needed
   if ( reset_c3t3 )
@@ -355,6 +368,7 @@ void refine_mesh_3_impl(C3T3& c3t3,
                  , mesh_options.pointer_to_stop_atomic_boolean
 #endif
                  );
+  mesher.set_statistics(statistics);
   double refine_time = mesher.refine_mesh(mesh_options.dump_after_refine_surface_prefix);
   c3t3.clear_manifold_info();
 
@@ -363,23 +377,31 @@ void refine_mesh_3_impl(C3T3& c3t3,
   // Odt
   if ( odt )
   {
+    auto recorder = Mesh_3::internal::record_phase(statistics, &Mesh_statistics::odt, tr, false);
+    Mesh_optimization_return_code rc =
     odt_optimize_mesh_3(c3t3,
                         domain,
                         parameters::time_limit = odt.time_limit(),
                         parameters::max_iteration_number = odt.max_iteration_number(),
                         parameters::convergence = odt.convergence(),
                         parameters::freeze_bound = odt.bound());
+    if(statistics != nullptr)
+      statistics->odt.return_code = rc;
   }
 
   // Lloyd
   if ( lloyd )
   {
+    auto recorder = Mesh_3::internal::record_phase(statistics, &Mesh_statistics::lloyd, tr, false);
+    Mesh_optimization_return_code rc =
     lloyd_optimize_mesh_3(c3t3,
                           domain,
                           parameters::time_limit = lloyd.time_limit(),
                           parameters::max_iteration_number = lloyd.max_iteration_number(),
                           parameters::convergence = lloyd.convergence(),
                           parameters::freeze_bound = lloyd.bound());
+    if(statistics != nullptr)
+      statistics->lloyd.return_code = rc;
   }
 
   if( odt || lloyd) {
@@ -394,10 +416,15 @@ void refine_mesh_3_impl(C3T3& c3t3,
     if ( perturb.is_time_limit_set() )
       perturb_time_limit = perturb.time_limit();
 
+    auto recorder = Mesh_3::internal::record_phase(statistics, &Mesh_statistics::perturbation, tr, false);
+    Mesh_optimization_return_code rc =
     perturb_mesh_3(c3t3,
                    domain,
                    parameters::time_limit = perturb_time_limit,
                    parameters::sliver_bound = perturb.bound());
+    if(statistics != nullptr)
+      statistics->perturbation.return_code = rc;
+    recorder.stop();
 
     dump_c3t3(c3t3, mesh_options.dump_after_perturb_prefix);
   }
@@ -410,12 +437,19 @@ void refine_mesh_3_impl(C3T3& c3t3,
     if ( exude.is_time_limit_set() )
       exude_time_limit = exude.time_limit();
 
+    auto recorder = Mesh_3::internal::record_phase(statistics, &Mesh_statistics::exudation, tr, false);
+    Mesh_optimization_return_code rc =
     exude_mesh_3(c3t3,
                  parameters::time_limit = exude_time_limit,
                  parameters::sliver_bound = exude.bound());
+    if(statistics != nullptr)
+      statistics->exudation.return_code = rc;
+    recorder.stop();
 
     dump_c3t3(c3t3, mesh_options.dump_after_exude_prefix);
   }
+
+  Mesh_3::internal::update_peak_memory(statistics);
 }
 #endif // DOXYGEN_RUNNING
 } // end namespace CGAL
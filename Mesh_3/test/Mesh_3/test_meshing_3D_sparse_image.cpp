@@ -0,0 +1,88 @@
+#include "test_meshing_utilities.h"
+#include <CGAL/Image_3.h>
+#include <CGAL/Sparse_image_3.h>
+#include <CGAL/Labeled_mesh_domain_3.h>
+#include <CGAL/Random.h>
+
+// Checks that a domain created from a `Sparse_image_3` has the same labels
+// as the domain created from the dense image, and that it can be meshed.
+
+template <typename Concurrency_tag = CGAL::Sequential_tag>
+struct Sparse_image_tester : public Tester<K_e_i>
+{
+public:
+  void image() const
+  {
+    typedef CGAL::Sparse_image_3<unsigned char> Sparse_image;
+    typedef CGAL::Labeled_mesh_domain_3<K_e_i> Mesh_domain;
+
+    typedef typename CGAL::Mesh_triangulation_3<
+      Mesh_domain,
+      CGAL::Kernel_traits<Mesh_domain>::Kernel,
+      Concurrency_tag>::type Tr;
+    typedef CGAL::Mesh_complex_3_in_triangulation_3<Tr> C3t3;
+
+    typedef CGAL::Mesh_criteria_3<Tr> Mesh_criteria;
+    typedef typename Mesh_criteria::Facet_criteria Facet_criteria;
+    typedef typename Mesh_criteria::Cell_criteria Cell_criteria;
+
+    //-------------------------------------------------------
+    // Data generation
+    //-------------------------------------------------------
+    CGAL::Image_3 image;
+    image.read(CGAL::data_file_path("images/liver.inr.gz"));
+    Sparse_image sparse_image(image);
+
+    std::cout << "\t" << sparse_image.number_of_stored_bricks() << " stored bricks out of "
+              << sparse_image.number_of_bricks() << std::endl;
+    assert(sparse_image.number_of_stored_bricks() < sparse_image.number_of_bricks());
+
+    Mesh_domain domain = Mesh_domain::create_labeled_image_mesh_domain
+      (sparse_image,
+       CGAL::parameters::relative_error_bound = 1e-6,
+       CGAL::parameters::p_rng = &CGAL::get_default_random());
+
+    // the labels are the ones of the dense image
+    Mesh_domain dense_domain = Mesh_domain::create_labeled_image_mesh_domain(image);
+    const CGAL::Bbox_3 bbox = domain.bbox();
+    CGAL::Random rng(0);
+    for(int i=0; i<100000; ++i)
+    {
+      const typename Mesh_domain::Point_3 p(rng.get_double(bbox.xmin(), bbox.xmax()),
+                                            rng.get_double(bbox.ymin(), bbox.ymax()),
+                                            rng.get_double(bbox.zmin(), bbox.zmax()));
+      assert(domain.is_in_domain_object()(p) == dense_domain.is_in_domain_object()(p));
+    }
+
+    // Set mesh criteria
+    Facet_criteria facet_criteria(25, 20*image.vx(), 5*image.vx());
+    Cell_criteria cell_criteria(4, 25*image.vx());
+    Mesh_criteria criteria(facet_criteria, cell_criteria);
+
+    // Mesh generation
+    C3t3 c3t3 = CGAL::make_mesh_3<C3t3>(domain, criteria,
+                                        CGAL::parameters::no_exude(),
+                                        CGAL::parameters::no_perturb());
+
+    c3t3.remove_isolated_vertices();
+
+    // Verify
+    this->verify_c3t3_volume(c3t3, 1772330*0.95, 1772330*1.05);
+    this->verify(c3t3,domain,criteria, Bissection_tag());
+  }
+};
+
+int main()
+{
+  Sparse_image_tester<> test_epic;
+  std::cerr << "Mesh generation from a sparse 3D image:\n";
+  test_epic.image();
+
+#ifdef CGAL_LINKED_WITH_TBB
+  Sparse_image_tester<CGAL::Parallel_tag> test_epic_p;
+  std::cerr << "Parallel mesh generation from a sparse 3D image:\n";
+  test_epic_p.image();
+#endif
+
+  return EXIT_SUCCESS;
+}
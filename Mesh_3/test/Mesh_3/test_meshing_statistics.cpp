@@ -0,0 +1,107 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Mesh_triangulation_3.h>
+#include <CGAL/Mesh_complex_3_in_triangulation_3.h>
+#include <CGAL/Mesh_criteria_3.h>
+
+#include <CGAL/Labeled_mesh_domain_3.h>
+#include <CGAL/Mesh_3/Mesh_statistics.h>
+#include <CGAL/make_mesh_3.h>
+#include <CGAL/refine_mesh_3.h>
+
+#include <cassert>
+#include <iostream>
+
+// Checks the statistics gathered with the named parameter `statistics`.
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::FT FT;
+typedef K::Point_3 Point;
+typedef CGAL::Labeled_mesh_domain_3<K> Mesh_domain;
+
+FT sphere_function(const Point& p)
+{
+  return CGAL::squared_distance(p, Point(CGAL::ORIGIN)) - 1;
+}
+
+template <typename Concurrency_tag>
+void test()
+{
+  typedef typename CGAL::Mesh_triangulation_3<Mesh_domain, CGAL::Default, Concurrency_tag>::type Tr;
+  typedef CGAL::Mesh_complex_3_in_triangulation_3<Tr> C3t3;
+  typedef CGAL::Mesh_criteria_3<Tr> Mesh_criteria;
+  typedef CGAL::Mesh_3::Mesh_statistics Mesh_statistics;
+
+  namespace params = CGAL::parameters;
+
+  Mesh_domain domain =
+    Mesh_domain::create_implicit_mesh_domain(sphere_function,
+                                             K::Sphere_3(CGAL::ORIGIN, K::FT(2)),
+                                             params::relative_error_bound(1e-6));
+
+  Mesh_criteria criteria(params::facet_angle(30).facet_size(0.1).facet_distance(0.025)
+                                .cell_radius_edge_ratio(2).cell_size(0.1));
+
+  Mesh_statistics statistics;
+  C3t3 c3t3 = CGAL::make_mesh_3<C3t3>(domain, criteria,
+                                      params::no_exude(),
+                                      params::odt(params::max_iteration_number = 2),
+                                      params::statistics = &statistics);
+
+  std::cout << statistics;
+
+  const std::size_t nv = c3t3.triangulation().number_of_vertices();
+  assert(statistics.initialization.number_of_vertices > 0);
+  assert(statistics.facet_refinement.number_of_insertions > 0);
+  assert(statistics.facet_refinement.maximal_queue_size > 0);
+  assert(statistics.cell_refinement.number_of_insertions > 0);
+  assert(statistics.initialization.number_of_vertices
+           + statistics.facet_refinement.number_of_insertions
+           + statistics.cell_refinement.number_of_insertions == statistics.cell_refinement.number_of_vertices);
+  assert(statistics.odt.return_code != CGAL::MESH_OPTIMIZATION_UNKNOWN_ERROR);
+  assert(statistics.perturbation.return_code != CGAL::MESH_OPTIMIZATION_UNKNOWN_ERROR);
+  assert(statistics.perturbation.number_of_vertices == nv);
+  assert(statistics.exudation.time == 0.);
+  assert(statistics.total_time() > 0.);
+#ifdef __linux__
+  assert(statistics.peak_memory > 0);
+#endif
+
+  if(std::is_same<Concurrency_tag, CGAL::Sequential_tag>::value)
+  {
+    assert(statistics.facet_refinement.number_of_lock_conflicts == 0);
+    assert(statistics.cell_refinement.number_of_rollbacks == 0);
+  }
+
+  // the values are accumulated by subsequent calls
+  Mesh_criteria finer_criteria(params::facet_angle(30).facet_size(0.05).facet_distance(0.025)
+                                      .cell_radius_edge_ratio(2).cell_size(0.05));
+  const Mesh_statistics coarse_statistics = statistics;
+  CGAL::refine_mesh_3(c3t3, domain, finer_criteria,
+                      params::no_perturb(), params::no_exude(),
+                      params::statistics = &statistics);
+
+  assert(statistics.facet_refinement.number_of_insertions
+           + statistics.cell_refinement.number_of_insertions
+         == coarse_statistics.facet_refinement.number_of_insertions
+              + coarse_statistics.cell_refinement.number_of_insertions
+              + c3t3.triangulation().number_of_vertices() - nv);
+  assert(statistics.cell_refinement.time > coarse_statistics.cell_refinement.time);
+
+  // without statistics
+  C3t3 c3t3_bis = CGAL::make_mesh_3<C3t3>(domain, criteria, params::no_exude(), params::no_perturb());
+  assert(c3t3_bis.triangulation().number_of_vertices() > 0);
+}
+
+int main()
+{
+  std::cout << "Sequential mesh generation" << std::endl;
+  test<CGAL::Sequential_tag>();
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel mesh generation" << std::endl;
+  test<CGAL::Parallel_tag>();
+#endif
+
+  return EXIT_SUCCESS;
+}
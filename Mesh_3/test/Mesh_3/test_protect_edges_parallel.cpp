@@ -0,0 +1,129 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Mesh_triangulation_3.h>
+#include <CGAL/Mesh_complex_3_in_triangulation_3.h>
+
+#include <CGAL/Polyhedral_mesh_domain_with_features_3.h>
+#include <CGAL/Mesh_3/Protect_edges_sizing_field.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Checks that the protection of the features gives the same balls
+// with `Sequential_tag` and with `Parallel_tag`.
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef CGAL::Polyhedral_mesh_domain_with_features_3<K> Mesh_domain;
+typedef CGAL::Mesh_polyhedron_3<K>::type Polyhedron;
+typedef K::Point_3 Point;
+
+typedef std::vector<Point> Polyline;
+typedef std::vector<Polyline> Polylines;
+
+// A non-uniform sizing field, so that the sizes of the balls are
+// reevaluated along the curves
+struct Sizing_field
+{
+  typedef K::FT FT;
+
+  template <typename Index>
+  FT operator()(const Point& p, const int, const Index&) const
+  {
+    return 0.005 + 0.02 * std::abs(p.x());
+  }
+};
+
+typedef std::tuple<double, double, double, double> Ball;
+typedef std::set<Ball> Balls;
+typedef std::set<std::pair<Ball, Ball> > Edges;
+
+template <typename Concurrency_tag>
+void protect(const Mesh_domain& domain, Balls& balls, Edges& edges)
+{
+  typedef typename CGAL::Mesh_triangulation_3<Mesh_domain, CGAL::Default,
+                                              Concurrency_tag>::type Tr;
+  typedef CGAL::Mesh_complex_3_in_triangulation_3<
+    Tr, Mesh_domain::Corner_index, Mesh_domain::Curve_index> C3t3;
+  typedef typename Tr::Vertex_handle Vertex_handle;
+
+  C3t3 c3t3;
+  CGAL::Mesh_3::Protect_edges_sizing_field<C3t3, Mesh_domain, Sizing_field>
+    protect_edges(c3t3, domain, Sizing_field());
+  protect_edges(true);
+
+  auto ball = [&](Vertex_handle v)
+  {
+    const typename Tr::Weighted_point& wp = c3t3.triangulation().point(v);
+    return Ball(wp.x(), wp.y(), wp.z(), wp.weight());
+  };
+
+  for(Vertex_handle v : c3t3.triangulation().finite_vertex_handles())
+    balls.insert(ball(v));
+  for(auto e : c3t3.edges_in_complex())
+  {
+    Ball b1 = ball(e.first->vertex(e.second));
+    Ball b2 = ball(e.first->vertex(e.third));
+    if(b2 < b1)
+      std::swap(b1, b2);
+    edges.insert(std::make_pair(b1, b2));
+  }
+}
+
+int main()
+{
+  Polyhedron p;
+  p.make_tetrahedron(Point(-1, -1, -1),
+                     Point(1, -1, -1),
+                     Point(-1, 1, -1),
+                     Point(-1, -1, 1));
+  Mesh_domain domain(p);
+
+  Polylines polylines;
+
+  // curves sharing a corner
+  for(int i = 0; i < 3; ++i)
+  {
+    Polyline wave;
+    for(int j = 0; j <= 400; ++j)
+    {
+      const double t = j / 400.;
+      wave.push_back(Point(-0.9 + 1.8 * t,
+                           0.3 * (i - 1) * t,
+                           0.1 * std::sin(10 * t)));
+    }
+    polylines.push_back(wave);
+  }
+
+  // a cycle
+  Polyline circle;
+  for(int j = 0; j < 300; ++j)
+  {
+    const double t = 2 * CGAL_PI * j / 300.;
+    circle.push_back(Point(0.5 * std::cos(t), 0.5 * std::sin(t), 0.5));
+  }
+  circle.push_back(circle.front());
+  polylines.push_back(circle);
+
+  domain.add_features(polylines.begin(), polylines.end());
+
+  Balls sequential_balls, parallel_balls;
+  Edges sequential_edges, parallel_edges;
+  protect<CGAL::Sequential_tag>(domain, sequential_balls, sequential_edges);
+  std::cout << sequential_balls.size() << " balls, "
+            << sequential_edges.size() << " edges" << std::endl;
+  assert(sequential_balls.size() > 100);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  protect<CGAL::Parallel_tag>(domain, parallel_balls, parallel_edges);
+  assert(parallel_balls == sequential_balls);
+  assert(parallel_edges == sequential_edges);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
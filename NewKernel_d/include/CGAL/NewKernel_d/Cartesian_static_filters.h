@@ -18,6 +18,12 @@
 #include <CGAL/Filtered_kernel/internal/Static_filters/Side_of_oriented_circle_2.h>
 #include <CGAL/Filtered_kernel/internal/Static_filters/Orientation_3.h>
 #include <CGAL/Filtered_kernel/internal/Static_filters/Side_of_oriented_sphere_3.h>
+#include <CGAL/Uncertain.h>
+#include <CGAL/type_traits.h>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <utility>
 
 namespace CGAL {
 namespace SFA { // static filter adapter
@@ -147,6 +153,170 @@ template <class Base_,class R_> struct Side_of_oriented_sphere_3 : private Store
                 return typename internal::Static_filters_predicates::Side_of_oriented_sphere_3<Adapter>()(P(this->kernel(),c,A),P(this->kernel(),c,B),P(this->kernel(),c,C),P(this->kernel(),c,D),P(this->kernel(),c,E));
         }
 };
+
+// Semi-static filter for the sign of the determinant of a N*N matrix (row major)
+// of doubles, used in dimensions 4 to 8 where there is no hand-written static filter.
+// The determinant is expanded along its rows: the minors of the last k rows are computed
+// for all the subsets of k columns, from k=1 to N, which takes N*2^(N-1) products.
+// The depth of this evaluation is N(N+1)/2-1, so its error is at most
+// gamma_{N(N+1)/2-1} N! prod_j max_i |m_ij|. The entries of the matrix are computed from
+// the input coordinates with a relative error at most gamma_{leaf_depth}, which adds
+// 2 N leaf_depth to the depth. The filter fails if the maximum of a column is not in
+// [lower, upper], which protects against underflow and overflow (and NaN).
+template <int N, int leaf_depth> class Semi_static_sign_of_determinant {
+        static constexpr int size = 1 << N;
+
+        static constexpr double power_of_two(int e) {
+                double r = 1;
+                for(; e > 0; --e) r *= 2;
+                for(; e < 0; ++e) r /= 2;
+                return r;
+        }
+        static constexpr double epsilon() {
+                const int k = N * (N + 1) / 2 - 1 + 2 * N * leaf_depth;
+                const double u = power_of_two(-53);
+                double f = 1;
+                for(int i = 2; i <= N; ++i) f *= i;
+                // the slack covers the rounding of the bound itself
+                return f * (k * u / (1 - k * u)) * (1 + power_of_two(-30));
+        }
+        static constexpr int binomial(int n, int k) {
+                int r = 1;
+                for(int i = 1; i <= k; ++i) r = r * (n - k + i) / i;
+                return r;
+        }
+
+        // The minors of the last k rows: the subsets of k columns, as bit masks,
+        // and their columns in increasing order.
+        template <int k> struct Minors {
+                static constexpr int number = binomial(N, k);
+                struct Minor { int mask; std::array<int, k> columns; };
+                static constexpr std::array<Minor, number> table() {
+                        std::array<Minor, number> t{};
+                        int n = 0;
+                        for(int mask = 1; mask < size; ++mask) {
+                                int c = 0;
+                                for(int j = 0; j < N; ++j)
+                                        if(mask & (1 << j)) ++c;
+                                if(c != k) continue;
+                                t[n].mask = mask;
+                                c = 0;
+                                for(int j = 0; j < N; ++j)
+                                        if(mask & (1 << j)) t[n].columns[c++] = j;
+                                ++n;
+                        }
+                        return t;
+                }
+                static constexpr std::array<Minor, number> minors = table();
+
+        };
+
+        // minor[mask] = sum_i (-1)^i row[j_i] minor[mask - j_i], with constant indices
+        // so that the whole expansion is straight-line code
+        template <int k, int n, int i>
+        static double term(double const* row, double const* minor) {
+                constexpr int j = Minors<k>::minors[n].columns[i];
+                constexpr int sub = Minors<k>::minors[n].mask ^ (1 << j);
+                return row[j] * minor[sub];
+        }
+        template <int k, int n, std::size_t... i>
+        static void compute_minor(double const* row, double* minor, std::index_sequence<i...>) {
+                double s = term<k, n, 0>(row, minor);
+                ((s = (i % 2) ? s + term<k, n, i + 1>(row, minor)
+                              : s - term<k, n, i + 1>(row, minor)), ...);
+                minor[Minors<k>::minors[n].mask] = s;
+        }
+        template <int k, std::size_t... n>
+        static void compute_minors(double const* row, double* minor, std::index_sequence<n...>) {
+                (compute_minor<k, n>(row, minor, std::make_index_sequence<k - 1>()), ...);
+        }
+        template <int k> static void compute(std::array<double, N*N> const& m, double* minor) {
+                if constexpr (k <= N) {
+                        compute_minors<k>(&m[(N - k) * N], minor, std::make_index_sequence<Minors<k>::number>());
+                        compute<k + 1>(m, minor);
+                }
+        }
+
+public:
+        static Uncertain<Sign> sign(std::array<double, N*N> const& m) {
+                // lower^N * epsilon is far above the errors due to underflow,
+                // and N! upper^N is below the largest double.
+                constexpr double lower = power_of_two(-(900 / N));
+                constexpr double upper = power_of_two(980 / N);
+
+                double bound = epsilon();
+                for(int j = 0; j < N; ++j) {
+                        double maxj = std::fabs(m[j]);
+                        for(int i = 1; i < N; ++i)
+                                maxj = (std::max)(maxj, std::fabs(m[i * N + j]));
+                        if(!(maxj >= lower && maxj <= upper))
+                                return Uncertain<Sign>::indeterminate();
+                        bound *= maxj;
+                }
+
+                std::array<double, size> minor;
+                for(int j = 0; j < N; ++j)
+                        minor[1 << j] = m[(N - 1) * N + j];
+                compute<2>(m, minor.data());
+
+                const double det = minor[size - 1];
+                if(det > bound) return POSITIVE;
+                if(det < -bound) return NEGATIVE;
+                return Uncertain<Sign>::indeterminate();
+        }
+};
+
+template <class Base_,class R_,int d> struct Orientation_of_points_d : private Store_kernel<R_> {
+        CGAL_FUNCTOR_INIT_STORE(Orientation_of_points_d)
+        typedef typename Get_type<R_, Point_tag>::type Point;
+        typedef typename Get_type<R_, Orientation_tag>::type result_type;
+        typedef typename Get_functor<R_, Compute_point_cartesian_coordinate_tag>::type CC;
+        typedef typename Get_functor<Base_, Orientation_of_points_tag>::type Orientation_base;
+        template<class Iter> result_type operator()(Iter f, Iter e)const{
+                CC c(this->kernel());
+                std::array<double, d*d> m;
+                Iter it = f;
+                Point const& p0=*it;
+                for(int i=0;i<d;++i) {
+                        Point const& p=*++it;
+                        for(int j=0;j<d;++j)
+                                m[i*d+j]=c(p,j)-c(p0,j);
+                }
+                CGAL_assertion(++it==e);
+                const Uncertain<Sign> s = Semi_static_sign_of_determinant<d,1>::sign(m);
+                if(is_certain(s))
+                        return get_certain(s);
+                return Orientation_base(this->kernel())(f,e);
+        }
+};
+template <class Base_,class R_,int d> struct Side_of_oriented_sphere_d : private Store_kernel<R_> {
+        CGAL_FUNCTOR_INIT_STORE(Side_of_oriented_sphere_d)
+        typedef typename Get_type<R_, Point_tag>::type Point;
+        typedef typename Get_type<R_, Oriented_side_tag>::type result_type;
+        typedef typename Get_functor<R_, Compute_point_cartesian_coordinate_tag>::type CC;
+        typedef typename Get_functor<Base_, Side_of_oriented_sphere_tag>::type Side_of_oriented_sphere_base;
+        template<class Iter> result_type operator()(Iter f, Iter e, Point const& p0)const{
+                CC c(this->kernel());
+                std::array<double, (d+1)*(d+1)> m;
+                Iter it = f;
+                for(int i=0;i<=d;++i,++it) {
+                        Point const& p=*it;
+                        double l = 0;
+                        for(int j=0;j<d;++j) {
+                                const double x = c(p,j)-c(p0,j);
+                                m[i*(d+1)+j] = x;
+                                l += x*x;
+                        }
+                        m[i*(d+1)+d] = l;
+                }
+                CGAL_assertion(it==e);
+                // the lifted column is computed with d+1 operations
+                const Uncertain<Sign> s = Semi_static_sign_of_determinant<d+1,d+1>::sign(m);
+                if(is_certain(s))
+                        return (d%2) ? -get_certain(s) : get_certain(s);
+                return Side_of_oriented_sphere_base(this->kernel())(f,e,p0);
+        }
+};
 } // namespace SFA
 
 template <class Dim_ /* should be implicit */, class R_, class Derived_=Default>
@@ -190,5 +360,25 @@ struct Cartesian_static_filters<Dimension_tag<3>, R_, Derived_> : public R_ {
                 typedef SFA::Side_of_oriented_sphere_3<R_,Derived> type;
         };
 };
+
+// No hand-written filters in the other dimensions, only the semi-static ones from 4 to 8,
+// beyond which the bound of the error becomes too pessimistic.
+template <int d, class R_, class Derived_>
+struct Cartesian_static_filters<Dimension_tag<d>, R_, Derived_> : public R_ {
+  constexpr Cartesian_static_filters(){}
+  constexpr Cartesian_static_filters(int d_):R_(d_){}
+        typedef Cartesian_static_filters<Dimension_tag<d>, R_, Derived_> Self;
+        typedef typename Default::Get<Derived_,Self>::type Derived;
+        static constexpr bool filtered = (d >= 4 && d <= 8);
+        template <class T, class=void> struct Functor : Inherit_functor<R_, T> {};
+        template <class D> struct Functor <Orientation_of_points_tag,D>
+        : std::conditional_t<filtered,
+                             cpp20::type_identity<SFA::Orientation_of_points_d<R_,Derived,d> >,
+                             Inherit_functor<R_, Orientation_of_points_tag> > {};
+        template <class D> struct Functor <Side_of_oriented_sphere_tag,D>
+        : std::conditional_t<filtered,
+                             cpp20::type_identity<SFA::Side_of_oriented_sphere_d<R_,Derived,d> >,
+                             Inherit_functor<R_, Side_of_oriented_sphere_tag> > {};
+};
 } // namespace CGAL
 #endif
@@ -131,7 +131,7 @@ class Lazy_rep_XXX :
   const EC& ec() const { return *this; }
   template<class...T>
   void update_exact_helper(Lazy_internal::typelist<T...>) const {
-    auto* p = new typename Base::Indirect(ec()( CGAL::exact( Lazy_internal::do_extract(T{},l) ) ... ) );
+    auto* p = Base::new_indirect(ec()( CGAL::exact( Lazy_internal::do_extract(T{},l) ) ... ) );
     this->set_at(p);
     this->set_ptr(p);
     lazy_reset_member(l);
@@ -14,6 +14,7 @@
 #include <CGAL/Exact_rational.h>
 #include <CGAL/Interval_nt.h>
 #include <CGAL/use.h>
+#include <CGAL/Random.h>
 #include <iostream>
 #include <sstream>
 #include <CGAL/NewKernel_d/Types/Weighted_point.h>
@@ -734,6 +735,71 @@ void test4(){
     assert(ar(CGAL::make_transforming_iterator(tab4+0,drop), CGAL::make_transforming_iterator(tab4+i+1,drop))==i-1);
   }
 }
+// The static filters of Orientation_d and Side_of_oriented_sphere_d in fixed dimension
+// must agree with the dynamic dimension kernel, which does not have them.
+template<int D>
+void test_static_filters(){
+  typedef CGAL::Epick_d<CGAL::Dimension_tag<D> > Ks;
+  typedef CGAL::Epick_d<CGAL::Dynamic_dimension_tag> Kd;
+  typedef typename Ks::Point_d Ps;
+  typedef typename Kd::Point_d Pd;
+  Ks ks; Kd kd(D);
+  auto pos = ks.orientation_d_object();
+  auto pod = kd.orientation_d_object();
+  auto soss = ks.side_of_oriented_sphere_d_object();
+  auto sosd = kd.side_of_oriented_sphere_d_object();
+  auto check=[&](std::vector<std::array<double,D> > const& c, int expected_orientation, int expected_side){
+    std::vector<Ps> ps; std::vector<Pd> pd;
+    for(auto const& x : c) { ps.emplace_back(x.begin(), x.end()); pd.emplace_back(x.begin(), x.end()); }
+    CGAL::Orientation o = pos(ps.begin(), ps.begin()+D+1);
+    assert(o == pod(pd.begin(), pd.begin()+D+1));
+    assert(expected_orientation == 2 || o == expected_orientation);
+    CGAL::Oriented_side s = soss(ps.begin(), ps.begin()+D+1, ps[D+1]);
+    assert(s == sosd(pd.begin(), pd.begin()+D+1, pd[D+1]));
+    assert(expected_side == 2 || s == expected_side);
+  };
+  CGAL::Random rng(D);
+  std::vector<std::array<double,D> > c(D+2);
+  // random points, decided by the filters
+  for(int r=0; r<100; ++r) {
+    for(auto& x : c) for(double& y : x) y = rng.get_double(-1, 1);
+    check(c, 2, 2);
+  }
+  // the unit vectors, with the origin inside and outside of their sphere
+  for(int i=0; i<=D; ++i) for(int j=0; j<D; ++j) c[i][j] = (i == j+1);
+  for(int j=0; j<D; ++j) c[D+1][j] = 1. / D;
+  check(c, CGAL::POSITIVE, CGAL::ON_POSITIVE_SIDE);
+  for(int j=0; j<D; ++j) c[D+1][j] = 2;
+  check(c, CGAL::POSITIVE, CGAL::ON_NEGATIVE_SIDE);
+  // degenerate, with large integer coordinates: the determinants are rounded
+  for(int r=0; r<10; ++r) {
+    std::array<double,D> p;
+    for(int j=0; j<D; ++j) p[j] = rng.get_int(1<<29, 1<<30) * 1024.;
+    // in a hyperplane
+    std::vector<std::array<double,D> > w(D);
+    for(auto& x : w) for(double& y : x) y = rng.get_int(-(1<<30), 1<<30);
+    for(int j=0; j<D; ++j) {
+      c[0][j] = p[j];
+      for(int i=1; i<D; ++i) c[i][j] = p[j] + w[i-1][j];
+      c[D][j] = p[j] + w[0][j] + w[1][j];
+      c[D+1][j] = p[j] + w[D-1][j];
+    }
+    check(c, CGAL::COPLANAR, 2);
+    // on a sphere
+    const double radius = rng.get_int(1<<24, 1<<25);
+    for(int i=0; i<=D+1; ++i) c[i] = p;
+    for(int i=0; i<D; ++i) c[i][i] += radius;
+    c[D][0] -= radius;
+    c[D+1][1] -= radius;
+    check(c, 2, CGAL::ON_ORIENTED_BOUNDARY);
+  }
+  // very large and very small coordinates, handled by the fallback
+  for(double scale : { 1e-300, 1e300 }) {
+    for(int i=0; i<=D; ++i) for(int j=0; j<D; ++j) c[i][j] = scale * (i == j+1);
+    for(int j=0; j<D; ++j) c[D+1][j] = scale / D;
+    check(c, CGAL::POSITIVE, CGAL::ON_POSITIVE_SIDE);
+  }
+}
 template struct CGAL::Epick_d<CGAL::Dimension_tag<2> >;
 template struct CGAL::Epick_d<CGAL::Dimension_tag<3> >;
 template struct CGAL::Epick_d<CGAL::Dynamic_dimension_tag>;
@@ -751,6 +817,10 @@ int main(){
   test2<Ker2>(); test2i<Ker2>();
   test3<Ker3>();
   test3<Kerd>();
+  test_static_filters<4>();
+  test_static_filters<5>();
+  test_static_filters<6>();
+  test_static_filters<8>();
 #if !defined _MSC_VER || _MSC_VER >= 1910
   test2<CGAL::Epeck_d<CGAL::Dimension_tag<2>>>();
   test3<CGAL::Epeck_d<CGAL::Dimension_tag<3>>>();
@@ -0,0 +1,80 @@
+
+namespace CGAL {
+
+/*!
+\ingroup nt_cgal
+
+An object of the class `Stack_mpzf` is a multiple-precision floating-point
+number which can represent numbers of the form \f$ m*2^{64e}\f$, where \f$
+m\f$ is an arbitrary precision integer and \f$ e\f$ is of type `int`,
+like `Mpzf`, but without \gmp. A `Stack_mpzf` constructed from an integer or
+a finite floating point number represents exactly that number.
+
+It is meant to be the exact number type used by the predicates of
+`CGAL::Exact_predicates_inexact_constructions_kernel` when the filters fail,
+which is the case if the macro `CGAL_EPICK_USE_STACK_MPZF` is defined.
+
+\cgalModels{IntegralDomainWithoutDivision,RealEmbeddable}
+
+\cgalHeading{Implementation}
+
+The limbs of \f$ m\f$ are stored in the object itself as long as there are at most
+`CGAL_STACK_MPZF_LIMBS` of them (32 by default, that is 2048 bits), and are dynamically
+allocated beyond. The additions and multiplications are specialized for numbers of one
+or two limbs, and the results are not normalized by removing their lowest zero limbs.
+*/
+
+class Stack_mpzf {
+public:
+
+/// \name Creation
+/// @{
+
+/*!
+creates a `Stack_mpzf` initialized with `0`.
+*/
+Stack_mpzf();
+
+/*!
+creates a `Stack_mpzf` initialized with `i`.
+*/
+Stack_mpzf(int i);
+
+/*!
+creates a `Stack_mpzf` initialized with `l`.
+*/
+Stack_mpzf(long long l);
+
+/*!
+creates a `Stack_mpzf` initialized with `d`.
+\pre `d` is finite.
+*/
+Stack_mpzf(double d);
+
+/// @}
+
+/// \name Operations
+/// @{
+
+/*!
+returns whether the limbs of `*this` are stored in the object, and not dynamically allocated.
+*/
+bool is_on_stack() const;
+
+/// @}
+
+}; /* end Stack_mpzf */
+
+/*!
+writes a double approximation of `f` to the ostream `out`.
+\relates Stack_mpzf
+*/
+std::ostream& operator<<(std::ostream& out, const Stack_mpzf& f);
+
+/*!
+reads a `double` from `in`, then converts it to a `Stack_mpzf`.
+\relates Stack_mpzf
+*/
+std::istream& operator>>(std::istream& in, Stack_mpzf& f);
+
+} /* end namespace CGAL */
@@ -20,6 +20,7 @@
 #include <CGAL/assertions.h>
 #include <CGAL/use.h>
 #include <cstring> // std::memcpy
+#include <cstdint>
 
 #ifndef __INTEL_COMPILER
 #include <cmath> // for HUGE_VAL
@@ -340,22 +341,132 @@ inline double IA_bug_sqrt(double d)
 #  define CGAL_BUG_SQRT(d) std::sqrt(d)
 #endif
 
+#ifdef CGAL_ALWAYS_ROUND_TO_NEAREST
+// In round-to-nearest mode, the rounding upward is emulated: the error of the
+// rounded operation is computed exactly with an error-free transformation
+// (TwoSum, or an FMA for the products, quotients and square roots), and the
+// successor of the result is taken only if the error is positive. This gives
+// the same bounds as the hardware rounding upward. When the error cannot be
+// computed exactly (no FMA, underflow), the successor is always taken.
+
+#if defined __FMA__ || defined __ARM_FEATURE_FMA || defined __aarch64__ || defined _M_ARM64
+#  define CGAL_IA_HAS_FMA 1
+#endif
+
+// the successor of d, with -0 considered as +0, d itself if it is +inf or NaN
+inline double IA_next_up(double d)
+{
+  d += 0.; // -0 -> +0
+  if(!(d < std::numeric_limits<double>::infinity()))
+    return d;
+  std::int64_t bits;
+  std::memcpy(&bits, &d, sizeof(double));
+  bits += (d < 0) ? -1 : 1;
+  std::memcpy(&d, &bits, sizeof(double));
+  return d;
+}
+
+inline double IA_next_down(double d)
+{
+  return -IA_next_up(-d);
+}
+
+// below it, the error of a product may not be representable
+#define CGAL_IA_MIN_EXACT_ERROR 0x1p-969
+
+inline double IA_add_up(double a, double b)
+{
+  const double s = a + b;
+  const double bb = s - a;
+  const double e = (a - (s - bb)) + (b - bb); // TwoSum
+  // NaN if there was an overflow
+  return (e <= 0) ? s : IA_next_up(s);
+}
+
+inline double IA_mul_up(double a, double b)
+{
+  const double p = a * b;
+#ifdef CGAL_IA_HAS_FMA
+  if(std::abs(p) >= CGAL_IA_MIN_EXACT_ERROR && std::abs(p) <= CGAL_IA_MAX_DOUBLE
+     && std::fma(a, b, -p) <= 0)
+    return p;
+#endif
+  return (p == 0 && (a == 0 || b == 0)) ? p : IA_next_up(p);
+}
+
+inline double IA_div_up(double a, double b)
+{
+  const double q = a / b;
+#ifdef CGAL_IA_HAS_FMA
+  if(std::abs(a) >= CGAL_IA_MIN_EXACT_ERROR && std::abs(q) >= CGAL_IA_MIN_EXACT_ERROR
+     && std::abs(q) <= CGAL_IA_MAX_DOUBLE)
+  {
+    const double r = std::fma(-q, b, a); // a/b = q + r/b
+    if(r == 0 || ((r > 0) != (b > 0)))
+      return q;
+  }
+#endif
+  return (a == 0 && b != 0) ? q : IA_next_up(q);
+}
+
+inline double IA_sqrt_nearest_up(double a)
+{
+  const double s = std::sqrt(a);
+#ifdef CGAL_IA_HAS_FMA
+  if(a >= CGAL_IA_MIN_EXACT_ERROR && a <= CGAL_IA_MAX_DOUBLE && std::fma(-s, s, a) <= 0)
+    return s;
+#endif
+  return (a == 0) ? s : IA_next_up(s);
+}
+
+inline double IA_sqrt_nearest_toward_zero(double a)
+{
+  if(!(a > 0)) return 0.;
+  const double s = std::sqrt(a);
+#ifdef CGAL_IA_HAS_FMA
+  if(a >= CGAL_IA_MIN_EXACT_ERROR && a <= CGAL_IA_MAX_DOUBLE && std::fma(-s, s, a) >= 0)
+    return s;
+#endif
+  return IA_next_down(s);
+}
+
+#ifdef CGAL_HAS_SSE2
+// Same as IA_add_up(), on the 2 doubles of a vector: used for the 2 bounds of an interval
+inline __m128d IA_add_up(__m128d a, __m128d b)
+{
+  const __m128d zero = _mm_setzero_pd();
+  const __m128d s = _mm_add_pd(_mm_add_pd(a, b), zero); // -0 -> +0
+  const __m128d bb = _mm_sub_pd(s, a);
+  const __m128d e = _mm_add_pd(_mm_sub_pd(a, _mm_sub_pd(s, bb)), _mm_sub_pd(b, bb));
+  // +1 or -1 on the bits of s, where e is positive or NaN, and s is not +inf or NaN
+  const __m128i negative = _mm_castpd_si128(_mm_cmplt_pd(s, zero));
+  const __m128i step = _mm_or_si128(negative, _mm_set1_epi64x(1));
+  const __m128d mask = _mm_and_pd(_mm_cmpnle_pd(e, zero),
+                                  _mm_cmplt_pd(s, _mm_set1_pd(std::numeric_limits<double>::infinity())));
+  return _mm_castsi128_pd(_mm_add_epi64(_mm_castpd_si128(s),
+                                        _mm_and_si128(step, _mm_castpd_si128(mask))));
+}
+#endif
+
+#define CGAL_IA_ADD(a,b) IA_add_up((a), (b))
+#define CGAL_IA_SUB(a,b) IA_add_up((a), -(b))
+#define CGAL_IA_MUL(a,b) IA_mul_up((a), (b))
+#define CGAL_IA_DIV(a,b) IA_div_up((a), (b))
+inline double CGAL_IA_SQUARE(double a){
+  return IA_mul_up(a, a);
+}
+
+#else // not CGAL_ALWAYS_ROUND_TO_NEAREST
+
 // Here are the operator macros that make use of the above.
 // With GCC, we can do slightly better : test with __builtin_constant_p()
 // that both arguments are constant before stopping one of them.
 // Use inline functions instead ?
 inline double IA_up(double d)
 {
-#ifdef CGAL_ALWAYS_ROUND_TO_NEAREST
-  // In round-to-nearest mode we find the successor instead.
-  // This preserves the interval invariants, but is more
-  // expensive and conservative.
-  return nextafter(d, std::numeric_limits<double>::infinity());
-#else
   // In round-upward mode we can rely on the hardware
   // to do the job.
   return CGAL_IA_FORCE_TO_DOUBLE(d);
-#endif
 }
 #define CGAL_IA_ADD(a,b) IA_up((a)+CGAL_IA_STOP_CPROP(b))
 #define CGAL_IA_SUB(a,b) IA_up(CGAL_IA_STOP_CPROP(a)-(b))
@@ -365,6 +476,8 @@ inline double CGAL_IA_SQUARE(double a){
   double b = CGAL_IA_STOP_CPROP(a); // only once
   return IA_up(b*b);
 }
+
+#endif // not CGAL_ALWAYS_ROUND_TO_NEAREST
 #if defined CGAL_SAFE_SSE2
 
 #define CGAL_IA_SETFPCW(CW) _MM_SET_ROUNDING_MODE(CW)
@@ -611,12 +724,16 @@ inline void force_ieee_double_precision()
 }
 
 inline double IA_sqrt_up(double a) {
+#ifdef CGAL_ALWAYS_ROUND_TO_NEAREST
+  return IA_sqrt_nearest_up(a);
+#else
   return IA_up(CGAL_BUG_SQRT(CGAL_IA_STOP_CPROP(a)));
+#endif
 }
 
 inline double IA_sqrt_toward_zero(double d) {
 #ifdef CGAL_ALWAYS_ROUND_TO_NEAREST
-  return (d > 0.0) ? nextafter(std::sqrt(d), 0.) : 0.0;
+  return IA_sqrt_nearest_toward_zero(d);
 #else
   FPU_set_cw(CGAL_FE_DOWNWARD);
   double i = (d > 0.0) ? CGAL_IA_FORCE_TO_DOUBLE(CGAL_BUG_SQRT(CGAL_IA_STOP_CPROP(d))) : 0.0;
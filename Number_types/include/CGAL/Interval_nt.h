@@ -470,6 +470,10 @@ private:
       __m128d bb = IA_opacify128_weak(b.simd());
       __m128d r = _mm_add_pd(aa, bb);
       return Interval_nt(IA_opacify128(r));
+#elif defined CGAL_ALWAYS_ROUND_TO_NEAREST && defined CGAL_HAS_SSE2
+      // both bounds at once: {-ai,as} + {-bi,bs}
+      __m128d r = IA_add_up(_mm_setr_pd(a._inf, a._sup), _mm_setr_pd(b._inf, b._sup));
+      return Interval_nt(-_mm_cvtsd_f64(r), _mm_cvtsd_f64(_mm_unpackhi_pd(r, r)));
 #else
       return Interval_nt (-CGAL_IA_ADD(-a.inf(), -b.inf()),
           CGAL_IA_ADD(a.sup(), b.sup()));
@@ -509,6 +513,10 @@ private:
     {
 #ifdef CGAL_USE_SSE2
       return a+-b;
+#elif defined CGAL_ALWAYS_ROUND_TO_NEAREST && defined CGAL_HAS_SSE2
+      // both bounds at once: {-ai,as} + {bs,-bi}
+      __m128d r = IA_add_up(_mm_setr_pd(a._inf, a._sup), _mm_setr_pd(b._sup, b._inf));
+      return Interval_nt(-_mm_cvtsd_f64(r), _mm_cvtsd_f64(_mm_unpackhi_pd(r, r)));
 #else
       Internal_protector P;
       return Interval_nt(-CGAL_IA_ADD(b.sup(), -a.inf()),
@@ -136,7 +136,7 @@ struct Lazy_exact_Int_Cst final : public Lazy_exact_nt_rep<ET>
       : Lazy_exact_nt_rep<ET>(double(i)) {}
 
   void update_exact() const {
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect((int)this->approx().sup());
+    auto* pet = Lazy_exact_nt_rep<ET>::new_indirect((int)this->approx().sup());
     this->keep_at(pet);
     this->set_ptr(pet);
   }
@@ -150,7 +150,7 @@ struct Lazy_exact_Cst final : public Lazy_exact_nt_rep<ET>
       : Lazy_exact_nt_rep<ET>(x), cste(x) {}
 
   void update_exact() const {
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect(cste);
+    auto* pet = Lazy_exact_nt_rep<ET>::new_indirect(cste);
     this->keep_at(pet);
     this->set_ptr(pet);
   }
@@ -190,7 +190,7 @@ public:
 
   void update_exact() const
   {
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect(l.exact());
+    auto* pet = Lazy_exact_nt_rep<ET>::new_indirect(l.exact());
     this->set_at(pet, l.approx());
     this->set_ptr(pet);
     this->prune_dag();
@@ -217,6 +217,12 @@ struct Lazy_exact_unary : public Lazy_exact_nt_rep<ET>
 
   void prune_dag() const { op1.reset(); }
 
+  void lazy_children(std::vector<const Lazy_rep_base*>& children) const
+  {
+    if(this->is_lazy())
+      add_lazy_child(op1, children);
+  }
+
 #ifdef CGAL_LAZY_KERNEL_DEBUG
   void
   print_dag(std::ostream& os, int level) const
@@ -250,6 +256,15 @@ struct Lazy_exact_binary : public Lazy_exact_nt_rep<ET>
     op2.reset();
   }
 
+  void lazy_children(std::vector<const Lazy_rep_base*>& children) const
+  {
+    if(this->is_lazy())
+    {
+      add_lazy_child(op1, children);
+      add_lazy_child(op2, children);
+    }
+  }
+
 #ifdef CGAL_LAZY_KERNEL_DEBUG
   void
   print_dag(std::ostream& os, int level) const
@@ -281,7 +296,7 @@ struct NAME final : public Lazy_exact_unary<ET>                          \
                                                                          \
   void update_exact() const                                              \
   {                                                                      \
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect(OP(this->op1.exact())); \
+    auto* pet = Lazy_exact_nt_rep<ET>::new_indirect(OP(this->op1.exact())); \
     if (!this->approx().is_point())                                               \
       this->set_at(pet);                                                 \
     this->set_ptr(pet);                                                  \
@@ -305,7 +320,7 @@ struct NAME final : public Lazy_exact_binary<ET, ET1, ET2>               \
                                                                          \
   void update_exact() const                                              \
   {                                                                      \
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect(this->op1.exact() OP this->op2.exact()); \
+    auto* pet = Lazy_exact_nt_rep<ET>::new_indirect(this->op1.exact() OP this->op2.exact()); \
     if (!this->approx().is_point())                                               \
       this->set_at(pet);                                                 \
     this->set_ptr(pet);                                                  \
@@ -328,7 +343,7 @@ struct Lazy_exact_Min final : public Lazy_exact_binary<ET>
   void update_exact() const
   {
     // Should we test is_point earlier, and construct ET from double in that case? Constructing from double is not free, but if op1 or op2 is not exact yet, we may be able to skip a whole tree of exact constructions.
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect((CGAL::min)(this->op1.exact(), this->op2.exact()));
+    auto* pet = Lazy_exact_nt_rep<ET>::new_indirect((CGAL::min)(this->op1.exact(), this->op2.exact()));
     if (!this->approx().is_point())
       this->set_at(pet);
     this->set_ptr(pet);
@@ -345,7 +360,7 @@ struct Lazy_exact_Max final : public Lazy_exact_binary<ET>
 
   void update_exact() const
   {
-    auto* pet = new typename Lazy_exact_nt_rep<ET>::Indirect((CGAL::max)(this->op1.exact(), this->op2.exact()));
+    auto* pet = Lazy_exact_nt_rep<ET>::new_indirect((CGAL::max)(this->op1.exact(), this->op2.exact()));
     if (!this->approx().is_point())
       this->set_at(pet);
     this->set_ptr(pet);
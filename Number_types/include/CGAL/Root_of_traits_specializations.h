@@ -55,10 +55,10 @@ struct Lazy_exact_ro2
         typedef typename Base::Indirect I;
         I* pet;
         if (old_rep)
-          pet = new I(make_root_of_2(op1.exact(), op2.exact(),
+          pet = Base::new_indirect(make_root_of_2(op1.exact(), op2.exact(),
                                      op3.exact(), smaller));
         else
-          pet = new I(make_root_of_2(op1.exact(), op2.exact(),
+          pet = Base::new_indirect(make_root_of_2(op1.exact(), op2.exact(),
                                      op3.exact()));
         if (!this->approx().is_point())
             this->set_at(pet);
@@ -0,0 +1,458 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_STACK_MPZF_H
+#define CGAL_STACK_MPZF_H
+
+#include <CGAL/number_type_basic.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Coercion_traits.h>
+
+#include <boost/config.hpp>
+#include <boost/container/small_vector.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#pragma intrinsic(_BitScanReverse64)
+#endif
+
+// Like Mpzf, a Stack_mpzf is an integer times a power of 2^64, designed as the
+// exact ring number type at the end of the filtering chain of the predicates of Epick.
+// It does not use GMP: its limbs are stored on the stack (in a small_vector) up to
+// CGAL_STACK_MPZF_LIMBS limbs, and on the heap only beyond, and the additions and
+// multiplications are written for the few limbs of the values computed by predicates.
+// The low zero limbs are never removed: only the comparisons look at the actual values.
+
+#ifndef CGAL_STACK_MPZF_LIMBS
+#define CGAL_STACK_MPZF_LIMBS 32
+#endif
+
+namespace CGAL {
+
+namespace Stack_mpzf_impl {
+
+typedef std::uint64_t limb;
+
+// x must not be 0
+inline int clz(limb x)
+{
+#if defined(__GNUC__)
+  return __builtin_clzll(x);
+#elif defined(_MSC_VER)
+  unsigned long r;
+  _BitScanReverse64(&r, x);
+  return 63 - int(r);
+#else
+  int n = 0;
+  for(; !(x & (limb(1) << 63)); x <<= 1) ++n;
+  return n;
+#endif
+}
+
+// returns the low limb of a * b, and sets hi to its high limb
+inline limb mul(limb a, limb b, limb& hi)
+{
+#ifdef BOOST_HAS_INT128
+  const boost::uint128_type p = boost::uint128_type(a) * b;
+  hi = limb(p >> 64);
+  return limb(p);
+#else
+  const limb a0 = a & 0xffffffff, a1 = a >> 32, b0 = b & 0xffffffff, b1 = b >> 32;
+  const limb p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  const limb mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+  hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+  return (mid << 32) | (p00 & 0xffffffff);
+#endif
+}
+
+// res[0, na+nb) = a[0, na) * b[0, nb), the sizes are constants for the small cases
+template <int NA, int NB>
+inline void mul_n(limb* res, const limb* a, const limb* b, int na = NA, int nb = NB)
+{
+  std::fill(res, res + na, limb(0));
+  for(int j=0; j<nb; ++j)
+  {
+    limb carry = 0;
+    for(int i=0; i<na; ++i)
+    {
+      limb hi;
+      limb lo = mul(a[i], b[j], hi);
+      lo += carry;
+      hi += (lo < carry);
+      const limb s = res[i + j] + lo;
+      hi += (s < lo);
+      res[i + j] = s;
+      carry = hi;
+    }
+    res[j + na] = carry;
+  }
+}
+
+inline void mul(limb* res, const limb* a, int na, const limb* b, int nb)
+{
+  if(na < nb)
+  {
+    std::swap(a, b);
+    std::swap(na, nb);
+  }
+  if(nb == 1)
+  {
+    if(na == 1) { res[0] = mul(a[0], b[0], res[1]); return; }
+    if(na == 2) { mul_n<2, 1>(res, a, b); return; }
+    mul_n<0, 1>(res, a, b, na);
+    return;
+  }
+  if(na == 2) { mul_n<2, 2>(res, a, b); return; }
+  mul_n<0, 0>(res, a, b, na, nb);
+}
+
+// res[0, n) += x[0, n), with the carry propagated beyond n: res must be large enough
+inline void add_n(limb* res, const limb* x, int n)
+{
+  limb carry = 0;
+  for(int i=0; i<n; ++i)
+  {
+    const limb s = res[i] + carry;
+    const limb c1 = (s < carry);
+    const limb t = s + x[i];
+    carry = c1 | limb(t < s);
+    res[i] = t;
+  }
+  for(limb* p = res + n; carry; ++p)
+    carry = (++*p == 0);
+}
+
+// res[0, n) -= x[0, n), with the borrow propagated beyond n: res must be larger than x
+inline void sub_n(limb* res, const limb* x, int n)
+{
+  limb borrow = 0;
+  for(int i=0; i<n; ++i)
+  {
+    const limb s = res[i] - borrow;
+    const limb b1 = (res[i] < borrow);
+    borrow = b1 | limb(s < x[i]);
+    res[i] = s - x[i];
+  }
+  for(limb* p = res + n; borrow; ++p)
+    borrow = ((*p)-- == 0);
+}
+
+} // namespace Stack_mpzf_impl
+
+class Stack_mpzf
+{
+  typedef Stack_mpzf_impl::limb limb;
+  typedef boost::container::small_vector<limb, CGAL_STACK_MPZF_LIMBS> Limbs;
+
+  Limbs data_;            // least significant limb first, the most significant limb is not 0
+  int exp_ = 0;           // the value is data_ * 2^(64 * exp_)
+  bool negative_ = false;
+
+  int size() const { return static_cast<int>(data_.size()); }
+
+  limb limb_at(int position) const
+  {
+    const int i = position - exp_;
+    return (i >= 0 && i < size()) ? data_[i] : 0;
+  }
+
+  void remove_high_zeros()
+  {
+    while(!data_.empty() && data_.back() == 0)
+      data_.pop_back();
+    if(data_.empty())
+    {
+      exp_ = 0;
+      negative_ = false;
+    }
+  }
+
+  void init(long long i)
+  {
+    if(i == 0) return;
+    negative_ = (i < 0);
+    data_.push_back(negative_ ? limb(0) - limb(i) : limb(i));
+  }
+
+  static int abs_compare(const Stack_mpzf& a, const Stack_mpzf& b)
+  {
+    if(a.data_.empty()) return b.data_.empty() ? 0 : -1;
+    if(b.data_.empty()) return 1;
+    const int ta = a.exp_ + a.size(), tb = b.exp_ + b.size();
+    if(ta != tb) return (ta < tb) ? -1 : 1;
+    const int lowest = (std::min)(a.exp_, b.exp_);
+    for(int p=ta-1; p>=lowest; --p)
+    {
+      const limb x = a.limb_at(p), y = b.limb_at(p);
+      if(x != y) return (x < y) ? -1 : 1;
+    }
+    return 0;
+  }
+
+  // a + b if b_negative is the sign of b, a - b otherwise
+  static Stack_mpzf add(const Stack_mpzf& a, const Stack_mpzf& b, bool b_negative)
+  {
+    if(b.data_.empty()) return a;
+    if(a.data_.empty())
+    {
+      Stack_mpzf r = b;
+      r.negative_ = b_negative;
+      return r;
+    }
+    Stack_mpzf r;
+    r.exp_ = (std::min)(a.exp_, b.exp_);
+    const int top = (std::max)(a.exp_ + a.size(), b.exp_ + b.size());
+    if(a.negative_ == b_negative)
+    {
+      r.negative_ = b_negative;
+      r.data_.resize(top - r.exp_ + 1);
+      std::copy(a.data_.begin(), a.data_.end(), r.data_.begin() + (a.exp_ - r.exp_));
+      Stack_mpzf_impl::add_n(r.data_.data() + (b.exp_ - r.exp_), b.data_.data(), b.size());
+    }
+    else
+    {
+      const int c = abs_compare(a, b);
+      if(c == 0) return Stack_mpzf();
+      const Stack_mpzf& large = (c > 0) ? a : b;
+      const Stack_mpzf& small = (c > 0) ? b : a;
+      r.negative_ = (c > 0) ? a.negative_ : b_negative;
+      r.data_.resize(top - r.exp_);
+      std::copy(large.data_.begin(), large.data_.end(), r.data_.begin() + (large.exp_ - r.exp_));
+      Stack_mpzf_impl::sub_n(r.data_.data() + (small.exp_ - r.exp_), small.data_.data(), small.size());
+    }
+    r.remove_high_zeros();
+    return r;
+  }
+
+public:
+  Stack_mpzf() {}
+  Stack_mpzf(int i) { init(i); }
+  Stack_mpzf(long i) { init(i); }
+  Stack_mpzf(long long i) { init(i); }
+  Stack_mpzf(float f) : Stack_mpzf(double(f)) {}
+  Stack_mpzf(double d)
+  {
+    CGAL_precondition(is_finite(d));
+    if(d == 0) return;
+    negative_ = (d < 0);
+    int e;
+    const limb m = limb(std::ldexp(std::frexp(std::abs(d), &e), 53));
+    e -= 53;
+    // d = m * 2^e = m * 2^r * 2^(64 * exp_)
+    exp_ = (e >= 0) ? e / 64 : -((-e + 63) / 64);
+    const int r = e - 64 * exp_;
+    data_.push_back(m << r);
+    if(r > 11)
+    {
+      const limb h = m >> (64 - r);
+      if(h != 0) data_.push_back(h);
+    }
+  }
+
+  friend Stack_mpzf operator+(const Stack_mpzf& a, const Stack_mpzf& b) { return add(a, b, b.negative_); }
+  friend Stack_mpzf operator-(const Stack_mpzf& a, const Stack_mpzf& b) { return add(a, b, !b.negative_); }
+
+  friend Stack_mpzf operator*(const Stack_mpzf& a, const Stack_mpzf& b)
+  {
+    Stack_mpzf r;
+    if(a.data_.empty() || b.data_.empty()) return r;
+    r.exp_ = a.exp_ + b.exp_;
+    r.negative_ = (a.negative_ != b.negative_);
+    r.data_.resize(a.size() + b.size());
+    Stack_mpzf_impl::mul(r.data_.data(), a.data_.data(), a.size(), b.data_.data(), b.size());
+    r.remove_high_zeros();
+    return r;
+  }
+
+  friend Stack_mpzf operator+(const Stack_mpzf& x) { return x; }
+  friend Stack_mpzf operator-(const Stack_mpzf& x)
+  {
+    Stack_mpzf r = x;
+    if(!r.data_.empty()) r.negative_ = !r.negative_;
+    return r;
+  }
+
+  Stack_mpzf& operator+=(const Stack_mpzf& x) { *this = *this + x; return *this; }
+  Stack_mpzf& operator-=(const Stack_mpzf& x) { *this = *this - x; return *this; }
+  Stack_mpzf& operator*=(const Stack_mpzf& x) { *this = *this * x; return *this; }
+
+  friend int Stack_mpzf_cmp(const Stack_mpzf& a, const Stack_mpzf& b)
+  {
+    const int sa = a.sign(), sb = b.sign();
+    if(sa != sb) return (sa < sb) ? -1 : 1;
+    const int c = abs_compare(a, b);
+    return a.negative_ ? -c : c;
+  }
+
+  friend bool operator<(const Stack_mpzf& a, const Stack_mpzf& b) { return Stack_mpzf_cmp(a, b) < 0; }
+  friend bool operator>(const Stack_mpzf& a, const Stack_mpzf& b) { return Stack_mpzf_cmp(a, b) > 0; }
+  friend bool operator<=(const Stack_mpzf& a, const Stack_mpzf& b) { return Stack_mpzf_cmp(a, b) <= 0; }
+  friend bool operator>=(const Stack_mpzf& a, const Stack_mpzf& b) { return Stack_mpzf_cmp(a, b) >= 0; }
+  friend bool operator==(const Stack_mpzf& a, const Stack_mpzf& b) { return Stack_mpzf_cmp(a, b) == 0; }
+  friend bool operator!=(const Stack_mpzf& a, const Stack_mpzf& b) { return Stack_mpzf_cmp(a, b) != 0; }
+  friend const Stack_mpzf& min BOOST_PREVENT_MACRO_SUBSTITUTION (const Stack_mpzf& a, const Stack_mpzf& b)
+  { return (b < a) ? b : a; }
+  friend const Stack_mpzf& max BOOST_PREVENT_MACRO_SUBSTITUTION (const Stack_mpzf& a, const Stack_mpzf& b)
+  { return (a < b) ? b : a; }
+
+  bool is_zero() const { return data_.empty(); }
+
+  bool is_one() const
+  {
+    if(negative_ || data_.empty() || exp_ + size() != 1 || data_.back() != 1) return false;
+    return std::all_of(data_.begin(), data_.end() - 1, [](limb l) { return l == 0; });
+  }
+
+  Sign sign() const { return data_.empty() ? ZERO : (negative_ ? NEGATIVE : POSITIVE); }
+
+  // returns whether the value is stored on the stack
+  bool is_on_stack() const { return data_.capacity() <= CGAL_STACK_MPZF_LIMBS; }
+
+  double to_double() const
+  {
+    if(data_.empty()) return 0;
+    const int n = size();
+    double d = double(data_[n - 1]);
+    if(n > 1) d += std::ldexp(double(data_[n - 2]), -64);
+    return std::ldexp(negative_ ? -d : d, 64 * (n - 1 + exp_));
+  }
+
+  // same as Mpzf::to_interval()
+  std::pair<double, double> to_interval() const
+  {
+    if(data_.empty()) return std::make_pair(0., 0.);
+    const int n = size();
+    int e = 64 * (n - 1 + exp_);
+    limb x = data_[n - 1];
+    const int lz = Stack_mpzf_impl::clz(x);
+    double dl, dh;
+    if(lz <= 11)
+    {
+      if(lz != 11)
+      {
+        e += (11 - lz);
+        x >>= (11 - lz);
+      }
+      dl = double(x);
+      dh = double(x + 1);
+    }
+    else if(n == 1)
+    {
+      dl = dh = double(x); // exact
+    }
+    else
+    {
+      const limb y = data_[n - 2];
+      e -= (lz - 11);
+      x <<= (lz - 11);
+      x |= (y >> (75 - lz));
+      dl = double(x);
+      dh = double(x + 1);
+    }
+    typedef Interval_nt<> IA;
+    IA res(dl, dh);
+    res = ldexp(res, e);
+    if(negative_) res = -res;
+    return CGAL::to_interval(res);
+  }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const Stack_mpzf& a)
+{
+  return os << a.to_double();
+}
+
+inline std::istream& operator>>(std::istream& is, Stack_mpzf& a)
+{
+  double d;
+  is >> d;
+  if(is)
+    a = d;
+  return is;
+}
+
+template <> struct Algebraic_structure_traits< Stack_mpzf >
+  : public Algebraic_structure_traits_base< Stack_mpzf, Integral_domain_without_division_tag >
+{
+  typedef Tag_true  Is_exact;
+  typedef Tag_false Is_numerical_sensitive;
+
+  struct Is_zero
+    : public CGAL::cpp98::unary_function< Type, bool > {
+      bool operator()( const Type& x ) const {
+        return x.is_zero();
+      }
+    };
+
+  struct Is_one
+    : public CGAL::cpp98::unary_function< Type, bool > {
+      bool operator()( const Type& x ) const {
+        return x.is_one();
+      }
+    };
+
+  struct Square
+    : public CGAL::cpp98::unary_function< Type, Type > {
+      Type operator()( const Type& x ) const {
+        return x * x;
+      }
+    };
+};
+
+template <> struct Real_embeddable_traits< Stack_mpzf >
+  : public INTERN_RET::Real_embeddable_traits_base< Stack_mpzf, CGAL::Tag_true >
+{
+  struct Sgn
+    : public CGAL::cpp98::unary_function< Type, ::CGAL::Sign > {
+      ::CGAL::Sign operator()( const Type& x ) const {
+        return x.sign();
+      }
+    };
+
+  struct To_double
+    : public CGAL::cpp98::unary_function< Type, double > {
+      double operator()( const Type& x ) const {
+        return x.to_double();
+      }
+    };
+
+  struct Compare
+    : public CGAL::cpp98::binary_function< Type, Type, Comparison_result > {
+      Comparison_result operator()( const Type& x, const Type& y ) const {
+        return CGAL::sign(Stack_mpzf_cmp(x, y));
+      }
+    };
+
+  struct To_interval
+    : public CGAL::cpp98::unary_function< Type, std::pair< double, double > > {
+      std::pair<double, double> operator()( const Type& x ) const {
+        return x.to_interval();
+      }
+    };
+};
+
+CGAL_DEFINE_COERCION_TRAITS_FOR_SELF(Stack_mpzf)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(short    ,Stack_mpzf)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(int      ,Stack_mpzf)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(long     ,Stack_mpzf)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(float    ,Stack_mpzf)
+CGAL_DEFINE_COERCION_TRAITS_FROM_TO(double   ,Stack_mpzf)
+
+} // namespace CGAL
+
+#endif // CGAL_STACK_MPZF_H
@@ -31,9 +31,11 @@ bool spiral_test()
       break;
   };
 
-#ifdef CGAL_ALWAYS_ROUND_TO_NEAREST
-  return i == 365;
+#if defined CGAL_ALWAYS_ROUND_TO_NEAREST && !defined CGAL_IA_HAS_FMA
+  // the products and quotients are rounded to their successor
+  return i == 395;
 #else
+  // with an FMA, rounding to nearest gives the same bounds as rounding upward
   return i == 396;
 #endif
 }
@@ -226,7 +228,11 @@ bool division_test()
   DEBUG( std::cout << d << e << i << std::endl; )
   DEBUG( std::cout << d-1 << e+1 << std::endl; )
 
+#if defined CGAL_ALWAYS_ROUND_TO_NEAREST && !defined CGAL_IA_HAS_FMA
+  return c.is_same(IA_nt::largest()) && i == 55;
+#else
   return c.is_same(IA_nt::largest()) && i == 54;
+#endif
 }
 
 
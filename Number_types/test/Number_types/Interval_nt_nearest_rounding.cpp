@@ -0,0 +1,111 @@
+#define CGAL_ALWAYS_ROUND_TO_NEAREST
+
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cfenv>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+// Checks that the emulation of the rounding upward in round-to-nearest mode gives
+// upper bounds of the exact results, equal to the ones of the hardware rounding
+// upward for the additions, and for the other operations if there is an FMA.
+
+volatile double va, vb;
+
+double hardware_up(char op)
+{
+  std::fesetround(FE_UPWARD);
+  double r;
+  switch(op)
+  {
+    case '+': r = va + vb; break;
+    case '*': r = va * vb; break;
+    case '/': r = va / vb; break;
+    default: r = std::sqrt(va); break;
+  }
+  std::fesetround(FE_TONEAREST);
+  return r;
+}
+
+void check(double emulated, char op, double a, double b)
+{
+  va = a;
+  vb = b;
+  const double up = hardware_up(op);
+  if(std::isnan(up))
+    return;
+  assert(emulated >= up);
+#ifndef CGAL_IA_HAS_FMA
+  if(op != '+')
+  {
+    assert(emulated <= CGAL::IA_next_up(up));
+    return;
+  }
+#endif
+  if(op != '+' && (std::abs(up) < 0x1p-960 || std::abs(a) < 0x1p-960))
+    assert(emulated <= CGAL::IA_next_up(up));
+  else
+    assert(emulated == up);
+}
+
+void check_all(double a, double b)
+{
+  if(!std::isfinite(a) || !std::isfinite(b))
+    return;
+  check(CGAL::IA_add_up(a, b), '+', a, b);
+  check(CGAL::IA_add_up(a, -b), '+', a, -b);
+  check(CGAL::IA_mul_up(a, b), '*', a, b);
+  if(b != 0)
+    check(CGAL::IA_div_up(a, b), '/', a, b);
+  if(a >= 0)
+    check(CGAL::IA_sqrt_up(a), 's', a, 0);
+#ifdef CGAL_HAS_SSE2
+  const __m128d r = CGAL::IA_add_up(_mm_setr_pd(a, b), _mm_setr_pd(b, -a));
+  assert(_mm_cvtsd_f64(r) == CGAL::IA_add_up(a, b));
+  assert(_mm_cvtsd_f64(_mm_unpackhi_pd(r, r)) == CGAL::IA_add_up(b, -a));
+#endif
+}
+
+int main()
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  const double max = (std::numeric_limits<double>::max)();
+  const double tiny = std::numeric_limits<double>::denorm_min();
+
+  assert(CGAL::IA_next_up(0.) == tiny && CGAL::IA_next_up(-0.) == tiny);
+  assert(CGAL::IA_next_up(-tiny) == 0);
+  assert(CGAL::IA_next_up(max) == inf && CGAL::IA_next_up(inf) == inf);
+  assert(CGAL::IA_next_up(-inf) == -max);
+  assert(CGAL::IA_add_up(max, max) == inf && CGAL::IA_add_up(-max, -max) == -max);
+  assert(CGAL::IA_add_up(1, 0x1p-60) == CGAL::IA_next_up(1.));
+  assert(CGAL::IA_add_up(1, -0x1p-60) == 1);
+  assert(CGAL::IA_mul_up(tiny, 0.5) == tiny && CGAL::IA_mul_up(-tiny, 0.5) >= -0.);
+  assert(CGAL::IA_sqrt_toward_zero(2) * CGAL::IA_sqrt_toward_zero(2) <= 2);
+
+  const double special[] = { 0, 1, -1, 0.1, 3, max, -max, tiny, -tiny, 0x1p-1022, 1e-300, 1e300 };
+  for(double a : special)
+    for(double b : special)
+      check_all(a, b);
+
+  CGAL::Random rng(0);
+  for(int i=0; i<100000; ++i)
+  {
+    const double a = std::ldexp(rng.get_double(-1, 1), rng.get_int(-1100, 1100));
+    const double b = std::ldexp(rng.get_double(-1, 1), rng.get_int(-1100, 1100));
+    check_all(a, b);
+    check_all(a, std::ldexp(a, rng.get_int(-60, 60)) + b * 1e-20);
+  }
+
+  // the interval operations
+  typedef CGAL::Interval_nt<> IA;
+  const IA x(0.1, 0.2), y(-3, 0.3);
+  assert((x + y).inf() == CGAL::IA_next_down(0.1 - 3) || (x + y).inf() == 0.1 - 3);
+  assert((x - y).sup() == CGAL::IA_add_up(0.2, 3));
+  assert(CGAL::possibly((x * y) / 3 < 0));
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,89 @@
+#include <CGAL/Stack_mpzf.h>
+#include <CGAL/MP_Float.h>
+#include <CGAL/Random.h>
+#include <CGAL/Test/_test_algebraic_structure.h>
+#include <CGAL/Test/_test_real_embeddable.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Stack_mpzf NT;
+
+// checks that the values computed with Stack_mpzf and MP_Float are the same
+void check(const NT& x, const CGAL::MP_Float& y)
+{
+  assert(CGAL::sign(x) == CGAL::sign(y));
+  const std::pair<double, double> i = CGAL::to_interval(x);
+  const std::pair<double, double> j = CGAL::to_interval(y);
+  assert(i.first <= j.second && j.first <= i.second);
+  assert(i.first <= CGAL::to_double(x) && CGAL::to_double(x) <= i.second);
+}
+
+// random sums and products of doubles, as in the predicates, with exponents in [-range, range]
+void test_random(int range, int n)
+{
+  CGAL::Random rng(range);
+  std::vector<NT> x;
+  std::vector<CGAL::MP_Float> y;
+  for(int i=0; i<n; ++i)
+  {
+    const double d = std::ldexp(rng.get_double(-1, 1), rng.get_int(-range, range + 1));
+    x.push_back(d);
+    y.push_back(d);
+    check(x.back(), y.back());
+  }
+  for(int k=0; k<10*n; ++k)
+  {
+    const int i = rng.get_int(0, n), j = rng.get_int(0, n);
+    NT a;
+    CGAL::MP_Float b;
+    switch(rng.get_int(0, 3))
+    {
+      case 0: a = x[i] + x[j]; b = y[i] + y[j]; break;
+      case 1: a = x[i] - x[j]; b = y[i] - y[j]; break;
+      default: a = x[i] * x[j]; b = y[i] * y[j]; break;
+    }
+    check(a, b);
+    assert(CGAL::compare(x[i], x[j]) == CGAL::compare(y[i], y[j]));
+    assert(a - a == 0 && (a + a) - a == a);
+    // keep the numbers of limbs small
+    if(k % 2 == 0 && a.is_on_stack())
+    {
+      x[i] = a;
+      y[i] = b;
+    }
+  }
+}
+
+int main()
+{
+  CGAL::test_algebraic_structure<NT, CGAL::Integral_domain_without_division_tag, CGAL::Tag_true>();
+  CGAL::test_algebraic_structure<NT, CGAL::Integral_domain_without_division_tag, CGAL::Tag_true>(NT(4), NT(6), NT(15));
+  CGAL::test_algebraic_structure<NT, CGAL::Integral_domain_without_division_tag, CGAL::Tag_true>(NT(-4), NT(6), NT(15));
+  CGAL::test_algebraic_structure<NT, CGAL::Integral_domain_without_division_tag, CGAL::Tag_true>(NT(4), NT(-6), NT(-15));
+  CGAL::test_real_embeddable<NT>();
+
+  const NT a = 3, b = 4.5;
+  assert(CGAL::sign(2 * (a + b) + -a * 5) == CGAL::ZERO);
+  assert(CGAL::square(b) * 4 == 81);
+  assert(CGAL::is_one(a - 2) && !CGAL::is_one(a));
+  assert(CGAL::is_one((NT(0.5) + NT(0.5)) * (NT(1e-300) + 1 - NT(1e-300))));
+  assert(NT(1e-300) * NT(1e300) != 1);
+  assert(CGAL::to_double(b) == 4.5);
+  assert(NT(std::ldexp(1., -1074)) > 0 && NT(-std::ldexp(1., -1074)) < 0);
+  assert(NT(-1) < NT(std::ldexp(1., -1074)));
+
+  // a value of more than CGAL_STACK_MPZF_LIMBS limbs is stored on the heap
+  const NT large = NT(1e300) + NT(1e-300);
+  assert(!large.is_on_stack());
+  assert(large - NT(1e300) == NT(1e-300));
+  assert((NT(1e10) + 1).is_on_stack());
+
+  test_random(60, 100);    // a few limbs
+  test_random(1000, 100);  // values on the heap
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
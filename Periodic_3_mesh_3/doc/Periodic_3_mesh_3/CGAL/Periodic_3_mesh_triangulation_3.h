@@ -17,6 +17,13 @@ the triangulation type to be used for the 3D periodic triangulation embedding th
 \tparam Cell_base must be a model of `MeshCellBase_3` and `Periodic_3TriangulationDSCellBase_3`.
 `Default` may be used, with default value `Mesh_cell_base_3<GT, MD, Regular_triangulation_cell_base_with_weighted_circumcenter_3<Gt, Regular_triangulation_cell_base_3<Gt, Periodic_3_triangulation_ds_cell_base_3> > >`.
 
+\tparam Concurrency_tag enables sequential versus parallel meshing and optimization algorithms.
+                        Possible values are `Sequential_tag` (the default), `Parallel_tag`,
+                        and `Parallel_if_available_tag`.
+                        With `Parallel_tag`, the points of the triangulation are locked through their
+                        canonical representative, so that the periodic copies of a point share the same lock,
+                        and hidden points are discarded.
+
 \warning The input traits `GT` are wrapped multiple times to handle periodicity
          and to improve the robustness of the meshing process: for example,
          wrapping `GT` with `Robust_weighted_circumcenter_filtered_traits_3<GT>`
@@ -33,7 +40,8 @@ the triangulation type to be used for the 3D periodic triangulation embedding th
 \sa `Mesh_triangulation_3`
 
 */
-template< typename MD, typename GT, typename Vertex_base, typename Cell_base>
+template< typename MD, typename GT, typename Vertex_base, typename Cell_base,
+          typename Concurrency_tag = Sequential_tag>
 class Periodic_3_mesh_triangulation_3
 {
 public:
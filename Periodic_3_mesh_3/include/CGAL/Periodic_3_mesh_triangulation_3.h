@@ -28,6 +28,7 @@
 // periodic triangulations
 #include <CGAL/Periodic_3_regular_triangulation_traits_3.h>
 #include <CGAL/Periodic_3_regular_triangulation_3.h>
+#include <CGAL/Triangulation_3.h> // for the locking base
 
 // vertex and cell bases
 #include <CGAL/Triangulation_vertex_base_with_info_3.h> // to mark dummy vertices
@@ -38,6 +39,7 @@
 #include <CGAL/assertions.h>
 #include <CGAL/Cartesian_converter.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Hidden_point_memory_policy.h>
 #include <CGAL/Kernel_traits.h>
 #include <CGAL/SMDS_3/io_signature.h>
 #include <CGAL/tags.h>
@@ -45,6 +47,8 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <stack>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -55,18 +59,29 @@ namespace CGAL {
 /// `CGAL::Periodic_3_regular_triangulation_3` and the mesher `Mesh_3`.
 /// If periodic triangulations are parallelized, a lot of these functions will
 /// become obsolete.
+///
+/// If the concurrency tag of the triangulation data structure is `Parallel_tag`,
+/// the locking interface of `Triangulation_3` is provided, and insertions and removals
+/// only access the cells of their (locked) conflict zone. Since the triangulation is 1-sheeted,
+/// the vertices store canonical points and the periodic copies of a vertex share its lock.
 template<class Gt_, class Tds_>
 class Periodic_3_regular_triangulation_3_wrapper
-  : public Periodic_3_regular_triangulation_3<Gt_, Tds_>
+  : public Periodic_3_regular_triangulation_3<Gt_, Tds_>,
+    public Triangulation_3_base<typename Tds_::Concurrency_tag, Default>
 {
+  typedef Periodic_3_regular_triangulation_3_wrapper<Gt_, Tds_> Self;
+
 public:
-  typedef Sequential_tag                                      Concurrency_tag;
-  typedef void                                                Lock_data_structure;
+  typedef Periodic_3_regular_triangulation_3<Gt_, Tds_>       Base;
+  typedef Triangulation_3_base<typename Tds_::Concurrency_tag, Default> Lock_base;
 
-  void *get_lock_data_structure() const { return 0; }
-  void set_lock_data_structure(void *) const { }
+  typedef typename Tds_::Concurrency_tag                      Concurrency_tag;
+  typedef typename Lock_base::Lock_data_structure             Lock_data_structure;
 
-  typedef Periodic_3_regular_triangulation_3<Gt_, Tds_>       Base;
+private:
+  static constexpr bool is_parallel_tds = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+
+public:
 
   typedef typename Base::Geom_traits                          Geom_traits;
   typedef typename Base::Triangulation_data_structure         Triangulation_data_structure;
@@ -141,22 +156,98 @@ public:
   }
 
   /// Concurrency related
-  template <typename Cell_handle>
-  bool try_lock_cell(const Cell_handle &, int = 0) const
+  using Lock_base::get_lock_data_structure;
+  using Lock_base::set_lock_data_structure;
+  using Lock_base::is_parallel;
+  using Lock_base::try_lock_vertex;
+  using Lock_base::try_lock_cell;
+  using Lock_base::try_lock_facet;
+  using Lock_base::is_cell_locked_by_this_thread;
+  using Lock_base::unlock_all_elements;
+  using Lock_base::get_bbox;
+
+  // A point is locked through its canonical representative, which is the point
+  // stored in the vertices, so that all the periodic copies of a point share the same lock
+  template <typename P3>
+  bool try_lock_point(const P3& p, int lock_radius = 0) const
   {
-    std::cerr << "ERROR: P3M3 does not yet support parallel execution" << std::endl;
-    CGAL_assertion(false);
-    return true;
+    if(!is_parallel())
+      return true;
+    return Lock_base::try_lock_point(canonicalize_point(p), lock_radius);
   }
 
-  bool try_lock_and_get_incident_cells(Vertex_handle /* v */,
-                                       std::vector<Cell_handle>& /* cells */) const
+  template <typename P3>
+  bool is_point_locked_by_this_thread(const P3& p) const
   {
-    std::cerr << "ERROR: P3M3 does not yet support parallel execution" << std::endl;
-    CGAL_assertion(false);
+    if(!is_parallel())
+      return Lock_base::is_point_locked_by_this_thread(p);
+    return Lock_base::is_point_locked_by_this_thread(canonicalize_point(p));
+  }
+
+  template <typename P3>
+  void unlock_all_elements_but_one_point(const P3& p) const
+  {
+    if(is_parallel())
+      Lock_base::unlock_all_elements_but_one_point(canonicalize_point(p));
+  }
+
+  // The function below is a copy of `Triangulation_3::try_lock_and_get_incident_cells()`.
+  // Any change should be mirrored.
+  bool try_lock_and_get_incident_cells(Vertex_handle v, std::vector<Cell_handle>& cells) const
+  {
+    // We need to lock v individually first, to be sure v->cell() is valid
+    if(!try_lock_vertex(v))
+      return false;
+
+    Cell_handle d = v->cell();
+    if(!try_lock_cell(d)) // LOCK
+      return false;
+
+    cells.push_back(d);
+    d->tds_data().mark_in_conflict();
+    int head = 0;
+    int tail = 1;
+    do
+    {
+      Cell_handle c = cells[head];
+
+      for(int i=0; i<4; ++i)
+      {
+        if(c->vertex(i) == v)
+          continue;
+
+        Cell_handle next = c->neighbor(i);
+        if(!try_lock_cell(next)) // LOCK
+        {
+          for(Cell_handle ch : cells)
+            ch->tds_data().clear();
+          cells.clear();
+          return false;
+        }
+
+        if(!next->tds_data().is_clear())
+          continue;
+
+        cells.push_back(next);
+        ++tail;
+        next->tds_data().mark_in_conflict();
+      }
+      ++head;
+    }
+    while(head != tail);
+
+    for(Cell_handle ch : cells)
+      ch->tds_data().clear();
+
     return true;
   }
 
+  void swap(Self& tr)
+  {
+    Base::swap(tr);
+    Lock_base::swap(tr);
+  }
+
   /// Basic setters-getters
   // there are no infinite elements in a periodic triangulation
   bool is_infinite(const Vertex_handle) const { return false; }
@@ -271,32 +362,34 @@ public:
     return incident_facets(v, facets);
   }
 
-  // Periodic triangulations cannot be used in parallel (yet), but the functions below
-  // are required for compilation. Note that these functions could already
-  // be implemented and moved to P3T3.h but to make it clear that P3M3 is
-  // not available in parallel, they are put here and left empty.
+  // There are no infinite elements in a periodic triangulation, so the functions below
+  // are simply wrappers around the functions of the triangulation data structure
+  template <class OutputIterator>
+  OutputIterator
+  incident_edges_threadsafe(Vertex_handle v, OutputIterator edges) const
+  {
+    return tds().incident_edges_threadsafe(v, edges);
+  }
 
   template <class OutputIterator>
   OutputIterator
-  incident_edges_threadsafe(Vertex_handle /* v */, OutputIterator edges) const
+  incident_facets_threadsafe(Vertex_handle v, OutputIterator facets) const
   {
-    CGAL_assertion(false); // not yet supported
-    return edges;
+    return tds().incident_facets_threadsafe(v, facets);
   }
 
   template <class OutputIterator>
   OutputIterator
-  incident_facets_threadsafe(Vertex_handle /* v */, OutputIterator facets) const
+  finite_incident_facets_threadsafe(Vertex_handle v, OutputIterator facets) const
   {
-    CGAL_assertion(false); // not yet supported
-    return facets;
+    return incident_facets_threadsafe(v, facets);
   }
 
   template <typename OutputIterator>
   void
-  incident_cells_threadsafe(Vertex_handle /* v */, OutputIterator /* cells */) const
+  incident_cells_threadsafe(Vertex_handle v, OutputIterator cells) const
   {
-    CGAL_assertion(false); // not yet supported
+    tds().incident_cells_threadsafe(v, cells);
   }
 
   void clear_v_offsets() const
@@ -593,8 +686,8 @@ public:
   ///
   /// Locate points within a periodic triangulation.
   ///
-  /// These functions are temporarily here to interface between Mesh_3 and
-  /// the periodic triangulations, until the latter are made parallel.
+  /// These functions interface between Mesh_3 and the periodic triangulations.
+  /// In parallel mode, they lock the cells they visit if `could_lock_zone` is not `nullptr`.
   ///
   /// \sa `CGAL::Regular_triangulation_3::locate`
   /// @{
@@ -718,48 +811,297 @@ public:
 
   Cell_handle locate(const Weighted_point& p,
                      Cell_handle start = Cell_handle(),
-                     bool* CGAL_assertion_code(could_lock_zone) = nullptr) const
+                     bool* could_lock_zone = nullptr) const
   {
-    CGAL_assertion(could_lock_zone == nullptr);
+    if(could_lock_zone)
+    {
+      Locate_type lt;
+      int li, lj;
+      return locate(p, lt, li, lj, start, could_lock_zone);
+    }
+
     return Base::locate(canonicalize_point(p), start);
   }
 
   Cell_handle locate(const Weighted_point& p,
                      Vertex_handle hint,
-                     bool* CGAL_assertion_code(could_lock_zone) = nullptr) const
+                     bool* could_lock_zone = nullptr) const
   {
-    CGAL_assertion(could_lock_zone == nullptr);
     // Compared to the non-periodic version in T3, the infinite cell cannot
     // be used as default hint, so `Cell_handle()` is used instead.
-    return Base::locate(canonicalize_point(p),
-                        hint == Vertex_handle() ? Cell_handle() : hint->cell());
+    return locate(p, hint == Vertex_handle() ? Cell_handle() : hint->cell(), could_lock_zone);
   }
 
   Cell_handle locate(const Weighted_point& p,
                      Locate_type& l, int& i, int& j,
                      Cell_handle start = Cell_handle(),
-                     bool* CGAL_assertion_code(could_lock_zone) = nullptr) const
+                     bool* could_lock_zone = nullptr) const
   {
-    CGAL_assertion(could_lock_zone == nullptr);
+    if(could_lock_zone)
+      return locate_and_lock(canonicalize_point(p), l, i, j, start, could_lock_zone);
+
     return Base::locate(canonicalize_point(p), l, i, j, start);
   }
 
   Cell_handle locate(const Weighted_point& p,
                      Locate_type& l, int& i, int& j,
                      Vertex_handle hint,
-                     bool* CGAL_assertion_code(could_lock_zone) = nullptr) const
+                     bool* could_lock_zone = nullptr) const
   {
-    CGAL_assertion(could_lock_zone == nullptr);
-    return Base::locate(canonicalize_point(p), l, i, j,
-                        hint == Vertex_handle() ? Cell_handle() : hint->cell());
+    return locate(p, l, i, j,
+                  hint == Vertex_handle() ? Cell_handle() : hint->cell(),
+                  could_lock_zone);
   }
   /// @}
 
+private:
+  // The function below is the walk of `Periodic_3_triangulation_3::exact_periodic_locate()`
+  // in the 1-cover, locking the cells that are visited, as in `Triangulation_3::exact_locate()`.
+  // Any change should be mirrored.
+  //
+  // \pre `p` lives in the canonical instance.
+  Cell_handle locate_and_lock(const Weighted_point& p,
+                              Locate_type& lt, int& li, int& lj,
+                              Cell_handle start,
+                              bool* could_lock_zone) const
+  {
+    CGAL_precondition(this->is_1_cover());
+    CGAL_precondition(could_lock_zone != nullptr);
+
+    *could_lock_zone = true;
+
+    if(number_of_vertices() == 0)
+    {
+      lt = Base::EMPTY;
+      return Cell_handle();
+    }
+
+    if(start == Cell_handle())
+      start = this->cells_begin();
+
+    Cell_handle c = start;
+    if(!try_lock_cell(c))
+    {
+      *could_lock_zone = false;
+      return Cell_handle();
+    }
+
+    Offset off_query;
+    int cumm_off = c->offset(0) | c->offset(1) | c->offset(2) | c->offset(3);
+    if(cumm_off != 0)
+    {
+      if(((cumm_off & 4) == 4) && (FT(2)*p.x() < (domain().xmax() + domain().xmin())))
+        off_query += Offset(1,0,0);
+      if(((cumm_off & 2) == 2) && (FT(2)*p.y() < (domain().ymax() + domain().ymin())))
+        off_query += Offset(0,1,0);
+      if(((cumm_off & 1) == 1) && (FT(2)*p.z() < (domain().zmax() + domain().zmin())))
+        off_query += Offset(0,0,1);
+    }
+
+    // Remembering stochastic walk
+    Cell_handle previous = Cell_handle();
+    Orientation o[4];
+
+    boost::rand48 rng;
+    boost::uniform_smallint<> four(0, 3);
+    boost::variate_generator<boost::rand48&, boost::uniform_smallint<> > die4(rng, four);
+
+    bool try_next_cell = true;
+    while(try_next_cell)
+    {
+      try_next_cell = false;
+
+      cumm_off = c->offset(0) | c->offset(1) | c->offset(2) | c->offset(3);
+      const bool simplicity_criterion = (cumm_off == 0) && off_query.is_null();
+
+      const Weighted_point* pts[4] = { &(c->vertex(0)->point()),
+                                       &(c->vertex(1)->point()),
+                                       &(c->vertex(2)->point()),
+                                       &(c->vertex(3)->point()) };
+      Offset off[4];
+      if(!simplicity_criterion)
+      {
+        for(int k=0; k<4; ++k)
+          off[k] = this->int_to_off(c->offset(k));
+      }
+
+      int i = die4();
+      for(int j=0; j != 4; ++j, i = (i+1)&3)
+      {
+        Cell_handle next = c->neighbor(i);
+        if(previous == next)
+        {
+          o[i] = POSITIVE;
+          continue;
+        }
+
+        // We temporarily put p at i's place in pts.
+        const Weighted_point* backup = pts[i];
+        pts[i] = &p;
+        if(simplicity_criterion)
+        {
+          o[i] = this->orientation(*pts[0], *pts[1], *pts[2], *pts[3]);
+        }
+        else
+        {
+          const Offset backup_off = off[i];
+          off[i] = off_query;
+          o[i] = this->orientation(*pts[0], *pts[1], *pts[2], *pts[3],
+                                   off[0], off[1], off[2], off[3]);
+          off[i] = backup_off;
+        }
+        pts[i] = backup;
+
+        if(o[i] != NEGATIVE)
+          continue;
+
+        off_query = this->combine_offsets(off_query, this->neighbor_offset(c, i, next));
+        previous = c;
+        c = next;
+
+        // Do not unlock "previous", "c" may be in the same locking cell
+        if(!try_lock_cell(c))
+        {
+          *could_lock_zone = false;
+          return Cell_handle();
+        }
+
+        try_next_cell = true;
+        break;
+      }
+    }
+
+    // now p is in c or on its boundary
+    const int sum = (o[0] == COPLANAR) + (o[1] == COPLANAR)
+                  + (o[2] == COPLANAR) + (o[3] == COPLANAR);
+    switch(sum)
+    {
+      case 0:
+        lt = Base::CELL;
+        break;
+      case 1:
+        lt = Base::FACET;
+        li = (o[0] == COPLANAR) ? 0 :
+             (o[1] == COPLANAR) ? 1 :
+             (o[2] == COPLANAR) ? 2 : 3;
+        break;
+      case 2:
+        lt = Base::EDGE;
+        li = (o[0] != COPLANAR) ? 0 :
+             (o[1] != COPLANAR) ? 1 : 2;
+        lj = (o[li+1] != COPLANAR) ? li+1 :
+             (o[li+2] != COPLANAR) ? li+2 : li+3;
+        break;
+      case 3:
+        lt = Base::VERTEX;
+        li = (o[0] != COPLANAR) ? 0 :
+             (o[1] != COPLANAR) ? 1 :
+             (o[2] != COPLANAR) ? 2 : 3;
+        break;
+      default:
+        // the point cannot lie on four facets
+        CGAL_assertion(false);
+    }
+
+    return c;
+  }
+
+  // The function below is the breadth-first search of `Periodic_3_triangulation_3::find_conflicts()`,
+  // which does not store the offsets of the vertices on the boundary of the conflict zone
+  // (that container is shared), and which locks the cells in conflict if `could_lock_zone`
+  // is not `nullptr`, as in `Triangulation_3::find_conflicts()`. Any change should be mirrored.
+  //
+  // The cells and the facets are marked, and must be cleared by the caller.
+  template <class OutputIteratorInternalFacets>
+  OutputIteratorInternalFacets
+  find_conflicts_in_1_cover(Cell_handle d, const Offset& d_off,
+                            const Conflict_tester& tester,
+                            std::vector<Facet>& boundary_facets,
+                            std::vector<Cell_handle>& cells,
+                            OutputIteratorInternalFacets ifit,
+                            bool* could_lock_zone,
+                            const Facet* this_facet_must_be_in_the_cz,
+                            bool* the_facet_is_in_its_cz) const
+  {
+    CGAL_precondition(tester(d, d_off));
+
+    if(could_lock_zone && !try_lock_cell(d))
+    {
+      *could_lock_zone = false;
+      return ifit;
+    }
+
+    std::stack<std::pair<Cell_handle, Offset> > cell_stack;
+    cell_stack.push(std::make_pair(d, d_off));
+    d->tds_data().mark_in_conflict();
+    cells.push_back(d);
+
+    do
+    {
+      const Cell_handle c = cell_stack.top().first;
+      const Offset c_off = cell_stack.top().second;
+      cell_stack.pop();
+
+      for(int i=0; i<4; ++i)
+      {
+        const Cell_handle test = c->neighbor(i);
+        const Facet f(c, i);
+
+        if(test->tds_data().is_in_conflict())
+        {
+          if(this_facet_must_be_in_the_cz && f == *this_facet_must_be_in_the_cz)
+            *the_facet_is_in_its_cz = true;
+          if(c < test)
+            *ifit++ = f; // Internal facet.
+          continue; // test was already in conflict.
+        }
+
+        if(test->tds_data().is_clear())
+        {
+          const Offset test_off = c_off + this->neighbor_offset(c, i, test);
+          if(tester(test, test_off))
+          {
+            if(could_lock_zone && !try_lock_cell(test))
+            {
+              *could_lock_zone = false;
+              return ifit;
+            }
+
+            if(this_facet_must_be_in_the_cz && f == *this_facet_must_be_in_the_cz)
+              *the_facet_is_in_its_cz = true;
+            if(c < test)
+              *ifit++ = f; // Internal facet.
+
+            cell_stack.push(std::make_pair(test, test_off));
+            test->tds_data().mark_in_conflict();
+            cells.push_back(test);
+            continue;
+          }
+
+          test->tds_data().mark_on_boundary();
+        }
+
+        // Boundary facet.
+        if(this_facet_must_be_in_the_cz &&
+           (f == *this_facet_must_be_in_the_cz ||
+            this->mirror_facet(f) == *this_facet_must_be_in_the_cz))
+        {
+          *the_facet_is_in_its_cz = true;
+        }
+        boundary_facets.push_back(f);
+      }
+    }
+    while(!cell_stack.empty());
+
+    return ifit;
+  }
+
+public:
   /// \name Conflict functions
   /// Returns the vertices on the interior of the conflict hole.
   ///
-  /// These functions are temporarily here to interface between Mesh_3 and
-  /// the periodic triangulations, until the latter are made parallel.
+  /// These functions interface between Mesh_3 and the periodic triangulations.
+  /// In parallel mode, they lock the cells they visit if `could_lock_zone` is not `nullptr`.
   ///
   /// @{
   template <class OutputIterator>
@@ -780,34 +1122,62 @@ public:
                  OutputIteratorBoundaryFacets bfit,
                  OutputIteratorCells cit,
                  OutputIteratorInternalFacets ifit,
-                 bool* CGAL_assertion_code(could_lock_zone) = nullptr,
-                 const Facet* /* this_facet_must_be_in_the_cz */ = nullptr,
-                 bool* /* the_facet_is_in_its_cz */ = nullptr) const
+                 bool* could_lock_zone = nullptr,
+                 const Facet* this_facet_must_be_in_the_cz = nullptr,
+                 bool* the_facet_is_in_its_cz = nullptr) const
   {
-    CGAL_precondition(could_lock_zone == nullptr);
     CGAL_precondition(number_of_vertices() != 0);
-
-    clear_v_offsets();
+    CGAL_precondition(is_parallel_tds || could_lock_zone == nullptr);
 
     Weighted_point canonic_p = canonicalize_point(p);
 
-    Locate_type lt;
-    int li, lj;
-    c = locate(canonic_p, lt, li, lj, c);
-
     std::vector<Facet> facets;
     facets.reserve(64);
     std::vector<Cell_handle> cells;
     cells.reserve(32);
 
     Conflict_tester tester(canonic_p, this);
-    Triple<typename std::back_insert_iterator<std::vector<Facet> >,
-           typename std::back_insert_iterator<std::vector<Cell_handle> >,
-           OutputIteratorInternalFacets> tit =
-             Base::find_conflicts(c, tester,
-                                  make_triple(std::back_inserter(facets),
-                                              std::back_inserter(cells), ifit));
-    ifit = tit.third;
+
+    if constexpr(is_parallel_tds)
+    {
+      // The offsets of the vertices are not stored, as several threads could be
+      // looking for conflicts at the same time
+      if(the_facet_is_in_its_cz)
+        *the_facet_is_in_its_cz = false;
+      else
+        this_facet_must_be_in_the_cz = nullptr;
+
+      Locate_type lt;
+      int li, lj;
+      c = locate(canonic_p, lt, li, lj, c, could_lock_zone);
+      if(could_lock_zone && !*could_lock_zone)
+        return make_triple(bfit, cit, ifit);
+
+      // Choose the periodic copy of the point that is in conflict with c
+      bool found = false;
+      const Offset off = this->get_location_offset(tester, c, found);
+      if(found)
+      {
+        ifit = find_conflicts_in_1_cover(c, off, tester, facets, cells, ifit, could_lock_zone,
+                                         this_facet_must_be_in_the_cz, the_facet_is_in_its_cz);
+      }
+    }
+    else
+    {
+      clear_v_offsets();
+
+      Locate_type lt;
+      int li, lj;
+      c = locate(canonic_p, lt, li, lj, c);
+
+      Triple<typename std::back_insert_iterator<std::vector<Facet> >,
+             typename std::back_insert_iterator<std::vector<Cell_handle> >,
+             OutputIteratorInternalFacets> tit =
+               Base::find_conflicts(c, tester,
+                                    make_triple(std::back_inserter(facets),
+                                                std::back_inserter(cells), ifit));
+      ifit = tit.third;
+    }
 
     // Reset the conflict flag on the boundary.
     for(typename std::vector<Facet>::iterator fit=facets.begin();
@@ -833,8 +1203,6 @@ public:
                  OutputIteratorCells cit,
                  bool* could_lock_zone = nullptr) const
   {
-    CGAL_assertion(could_lock_zone == nullptr);
-
     Triple<OutputIteratorBoundaryFacets,
            OutputIteratorCells,
            Emptyset_iterator> t = find_conflicts(p, c, bfit, cit,
@@ -857,43 +1225,188 @@ public:
   ///
   /// Insert points in the triangulation.
   ///
-  /// These functions are temporarily here to interface between Mesh_3 and
-  /// the periodic triangulations, until the latter are made parallel.
+  /// These functions interface between Mesh_3 and the periodic triangulations.
+  /// In parallel mode, they lock the cells they visit if `could_lock_zone` is not `nullptr`.
   ///
   /// @{
   template <class CellIt>
   Vertex_handle insert_in_hole(const Weighted_point& p,
-                               CellIt /*cell_begin*/, CellIt /*cell_end*/,
-                               Cell_handle /*begin*/, int /*i*/)
+                               CellIt cell_begin, CellIt cell_end,
+                               Cell_handle begin, int i)
   {
-    // Could be optimized to use the conflict zone by extracting relevant
-    // code from periodic_insert() in P3T3.
-    return this->insert(p);
+    if constexpr(!is_parallel_tds)
+    {
+      // Could be optimized to use the conflict zone by extracting relevant
+      // code from periodic_insert() in P3T3.
+      return this->insert(p);
+    }
+
+    // The function below is the insertion of `Periodic_3_triangulation_3::periodic_insert()`
+    // in the 1-cover, in a (locked) conflict zone. Any change should be mirrored.
+    CGAL_precondition(this->is_1_cover());
+
+    const Weighted_point canonic_p = canonicalize_point(p);
+    Conflict_tester tester(canonic_p, this);
+
+    // Choose the periodic copy of the point that is in conflict with a cell of the hole.
+    // The copies of the point in conflict with the other cells may have negative offsets,
+    // hence the search starts with the first cell of the hole (the located cell, see find_conflicts()).
+    bool found = false;
+    Cell_handle start;
+    Offset start_off;
+    for(CellIt cit = cell_begin; cit != cell_end && !found; ++cit)
+    {
+      start = *cit;
+      start_off = this->get_location_offset(tester, start, found);
+    }
+    CGAL_assertion(found);
+
+    // Walk through the hole to get the offsets of the vertices on its boundary.
+    // The cells of the hole that have not yet been visited are marked 'on boundary',
+    // and the visited ones 'in conflict', which is the marking expected by the TDS.
+    for(CellIt cit = cell_begin; cit != cell_end; ++cit)
+      (*cit)->tds_data().mark_on_boundary();
+
+    std::vector<Vertex_handle> boundary_vertices;
+    boundary_vertices.reserve(48);
+
+    std::stack<std::pair<Cell_handle, Offset> > cell_stack;
+    cell_stack.push(std::make_pair(start, start_off));
+    start->tds_data().mark_in_conflict();
+    do
+    {
+      const Cell_handle c = cell_stack.top().first;
+      const Offset c_off = cell_stack.top().second;
+      cell_stack.pop();
+
+      for(int j=0; j<4; ++j)
+      {
+        const Cell_handle test = c->neighbor(j);
+        if(test->tds_data().is_in_conflict())
+          continue;
+
+        if(test->tds_data().is_on_boundary())
+        {
+          test->tds_data().mark_in_conflict();
+          cell_stack.push(std::make_pair(test, c_off + this->neighbor_offset(c, j, test)));
+          continue;
+        }
+
+        // (c, j) is a boundary facet of the hole
+        for(int k=0; k<4; ++k)
+        {
+          if(k == j)
+            continue;
+          Vertex_handle v = c->vertex(k);
+          if(!v->get_offset_flag())
+          {
+            v->set_offset(this->int_to_off(c->offset(k)) - c_off);
+            boundary_vertices.push_back(v);
+          }
+        }
+      }
+    }
+    while(!cell_stack.empty());
+
+    // Remember the vertices of the hole: those that are not incident to a cell
+    // after the insertion are hidden by the new point
+    std::vector<Vertex_handle> hole_vertices;
+    hole_vertices.reserve(48);
+    for(CellIt cit = cell_begin; cit != cell_end; ++cit)
+    {
+      CGAL_assertion((*cit)->tds_data().is_in_conflict());
+      for(int k=0; k<4; ++k)
+      {
+        Vertex_handle v = (*cit)->vertex(k);
+        if(v->cell() != Cell_handle())
+        {
+          hole_vertices.push_back(v);
+          v->set_cell(Cell_handle());
+        }
+      }
+    }
+
+    Vertex_handle v = tds()._insert_in_hole(cell_begin, cell_end, begin, i);
+    v->set_point(canonic_p);
+
+    std::vector<Cell_handle> nbs;
+    incident_cells(v, std::back_inserter(nbs));
+    for(const Cell_handle c : nbs)
+    {
+      set_offsets(c, c->vertex(0)->offset(), c->vertex(1)->offset(),
+                     c->vertex(2)->offset(), c->vertex(3)->offset());
+    }
+
+    for(const Vertex_handle bv : boundary_vertices)
+      bv->clear_offset();
+
+    for(const Vertex_handle hv : hole_vertices)
+    {
+      if(hv->cell() == Cell_handle())
+        tds().delete_vertex(hv);
+    }
+
+    return v;
   }
 
   Vertex_handle insert(const Weighted_point& p,
                        Cell_handle start = Cell_handle(),
-                       bool* CGAL_assertion_code(could_lock_zone) = nullptr)
+                       bool* could_lock_zone = nullptr)
   {
+    if constexpr(is_parallel_tds)
+    {
+      Locate_type lt;
+      int li, lj;
+      Cell_handle c = locate(p, lt, li, lj, start, could_lock_zone);
+      if(could_lock_zone && !*could_lock_zone)
+        return Vertex_handle();
+
+      return insert(p, lt, c, li, lj, could_lock_zone);
+    }
+
     CGAL_assertion(could_lock_zone == nullptr);
     return Base::insert(canonicalize_point(p), start);
   }
 
   Vertex_handle insert(const Weighted_point& p,
                        Vertex_handle hint,
-                       bool* CGAL_assertion_code(could_lock_zone) = nullptr)
+                       bool* could_lock_zone = nullptr)
   {
-    CGAL_assertion(could_lock_zone == nullptr);
     // compared to the non-periodic version in T3, the infinite cell cannot
     // be used; `Cell_handle()` is used instead
-    return Base::insert(canonicalize_point(p),
-                        hint == Vertex_handle() ? Cell_handle() : hint->cell());
+    return insert(p, hint == Vertex_handle() ? Cell_handle() : hint->cell(), could_lock_zone);
   }
 
   Vertex_handle insert(const Weighted_point& p,
                        Locate_type lt, Cell_handle loc, int li, int lj,
-                       bool* CGAL_assertion_code(could_lock_zone) = nullptr)
+                       bool* could_lock_zone = nullptr)
   {
+    if constexpr(is_parallel_tds)
+    {
+      CGAL_precondition(number_of_vertices() != 0);
+
+      const Weighted_point canonic_p = canonicalize_point(p);
+      Conflict_tester tester(canonic_p, this);
+      if(lt == Base::VERTEX && tester.compare_weight(loc->vertex(li)->point(), canonic_p) == 0)
+        return loc->vertex(li);
+
+      std::vector<Facet> facets;
+      facets.reserve(64);
+      std::vector<Cell_handle> cells;
+      cells.reserve(32);
+      find_conflicts(canonic_p, loc, std::back_inserter(facets), std::back_inserter(cells),
+                     could_lock_zone);
+      if(could_lock_zone && !*could_lock_zone)
+        return Vertex_handle();
+
+      // the point is hidden
+      if(cells.empty())
+        return Vertex_handle();
+
+      return insert_in_hole(canonic_p, cells.begin(), cells.end(),
+                            facets.front().first, facets.front().second);
+    }
+
     CGAL_assertion(could_lock_zone == nullptr);
     return Base::insert(canonicalize_point(p), lt, loc, li, lj);
   }
@@ -901,9 +1414,19 @@ public:
 
   /// Remove functions
   bool remove(Vertex_handle v,
-              bool* CGAL_assertion_code(could_lock_zone) = nullptr)
+              bool* could_lock_zone = nullptr)
   {
-    CGAL_assertion(could_lock_zone == nullptr);
+    if(could_lock_zone)
+    {
+      // the hole is made of the incident cells, and the cells created
+      // when filling it only have vertices on its boundary
+      std::vector<Cell_handle> cells;
+      cells.reserve(64);
+      *could_lock_zone = try_lock_and_get_incident_cells(v, cells);
+      if(!*could_lock_zone)
+        return false;
+    }
+
     bool b = Base::remove_if_no_cover_change(v);
     CGAL_postcondition(this->is_1_cover()); // do not ever allow cover change
     return b;
@@ -1053,7 +1576,8 @@ public:
 template<class MD,
          class K_ = Default,
          class Vertex_base_ = Default,
-         class Cell_base_ = Default>
+         class Cell_base_ = Default,
+         class Concurrency_tag_ = Sequential_tag>
 class Periodic_3_mesh_triangulation_3
 {
   // Triangulation_vertex_base_with_info_3 only does default initialization
@@ -1074,8 +1598,17 @@ class Periodic_3_mesh_triangulation_3
   typedef Regular_triangulation_vertex_base_3<Geom_traits, VbDS> PVb;
   typedef Triangulation_vertex_base_with_info_3<Boolean_with_def_value, Geom_traits, PVb> Vb;
 
+  // Concurrency
+  typedef typename Default::Get<Concurrency_tag_, Sequential_tag>::type Concurrency_tag;
+
+  // In parallel mode, points hidden by an insertion are not stored (as in Mesh_3),
+  // since re-inserting them after a removal would require walking outside of the locked zone
+  typedef std::conditional_t<std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                             Discard_hidden_points,
+                             Keep_hidden_points>                  Hidden_points_policy;
+
   typedef Periodic_3_triangulation_ds_cell_base_3<> CbDS;
-  typedef Regular_triangulation_cell_base_3<Geom_traits, CbDS> RCb;
+  typedef Regular_triangulation_cell_base_3<Geom_traits, CbDS, Hidden_points_policy> RCb;
   typedef Regular_triangulation_cell_base_with_weighted_circumcenter_3<Geom_traits, RCb> PCb;
 
   typedef Mesh_vertex_base_3<Geom_traits, MD, Vb> Default_Vb;
@@ -1086,7 +1619,7 @@ class Periodic_3_mesh_triangulation_3
   typedef typename Default::Get<Cell_base_, Default_Cb>::type Cell_base;
 
   // Triangulation and tds
-  typedef Triangulation_data_structure_3<Vertex_base, Cell_base> Tds;
+  typedef Triangulation_data_structure_3<Vertex_base, Cell_base, Concurrency_tag> Tds;
   typedef Periodic_3_regular_triangulation_3_wrapper<Geom_traits, Tds> Triangulation;
 
 public:
@@ -324,6 +324,14 @@ struct C3t3_initializer<C3T3, MeshDomain, MeshCriteria, true, CGAL::Tag_true>
  *                           </UL>}
  *     \cgalParamDefault{`parameters::exude()`}
  *   \cgalParamSectionEnd
+ *   \cgalParamSectionBegin{Statistics}
+ *     \cgalParamDescription{`parameters::statistics(s)`, where `s` is a pointer to a `Mesh_3::Mesh_statistics`,
+ *                           fills `s` with the time, the number of insertions, the number of lock conflicts
+ *                           and the maximal size of the refinement queue of each phase of the mesh generation,
+ *                           and with the peak memory of the process.}
+ *     \cgalParamType{`Mesh_3::Mesh_statistics*`}
+ *     \cgalParamDefault{`nullptr`: no statistics are gathered}
+ *   \cgalParamSectionEnd
  * \cgalNamedParamsEnd
  *
  *  The optimization parameters can be passed in an arbitrary order. If one parameter
@@ -363,6 +371,7 @@ C3T3 make_periodic_3_mesh_3(const MeshDomain& domain, const MeshCriteria& criter
   parameters::internal::Lloyd_options lloyd_param = choose_parameter(get_parameter(np, internal_np::lloyd_options_param), parameters::no_lloyd().v);
   parameters::internal::Features_options features_param = choose_parameter(get_parameter(np, internal_np::features_options_param), parameters::features(domain).v);
   parameters::internal::Mesh_3_options mesh_options_param = choose_parameter(get_parameter(np, internal_np::mesh_param), parameters::internal::Mesh_3_options());
+  mesh_options_param.pointer_to_statistics = choose_parameter(get_parameter(np, internal_np::statistics_param), mesh_options_param.pointer_to_statistics);
   parameters::internal::Manifold_options manifold_options_param = choose_parameter(get_parameter(np, internal_np::manifold_param), parameters::internal::Manifold_options());
 
   make_periodic_3_mesh_3_impl(c3t3, domain, criteria,
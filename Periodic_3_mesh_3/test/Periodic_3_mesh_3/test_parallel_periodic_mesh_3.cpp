@@ -0,0 +1,126 @@
+#include <CGAL/Periodic_3_mesh_3/config.h>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/make_periodic_3_mesh_3.h>
+#include <CGAL/optimize_periodic_3_mesh_3.h>
+#include <CGAL/Periodic_3_mesh_triangulation_3.h>
+
+#include <CGAL/Labeled_mesh_domain_3.h>
+#include <CGAL/Mesh_complex_3_in_triangulation_3.h>
+#include <CGAL/Mesh_criteria_3.h>
+
+#include <CGAL/number_type_config.h> // CGAL_PI
+#include <CGAL/Real_timer.h>
+
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+// Checks that periodic meshes can be generated and optimized with `Parallel_tag`,
+// and that they are similar to the meshes generated sequentially.
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::FT                                               FT;
+typedef K::Point_3                                          Point;
+typedef K::Iso_cuboid_3                                     Iso_cuboid;
+
+typedef CGAL::Labeled_mesh_domain_3<K>                      Periodic_mesh_domain;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+namespace params = CGAL::parameters;
+
+FT double_p(const Point& p)
+{
+  const FT cx = std::cos(2 * CGAL_PI * p.x()),
+           cy = std::cos(2 * CGAL_PI * p.y()),
+           cz = std::cos(2 * CGAL_PI * p.z());
+  const FT c2x = std::cos(4 * CGAL_PI * p.x()),
+           c2y = std::cos(4 * CGAL_PI * p.y()),
+           c2z = std::cos(4 * CGAL_PI * p.z());
+
+  return 0.5 * (cx*cy + cy*cz + cz*cx) + 0.2 * (c2x + c2y + c2z);
+}
+
+template <typename C3t3>
+void check_c3t3(const C3t3& c3t3)
+{
+  assert(c3t3.triangulation().is_1_cover());
+  assert(c3t3.triangulation().tds().is_valid());
+  assert(c3t3.triangulation().is_valid());
+  assert(c3t3.number_of_cells_in_complex() > 0);
+  assert(c3t3.number_of_facets_in_complex() > 0);
+}
+
+template <typename Tag>
+std::size_t mesh(const Periodic_mesh_domain& domain)
+{
+  typedef typename CGAL::Periodic_3_mesh_triangulation_3<Periodic_mesh_domain,
+                                                         CGAL::Default, CGAL::Default, CGAL::Default,
+                                                         Tag>::type Tr;
+  typedef CGAL::Mesh_complex_3_in_triangulation_3<Tr>                 C3t3;
+  typedef CGAL::Mesh_criteria_3<Tr>                                   Periodic_mesh_criteria;
+
+  Periodic_mesh_criteria criteria(params::facet_angle(30)
+                                         .facet_size(0.05)
+                                         .facet_distance(0.025)
+                                         .cell_radius_edge_ratio(2.)
+                                         .cell_size(0.05));
+
+  CGAL::Real_timer timer;
+  timer.start();
+  C3t3 c3t3 = CGAL::make_periodic_3_mesh_3<C3t3>(domain, criteria,
+                                                 params::odt(params::max_iteration_number(5)),
+                                                 params::lloyd(params::max_iteration_number(5)),
+                                                 params::perturb(params::sliver_bound(10).time_limit(10)),
+                                                 params::exude(params::sliver_bound(10).time_limit(10)));
+  std::cout << "  " << c3t3.triangulation().number_of_vertices() << " vertices, "
+            << c3t3.number_of_cells_in_complex() << " cells, "
+            << timer.time() << " s." << std::endl;
+  check_c3t3(c3t3);
+
+  // refinement with smaller criteria, and each optimizer with its global function
+  Periodic_mesh_criteria new_criteria(params::facet_angle(30)
+                                             .facet_size(0.04)
+                                             .facet_distance(0.02)
+                                             .cell_radius_edge_ratio(2.)
+                                             .cell_size(0.04));
+  CGAL::refine_periodic_3_mesh_3(c3t3, domain, new_criteria, params::no_exude().no_perturb());
+  check_c3t3(c3t3);
+
+  CGAL::odt_optimize_periodic_3_mesh_3(c3t3, domain, params::max_iteration_number(3));
+  check_c3t3(c3t3);
+  CGAL::lloyd_optimize_periodic_3_mesh_3(c3t3, domain, params::max_iteration_number(3));
+  check_c3t3(c3t3);
+  CGAL::perturb_periodic_3_mesh_3(c3t3, domain, params::sliver_bound(10).time_limit(10));
+  check_c3t3(c3t3);
+  CGAL::exude_periodic_3_mesh_3(c3t3, params::sliver_bound(10).time_limit(10));
+  check_c3t3(c3t3);
+
+  return c3t3.triangulation().number_of_vertices();
+}
+
+int main(int, char**)
+{
+  Iso_cuboid canonical_cube(0, 0, 0, 1, 1, 1);
+  Periodic_mesh_domain domain =
+    Periodic_mesh_domain::create_implicit_mesh_domain(double_p, canonical_cube);
+
+  std::cout << "Sequential" << std::endl;
+  const double nv_seq = static_cast<double>(mesh<CGAL::Sequential_tag>(domain));
+
+  std::cout << "Parallel" << std::endl;
+  const double nv_par = static_cast<double>(mesh<Concurrency_tag>(domain));
+
+  // the insertion order is not the same, but the meshes are similar
+  assert(0.8 * nv_seq < nv_par && nv_par < 1.2 * nv_seq);
+
+  std::cout << "EXIT SUCCESS" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+// Compares the sequential and the parallel bulk insertion of random points,
+// and the re-insertion of moved points, as in a particle simulation.
+//
+// Usage: Periodic_3_Delaunay_3_parallel_bench [N] [steps] [displacement]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Periodic_3_Delaunay_triangulation_3.h>
+#include <CGAL/Periodic_3_Delaunay_triangulation_traits_3.h>
+
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel       K;
+typedef CGAL::Periodic_3_Delaunay_triangulation_traits_3<K>        GT;
+typedef CGAL::Periodic_3_Delaunay_triangulation_3<GT>              Triang;
+typedef Triang::Point                                             Point;
+typedef Triang::Vertex_handle                                     Vertex_handle;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                        Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                                      Concurrency_tag;
+#endif
+
+template <class Tag>
+double bench_moves(Triang& T, int steps, double d, CGAL::Random& random, Tag tag)
+{
+  CGAL::Real_timer timer;
+  std::vector<std::pair<Vertex_handle, Point> > moves;
+  std::vector<Vertex_handle> new_vertices;
+  for(int s=0; s<steps; ++s)
+  {
+    moves.clear();
+    for(Triang::Vertex_iterator vit = T.vertices_begin(); vit != T.vertices_end(); ++vit)
+    {
+      double c[3] = { vit->point().x(), vit->point().y(), vit->point().z() };
+      for(int i=0; i<3; ++i) {
+        c[i] += random.get_double(-d, d);
+        if(c[i] < 0.) c[i] += 1.;
+        if(c[i] >= 1.) c[i] -= 1.;
+      }
+      moves.push_back(std::make_pair(vit, Point(c[0], c[1], c[2])));
+    }
+
+    new_vertices.clear();
+    timer.start();
+    T.move_points(moves.begin(), moves.end(), std::back_inserter(new_vertices), tag);
+    timer.stop();
+  }
+  return timer.time();
+}
+
+int main(int argc, char* argv[])
+{
+  const int n = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+  const int steps = (argc > 2) ? std::atoi(argv[2]) : 3;
+  const double d = (argc > 3) ? std::atof(argv[3]) : 0.001;
+
+  CGAL::Random random(7);
+  CGAL::Random_points_in_cube_3<Point> in_cube(.5, random);
+  std::vector<Point> points;
+  points.reserve(n);
+  for(int i=0; i<n; ++i) {
+    const Point p = *in_cube++;
+    points.push_back(Point(p.x()+.5, p.y()+.5, p.z()+.5));
+  }
+
+  CGAL::Real_timer timer;
+  std::cout << n << " points" << std::endl;
+
+  Triang T_seq;
+  timer.start();
+  T_seq.insert(points.begin(), points.end(), true);
+  timer.stop();
+  std::cout << "sequential insert: " << timer.time() << " sec" << std::endl;
+
+  Triang T_par;
+  timer.reset();
+  timer.start();
+  T_par.insert(points.begin(), points.end(), Concurrency_tag());
+  timer.stop();
+  std::cout << "parallel insert: " << timer.time() << " sec" << std::endl;
+
+  if(!(T_seq == T_par)) {
+    std::cerr << "Error: the triangulations differ" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  CGAL::Random random_seq(11), random_par(11);
+  std::cout << steps << " steps of moves, sequential: "
+            << bench_moves(T_seq, steps, d, random_seq, CGAL::Sequential_tag())
+            << " sec" << std::endl;
+  std::cout << steps << " steps of moves, parallel: "
+            << bench_moves(T_par, steps, d, random_par, Concurrency_tag())
+            << " sec" << std::endl;
+
+  return EXIT_SUCCESS;
+}
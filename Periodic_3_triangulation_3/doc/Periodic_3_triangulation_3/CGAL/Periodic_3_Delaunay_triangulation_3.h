@@ -119,6 +119,29 @@ std::ptrdiff_t
 insert(InputIterator first, InputIterator last,
 bool is_large_point_set = false);
 
+/*!
+Inserts the points in the range `[first, last)`. Returns the number of
+inserted points.
+
+If `ConcurrencyTag` is `Parallel_tag`, the triangulation is computed
+from scratch from its current vertices and the new points: it is
+obtained, in parallel, from the Euclidean Delaunay triangulation of
+these points and of their periodic copies that are close to the
+original domain, and is then checked with the periodic predicates.
+The vertex handles of the triangulation remain valid. If the points do not
+admit a triangulation in the 1-sheeted covering space, or if the
+check fails, the points are inserted sequentially as
+with `insert(first, last)`. With `Sequential_tag`, this function is
+equivalent to `insert(first, last)`.
+
+\pre The `value_type` of `first` and `last` are points lying inside the original domain.
+\pre The triangulation is empty, or is in the 1-sheeted covering space, for the parallel construction to take place.
+\pre `ConcurrencyTag` is `Sequential_tag` or `Parallel_tag`. With `Parallel_tag`, TBB must be available.
+*/
+template < class InputIterator, class ConcurrencyTag >
+std::ptrdiff_t
+insert(InputIterator first, InputIterator last, ConcurrencyTag tag);
+
 /// @}
 
 /// \name Point moving
@@ -133,6 +156,25 @@ not moved much. Returns the handle to the new vertex.
 */
 Vertex_handle move_point(Vertex_handle v, const Point & p);
 
+/*!
+Moves the vertices of the range `[first, last)` to their new positions,
+and writes the handles of the vertices at the new positions into `out`,
+in the same order.
+
+If the triangulation is in the 1-sheeted covering space and at least an
+eighth of its vertices move, the triangulation is recomputed from the
+new positions as with `insert(first, last, tag)`, and the vertex handles
+are kept. Otherwise, or if this fails, the points are moved one by one
+with `move_point()`.
+
+\tparam InputIterator must be an input iterator with value type `std::pair<Vertex_handle, Point>`.
+\tparam OutputIterator must be an output iterator accepting `Vertex_handle`.
+\pre The vertices of the range are distinct, and the new points lie in the original domain.
+*/
+template < class InputIterator, class OutputIterator, class ConcurrencyTag = Sequential_tag >
+OutputIterator move_points(InputIterator first, InputIterator last,
+                           OutputIterator out, ConcurrencyTag tag = ConcurrencyTag());
+
 /// @}
 
 /*! \name Removal
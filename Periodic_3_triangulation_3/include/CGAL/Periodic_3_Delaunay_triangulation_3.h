@@ -25,7 +25,25 @@
 #include <CGAL/Periodic_3_triangulation_3/internal/Periodic_3_Delaunay_triangulation_remove_traits_3.h>
 #include <CGAL/Delaunay_triangulation_3.h>
 
+// Needed by the bulk construction
+#include <CGAL/Delaunay_triangulation_cell_base_3.h>
+#include <CGAL/Handle_hash_function.h>
+#include <CGAL/Triangulation_cell_base_with_info_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+#include <boost/unordered_map.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <iostream>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 #include <utility>
 
@@ -537,12 +555,60 @@ public:
     return number_of_vertices() - n;
   }
 
+  // Inserts the points of the range [first, last). With `Parallel_tag`,
+  // the triangulation is recomputed from scratch, in parallel, if the
+  // points of the range and the current vertices admit a 1-sheeted
+  // triangulation; the existing vertex handles remain valid.
+  // Otherwise, the points are inserted sequentially.
+  template < class InputIterator, class ConcurrencyTag >
+  std::ptrdiff_t insert(InputIterator first, InputIterator last,
+                        ConcurrencyTag tag,
+                        std::enable_if_t<std::is_convertible<ConcurrencyTag, Sequential_tag>::value ||
+                                         std::is_convertible<ConcurrencyTag, Parallel_tag>::value>* = nullptr)
+  {
+    if(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+      return insert(first, last, false);
+
+    if(first == last) return 0;
+    size_type n = number_of_vertices();
+    if(n != 0 && !is_1_cover())
+      return insert(first, last, false);
+
+    std::vector<Vertex_handle> vertices;
+    std::vector<Point> points;
+    vertices.reserve(n);
+    points.reserve(n);
+    for(Vertex_iterator vit = vertices_begin(); vit != vertices_end(); ++vit) {
+      vertices.push_back(vit);
+      points.push_back(vit->point());
+    }
+    points.insert(points.end(), first, last);
+    vertices.resize(points.size(), Vertex_handle());
+
+    if(!rebuild_1_sheeted_triangulation(vertices, points, tag))
+      insert(points.begin() + n, points.end(), false);
+
+    return number_of_vertices() - n;
+  }
+
   /** @name Point moving */
   // @todo should be deprecated and a function move() should be introduced
   // see what is done in /Triangulation_3
   // Also need to introduce move() for periodic regular triangulations
   Vertex_handle move_point(Vertex_handle v, const Point& p);
 
+  // Moves the vertices of the range [first, last), whose value type is
+  // `std::pair<Vertex_handle, Point>`, to their new position, and writes
+  // the vertex handles at the new positions into `out`, in the same order.
+  // When a large part of the vertices move, the triangulation is rebuilt
+  // from the moved points, which preserves the vertex handles, instead
+  // of moving the points one by one.
+  template < class InputIterator, class OutputIterator,
+             class ConcurrencyTag = Sequential_tag >
+  OutputIterator move_points(InputIterator first, InputIterator last,
+                             OutputIterator out,
+                             ConcurrencyTag tag = ConcurrencyTag());
+
 
 public:
   /** @name Removal */
@@ -592,6 +658,19 @@ public:
   }
 
 private:
+  /** @name Bulk construction helpers */
+  template < class ConcurrencyTag >
+  bool rebuild_1_sheeted_triangulation(const std::vector<Vertex_handle>& vertices,
+                                       const std::vector<Point>& points,
+                                       ConcurrencyTag tag);
+
+  enum Rebuild_status { REBUILT, MARGIN_TOO_SMALL, NOT_REBUILDABLE };
+
+  template < class ConcurrencyTag >
+  Rebuild_status rebuild_1_sheeted_triangulation(const std::vector<Vertex_handle>& vertices,
+                                                 const std::vector<Point>& points,
+                                                 double margin, ConcurrencyTag tag);
+
   /** @name Query helpers */
   Bounded_side _side_of_sphere(const Cell_handle& c, const Point& p,
       const Offset & offset = Offset(), bool perturb = false) const;
@@ -907,6 +986,353 @@ move_point(Vertex_handle v, const Point& p)
   return insert(p);
 }
 
+template < class Gt, class Tds >
+template < class InputIterator, class OutputIterator, class ConcurrencyTag >
+OutputIterator
+Periodic_3_Delaunay_triangulation_3<Gt,Tds>::
+move_points(InputIterator first, InputIterator last, OutputIterator out,
+            ConcurrencyTag tag)
+{
+  std::vector<std::pair<Vertex_handle, Point> > moves(first, last);
+
+  // A rebuild costs about as much as the insertion of all the points:
+  // it is only worth it if a sizeable part of the vertices move.
+  if(is_1_cover() && 8 * moves.size() >= number_of_vertices())
+  {
+    std::vector<Vertex_handle> vertices;
+    std::vector<Point> points;
+    boost::unordered_map<Vertex_handle, std::size_t, Handle_hash_function> indices;
+    vertices.reserve(number_of_vertices());
+    points.reserve(number_of_vertices());
+    for(Vertex_iterator vit = vertices_begin(); vit != vertices_end(); ++vit) {
+      indices[vit] = vertices.size();
+      vertices.push_back(vit);
+      points.push_back(vit->point());
+    }
+    for(const std::pair<Vertex_handle, Point>& m : moves)
+      points[indices[m.first]] = m.second;
+
+    if(rebuild_1_sheeted_triangulation(vertices, points, tag)) {
+      for(const std::pair<Vertex_handle, Point>& m : moves)
+        *out++ = m.first;
+      return out;
+    }
+  }
+
+  for(const std::pair<Vertex_handle, Point>& m : moves)
+    *out++ = move_point(m.first, m.second);
+  return out;
+}
+
+// Recomputes the triangulation of `points` as a 1-sheeted triangulation,
+// reusing the non-null handles of `vertices` for the corresponding points.
+// Returns `false`, and leaves the triangulation untouched, if it fails.
+template < class Gt, class Tds >
+template < class ConcurrencyTag >
+bool
+Periodic_3_Delaunay_triangulation_3<Gt,Tds>::
+rebuild_1_sheeted_triangulation(const std::vector<Vertex_handle>& vertices,
+                                const std::vector<Point>& points,
+                                ConcurrencyTag tag)
+{
+  CGAL_precondition(vertices.size() == points.size());
+
+  // Small point sets are unlikely to have a 1-sheeted triangulation.
+  if(points.size() < 64)
+    return false;
+
+  // The copies must cover the circumballs of the cells crossing the
+  // boundary of the domain, whose radii are of the order of the mean
+  // distance between the points.
+  const double side = CGAL::to_double(domain().xmax() - domain().xmin());
+  double margin = 3. * side / std::cbrt(double(points.size()));
+  for(int attempt = 0; attempt < 4; ++attempt)
+  {
+    margin = (std::min)(margin, side);
+    switch(rebuild_1_sheeted_triangulation(vertices, points, margin, tag))
+    {
+      case REBUILT: return true;
+      case NOT_REBUILDABLE: return false;
+      case MARGIN_TOO_SMALL: break;
+    }
+    if(margin == side)
+      break;
+    margin *= 2;
+  }
+  return false;
+}
+
+// The triangulation is obtained from the Euclidean Delaunay triangulation
+// of the points and of their periodic copies that are closer than `margin`
+// to the domain, which can be computed in parallel. The periodic cells
+// are then checked with the exact periodic predicates.
+template < class Gt, class Tds >
+template < class ConcurrencyTag >
+typename Periodic_3_Delaunay_triangulation_3<Gt,Tds>::Rebuild_status
+Periodic_3_Delaunay_triangulation_3<Gt,Tds>::
+rebuild_1_sheeted_triangulation(const std::vector<Vertex_handle>& vertices,
+                                const std::vector<Point>& points,
+                                double margin, ConcurrencyTag)
+{
+  constexpr bool is_parallel = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!is_parallel, "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  // A copy is identified by `27 * i + k`, where `i` is the index of its
+  // point and `k` the index of its offset in {-1,0,1}^3.
+  typedef typename Gt::Kernel                                        EK;
+  typedef Triangulation_vertex_base_with_info_3<std::size_t, EK>      EVb;
+  typedef Triangulation_cell_base_with_info_3<
+            Cell_handle, EK, Delaunay_triangulation_cell_base_3<EK> > ECb;
+  typedef Triangulation_data_structure_3<EVb, ECb, ConcurrencyTag>    ETds;
+  typedef Delaunay_triangulation_3<EK, ETds>                          EDT;
+  typedef typename EDT::Vertex_handle                                 EVertex_handle;
+  typedef typename EDT::Cell_handle                                   ECell_handle;
+
+  const std::size_t zero_offset = 13;
+  auto offset_index = [](const Offset& o) -> std::size_t {
+    return 9*(o.x()+1) + 3*(o.y()+1) + (o.z()+1);
+  };
+  auto index_offset = [](std::size_t k) -> Offset {
+    return Offset(int(k/9) - 1, int((k/3)%3) - 1, int(k%3) - 1);
+  };
+
+  const Iso_cuboid& dom = domain();
+  const double side = CGAL::to_double(dom.xmax() - dom.xmin());
+  const double lo[3] = { CGAL::to_double(dom.xmin()),
+                         CGAL::to_double(dom.ymin()),
+                         CGAL::to_double(dom.zmin()) };
+
+  std::vector<std::pair<Point, std::size_t> > copies;
+  copies.reserve(points.size() + points.size() / 4);
+  // coordinates of the points in the domain, scaled to [0,1)
+  std::vector<double> coordinates(3 * points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    const Point& p = points[i];
+    CGAL_precondition(p.x() < dom.xmax() && p.y() < dom.ymax() && p.z() < dom.zmax());
+    CGAL_precondition(p.x() >= dom.xmin() && p.y() >= dom.ymin() && p.z() >= dom.zmin());
+
+    const double c[3] = { CGAL::to_double(p.x()) - lo[0],
+                          CGAL::to_double(p.y()) - lo[1],
+                          CGAL::to_double(p.z()) - lo[2] };
+    int range[3][2];
+    for(int d=0; d<3; ++d) {
+      coordinates[3*i+d] = c[d] / side;
+      range[d][0] = (c[d] >= side - margin) ? -1 : 0;
+      range[d][1] = (c[d] <= margin) ? 1 : 0;
+    }
+    for(int x=range[0][0]; x<=range[0][1]; ++x)
+      for(int y=range[1][0]; y<=range[1][1]; ++y)
+        for(int z=range[2][0]; z<=range[2][1]; ++z) {
+          const Offset o(x, y, z);
+          copies.push_back(std::make_pair(construct_point(p, o),
+                                          27 * i + offset_index(o)));
+        }
+  }
+
+  EDT edt;
+#ifdef CGAL_LINKED_WITH_TBB
+  if constexpr (is_parallel)
+  {
+    typename EDT::Lock_data_structure lock_ds(
+      Bbox_3(lo[0] - margin, lo[1] - margin, lo[2] - margin,
+             lo[0] + side + margin, lo[1] + side + margin, lo[2] + side + margin),
+      50);
+    edt.set_lock_data_structure(&lock_ds);
+    edt.insert(copies.begin(), copies.end());
+    edt.set_lock_data_structure(nullptr);
+  }
+  else
+#endif
+  {
+    edt.insert(copies.begin(), copies.end());
+  }
+
+  // duplicated points
+  if(edt.dimension() != 3 || edt.number_of_vertices() != copies.size())
+    return NOT_REBUILDABLE;
+
+  std::vector<EVertex_handle> originals(points.size());
+  boost::unordered_map<std::size_t, EVertex_handle> translated_copies;
+  for(EVertex_handle v : edt.finite_vertex_handles()) {
+    if(v->info() % 27 == zero_offset)
+      originals[v->info() / 27] = v;
+    else
+      translated_copies[v->info()] = v;
+  }
+  auto copy_handle = [&](std::size_t id) -> EVertex_handle {
+    if(id % 27 == zero_offset)
+      return originals[id / 27];
+    typename boost::unordered_map<std::size_t, EVertex_handle>::const_iterator
+      it = translated_copies.find(id);
+    return (it == translated_copies.end()) ? EVertex_handle() : it->second;
+  };
+
+  // The representative of a periodic cell is its copy whose centroid lies
+  // in the domain. `translation(c)` is the translation from it to `c`.
+  // Exactly one copy passes the test despite rounding errors, as the sum of
+  // the offsets of the vertices, an integer, is compared to a value computed
+  // in the same way for all the copies.
+  auto translation = [&](ECell_handle c) -> Offset
+  {
+    std::size_t ids[4] = { c->vertex(0)->info(), c->vertex(1)->info(),
+                           c->vertex(2)->info(), c->vertex(3)->info() };
+    std::sort(ids, ids + 4);
+    int t[3];
+    for(int d=0; d<3; ++d)
+    {
+      double g = 0.;
+      int s = 0;
+      for(int j=0; j<4; ++j) {
+        g += coordinates[3 * (ids[j] / 27) + d];
+        s += index_offset(ids[j] % 27)[d];
+      }
+      t[d] = 0;
+      while(s - 4 * t[d] < -g) --t[d];
+      while(s - 4 * t[d] - 4 >= -g) ++t[d];
+    }
+    return Offset(t[0], t[1], t[2]);
+  };
+  std::vector<ECell_handle> cells;
+  cells.reserve(6 * points.size() + 1);
+  for(ECell_handle c : edt.finite_cell_handles())
+    if(translation(c).is_null())
+      cells.push_back(c);
+
+  // Checks that the representatives are positively oriented, have short
+  // edges, and are locally Delaunay; also computes their volume.
+  std::vector<double> volumes(cells.size());
+  auto is_valid_cell = [&](std::size_t k) -> bool
+  {
+    ECell_handle c = cells[k];
+    const Point* p[4];
+    Offset o[4];
+    for(int j=0; j<4; ++j) {
+      p[j] = &points[c->vertex(j)->info() / 27];
+      o[j] = index_offset(c->vertex(j)->info() % 27);
+    }
+    if(orientation(*p[0], *p[1], *p[2], *p[3], o[0], o[1], o[2], o[3]) != POSITIVE)
+      return false;
+
+    Point cp[4];
+    for(int j=0; j<4; ++j)
+      cp[j] = construct_point(*p[j], o[j]);
+    for(int j=0; j<4; ++j)
+      for(int l=j+1; l<4; ++l)
+        if(squared_distance(cp[j], cp[l]) > edge_length_threshold)
+          return false;
+
+    for(int j=0; j<4; ++j) {
+      ECell_handle n = c->neighbor(j);
+      if(edt.is_infinite(n))
+        return false;
+      const std::size_t q = n->vertex(n->index(c))->info();
+      if(side_of_oriented_sphere(*p[0], *p[1], *p[2], *p[3], points[q / 27],
+                                 o[0], o[1], o[2], o[3], index_offset(q % 27))
+           == ON_POSITIVE_SIDE)
+        return false;
+    }
+
+    volumes[k] = CGAL::to_double(volume(cp[0], cp[1], cp[2], cp[3]));
+    return true;
+  };
+
+  std::atomic<bool> valid(true);
+#ifdef CGAL_LINKED_WITH_TBB
+  if(is_parallel)
+  {
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, cells.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for(std::size_t k=r.begin(); k!=r.end() && valid; ++k)
+        if(!is_valid_cell(k))
+          valid = false;
+    });
+  }
+  else
+#endif // CGAL_LINKED_WITH_TBB
+  {
+    for(std::size_t k=0; k<cells.size() && valid; ++k)
+      if(!is_valid_cell(k))
+        valid = false;
+  }
+  if(!valid)
+    return MARGIN_TOO_SMALL;
+
+  // The representatives must tile the domain exactly once.
+  const double total_volume = std::accumulate(volumes.begin(), volumes.end(), 0.);
+  if(std::abs(total_volume - side * side * side) > 1e-3 * side * side * side)
+    return MARGIN_TOO_SMALL;
+
+  // The neighbors of the representatives, as representatives. They are
+  // mostly found directly, except across the boundary of the domain.
+  std::vector<ECell_handle> neighbors(4 * cells.size());
+  for(std::size_t k=0; k<cells.size(); ++k)
+  {
+    for(int j=0; j<4; ++j)
+    {
+      ECell_handle n = cells[k]->neighbor(j);
+      const Offset t = translation(n);
+      if(t.is_null()) {
+        neighbors[4*k+j] = n;
+        continue;
+      }
+
+      EVertex_handle w[4];
+      for(int l=0; l<4; ++l) {
+        const std::size_t id = n->vertex(l)->info();
+        const Offset o = index_offset(id % 27) - t;
+        if((std::max)({std::abs(o.x()), std::abs(o.y()), std::abs(o.z())}) > 1)
+          return MARGIN_TOO_SMALL;
+        w[l] = copy_handle(27 * (id / 27) + offset_index(o));
+        if(w[l] == EVertex_handle())
+          return MARGIN_TOO_SMALL;
+      }
+      if(!edt.is_cell(w[0], w[1], w[2], w[3], neighbors[4*k+j]) ||
+         !translation(neighbors[4*k+j]).is_null())
+        return MARGIN_TOO_SMALL;
+    }
+  }
+
+  // Everything has been checked: replace the triangulation.
+  tds().cells().clear();
+  clear_covering_data();
+  this->virtual_vertices.clear();
+  this->virtual_vertices_reverse.clear();
+
+  std::vector<Vertex_handle> new_vertices(vertices);
+  for(std::size_t i=0; i<points.size(); ++i) {
+    if(new_vertices[i] == Vertex_handle())
+      new_vertices[i] = tds().create_vertex();
+    new_vertices[i]->set_point(points[i]);
+  }
+  tds().set_dimension(3);
+  this->set_cover(CGAL::make_array(1,1,1));
+
+  for(ECell_handle c : cells)
+  {
+    Vertex_handle v[4];
+    Offset o[4];
+    for(int j=0; j<4; ++j) {
+      v[j] = new_vertices[c->vertex(j)->info() / 27];
+      o[j] = index_offset(c->vertex(j)->info() % 27);
+    }
+    Cell_handle ch = tds().create_cell(v[0], v[1], v[2], v[3]);
+    this->set_offsets(ch, o[0], o[1], o[2], o[3]);
+    for(int j=0; j<4; ++j)
+      v[j]->set_cell(ch);
+    c->info() = ch;
+  }
+  for(std::size_t k=0; k<cells.size(); ++k)
+    for(int j=0; j<4; ++j)
+      cells[k]->info()->set_neighbor(j, neighbors[4*k+j]->info());
+
+  CGAL_expensive_postcondition(is_valid());
+  return REBUILT;
+}
+
 template < class Gt, class Tds >
 void Periodic_3_Delaunay_triangulation_3<Gt,Tds>::remove(Vertex_handle v)
 {
@@ -0,0 +1,156 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Periodic_3_Delaunay_triangulation_3.h>
+#include <CGAL/Periodic_3_Delaunay_triangulation_traits_3.h>
+
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel       K;
+typedef CGAL::Periodic_3_Delaunay_triangulation_traits_3<K>        Gt;
+typedef CGAL::Periodic_3_Delaunay_triangulation_3<Gt>              P3DT3;
+typedef P3DT3::Point                                              Point;
+typedef P3DT3::Vertex_handle                                      Vertex_handle;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                        Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                                      Concurrency_tag;
+#endif
+
+// moves the point by at most `d` in each direction, staying in [0,1)^3
+Point perturb(const Point& p, double d, CGAL::Random& rnd)
+{
+  double c[3] = { p.x(), p.y(), p.z() };
+  for(int i=0; i<3; ++i) {
+    c[i] += rnd.get_double(-d, d);
+    if(c[i] < 0.) c[i] += 1.;
+    if(c[i] >= 1.) c[i] -= 1.;
+  }
+  return Point(c[0], c[1], c[2]);
+}
+
+void test_insert(const std::vector<Point>& points)
+{
+  P3DT3 ref;
+  ref.insert(points.begin(), points.end(), true);
+
+  P3DT3 tr;
+  tr.insert(points.begin(), points.end(), Concurrency_tag());
+  assert(tr.is_valid());
+  assert(tr.is_1_cover());
+  assert(tr.number_of_vertices() == points.size());
+  assert(tr == ref);
+
+  // on a non-empty triangulation, the existing vertices are kept
+  P3DT3 tr2;
+  const std::size_t half = points.size() / 2;
+  tr2.insert(points.begin(), points.begin() + half, true);
+  std::vector<Vertex_handle> vertices;
+  for(P3DT3::Vertex_iterator vit = tr2.vertices_begin(); vit != tr2.vertices_end(); ++vit)
+    vertices.push_back(vit);
+  tr2.insert(points.begin() + half, points.end(), Concurrency_tag());
+  assert(tr2.is_valid());
+  assert(tr2 == ref);
+  for(Vertex_handle v : vertices)
+    assert(tr2.tds().is_vertex(v));
+
+  // with the sequential tag
+  P3DT3 tr3;
+  tr3.insert(points.begin(), points.end(), CGAL::Sequential_tag());
+  assert(tr3 == ref);
+
+  // few points: no 1-sheeted triangulation, falls back on the sequential insertion
+  P3DT3 tr4;
+  tr4.insert(points.begin(), points.begin() + 20, Concurrency_tag());
+  assert(tr4.is_valid());
+  assert(tr4.number_of_vertices() == 20);
+
+  // duplicated points: falls back on the sequential insertion
+  std::vector<Point> duplicated(points);
+  duplicated.push_back(points[0]);
+  P3DT3 tr5;
+  tr5.insert(duplicated.begin(), duplicated.end(), Concurrency_tag());
+  assert(tr5 == ref);
+}
+
+void test_move(const std::vector<Point>& points, CGAL::Random& rnd)
+{
+  P3DT3 tr;
+  tr.insert(points.begin(), points.end(), Concurrency_tag());
+
+  // all the points move: the triangulation is rebuilt
+  std::vector<std::pair<Vertex_handle, Point> > moves;
+  std::vector<Point> moved_points;
+  for(P3DT3::Vertex_iterator vit = tr.vertices_begin(); vit != tr.vertices_end(); ++vit) {
+    moves.push_back(std::make_pair(vit, perturb(vit->point(), 0.01, rnd)));
+    moved_points.push_back(moves.back().second);
+  }
+
+  std::vector<Vertex_handle> new_vertices;
+  tr.move_points(moves.begin(), moves.end(), std::back_inserter(new_vertices),
+                 Concurrency_tag());
+  assert(tr.is_valid());
+  assert(new_vertices.size() == moves.size());
+  for(std::size_t i=0; i<moves.size(); ++i) {
+    assert(new_vertices[i] == moves[i].first);
+    assert(new_vertices[i]->point() == moves[i].second);
+  }
+
+  P3DT3 ref;
+  ref.insert(moved_points.begin(), moved_points.end(), true);
+  assert(tr == ref);
+
+  // a few points move: they are moved one by one
+  moves.clear();
+  for(std::size_t i=0; i<10; ++i) {
+    Vertex_handle v = new_vertices[i];
+    moves.push_back(std::make_pair(v, perturb(v->point(), 0.01, rnd)));
+    moved_points[i] = moves.back().second;
+  }
+  new_vertices.clear();
+  tr.move_points(moves.begin(), moves.end(), std::back_inserter(new_vertices));
+  assert(tr.is_valid());
+  for(std::size_t i=0; i<moves.size(); ++i)
+    assert(new_vertices[i]->point() == moves[i].second);
+
+  P3DT3 ref2;
+  ref2.insert(moved_points.begin(), moved_points.end(), true);
+  assert(tr == ref2);
+}
+
+int main()
+{
+  CGAL::Random rnd(7);
+  CGAL::Random_points_in_cube_3<Point> generator(0.5, rnd);
+
+  std::vector<Point> points;
+  for(int i=0; i<5000; ++i) {
+    const Point p = *generator++;
+    points.push_back(Point(p.x() + 0.5, p.y() + 0.5, p.z() + 0.5));
+  }
+
+  // a grid, which is a degenerate input
+  std::vector<Point> grid;
+  for(int i=0; i<12; ++i)
+    for(int j=0; j<12; ++j)
+      for(int k=0; k<12; ++k)
+        grid.push_back(Point(i/12., j/12., k/12.));
+
+  std::cout << "Random points..." << std::endl;
+  test_insert(points);
+  test_move(points, rnd);
+
+  std::cout << "Grid points..." << std::endl;
+  P3DT3 tr;
+  tr.insert(grid.begin(), grid.end(), Concurrency_tag());
+  assert(tr.is_valid());
+  assert(tr.number_of_vertices() == grid.size());
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
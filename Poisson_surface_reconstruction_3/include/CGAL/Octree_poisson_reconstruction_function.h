@@ -0,0 +1,644 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_OCTREE_POISSON_RECONSTRUCTION_FUNCTION_H
+#define CGAL_OCTREE_POISSON_RECONSTRUCTION_FUNCTION_H
+
+#include <CGAL/license/Poisson_surface_reconstruction_3.h>
+
+#include <CGAL/Orthtree.h>
+#include <CGAL/Orthtree_traits_point.h>
+#include <CGAL/Poisson_surface_reconstruction_3/internal/Conjugate_gradient.h>
+#include <CGAL/assertions.h>
+#include <CGAL/bounding_box.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <Eigen/Sparse>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*!
+  \file Octree_poisson_reconstruction_function.h
+*/
+
+namespace CGAL {
+
+namespace internal {
+namespace Poisson {
+
+// Traits of the octree of the input points. The root node is a cube enlarged
+// around the points, so that the boundary of the domain is away from the surface.
+template <class Gt>
+struct Octree_poisson_traits
+  : public Orthtree_traits_point<Gt, std::vector<std::size_t>,
+                                 Random_access_property_map<std::vector<typename Gt::Point_3> >,
+                                 true /*cubic nodes*/, 3>
+{
+  typedef Orthtree_traits_point<Gt, std::vector<std::size_t>,
+                                Random_access_property_map<std::vector<typename Gt::Point_3> >,
+                                true, 3>                                  Base;
+  typedef typename Base::FT                                               FT;
+  typedef typename Base::Point_d                                          Point_d;
+  typedef typename Base::Bbox_d                                           Bbox_d;
+  typedef typename Base::Node_index                                       Node_index;
+  typedef Random_access_property_map<std::vector<typename Gt::Point_3> > Point_map;
+
+  Octree_poisson_traits(std::vector<std::size_t>& indices,
+                        Point_map point_map,
+                        const FT enlarge_ratio)
+    : Base(indices, point_map), m_enlarge_ratio(enlarge_ratio)
+  { }
+
+  auto construct_root_node_bbox_object() const {
+    return [&]() -> Bbox_d {
+      const Bbox_d bbox = Base::construct_root_node_bbox_object()();
+      FT half_side = m_enlarge_ratio * (bbox.xmax() - bbox.xmin()) / 2;
+      if(half_side == FT(0)) // a single point
+        half_side = FT(1);
+
+      const Point_d c = CGAL::midpoint((bbox.min)(), (bbox.max)());
+      return Bbox_d(Point_d(c.x() - half_side, c.y() - half_side, c.z() - half_side),
+                    Point_d(c.x() + half_side, c.y() + half_side, c.z() + half_side));
+    };
+  }
+
+  auto distribute_node_contents_object() const {
+    return [&](Node_index n, auto& tree, const Point_d& center) {
+      CGAL_precondition(!tree.is_leaf(n));
+      reassign_points(tree, this->m_point_map, n, center, tree.data(n));
+    };
+  }
+
+  FT m_enlarge_ratio;
+};
+
+} // namespace Poisson
+} // namespace internal
+
+/*!
+\ingroup PkgPoissonSurfaceReconstruction3Ref
+
+\brief Implementation of the Poisson Surface Reconstruction method,
+discretized on an adaptive octree.
+
+Given a set of 3D points with oriented normals sampled on the boundary
+of a 3D solid, this class computes, like `Poisson_reconstruction_function`,
+an implicit function that is negative inside the inferred solid and
+positive outside, such that its 0 level set is the inferred surface.
+
+Instead of a refined 3D Delaunay triangulation, the function is discretized
+on the leaves of an octree (`CGAL::Orthtree`) refined down to a maximum depth
+around the input points and graded, which requires much less memory.
+The unknowns are the values of the function at the centers of the leaves.
+The energy minimized is the one of the screened Poisson reconstruction:
+the Poisson equation is complemented by a screening term that attracts
+the function towards 0 at the input points.
+The linear system is solved by a cascadic multigrid: the system is solved
+on the octree truncated at increasing depths, each solution being the initial
+guess of the conjugate gradient at the next depth.
+
+The function is evaluated by trilinear interpolation of the values at the centers
+of the leaves. It can be meshed with `make_mesh_3()` (see `poisson_surface_reconstruction_octree()`).
+
+This class requires \ref thirdpartyEigen "Eigen" 3.1 (or greater).
+
+\tparam GeomTraits is a model of `Kernel`.
+
+\cgalModels{ImplicitFunction}
+*/
+template <class GeomTraits>
+class Octree_poisson_reconstruction_function
+{
+// Public types
+public:
+
+  /// \name Types
+  /// @{
+
+  typedef GeomTraits Geom_traits; ///< Geometric traits class
+
+  /// \cond SKIP_IN_MANUAL
+  typedef Geom_traits Kernel; ///< Geometric traits class
+  /// \endcond
+
+  typedef typename Geom_traits::FT FT; ///< number type.
+  typedef typename Geom_traits::Point_3 Point; ///< point type.
+  typedef typename Geom_traits::Vector_3 Vector; ///< vector type.
+  typedef typename Geom_traits::Sphere_3 Sphere; ///< sphere type.
+
+  /// @}
+
+// Private types
+private:
+
+  typedef internal::Poisson::Octree_poisson_traits<Geom_traits> Traits;
+  typedef Orthtree<Traits> Octree;
+  typedef typename Octree::Node_index Node_index;
+  typedef typename Traits::Bbox_d Bbox;
+  typedef std::array<FT, 3> Field;
+
+  typedef Eigen::SparseMatrix<FT> Matrix;
+  typedef Eigen::Matrix<FT, Eigen::Dynamic, 1> Eigen_vector;
+
+  // Row of a cell in the linear system
+  struct Row
+  {
+    FT rhs;
+    FT diagonal;
+    std::vector<std::pair<std::size_t, FT> > coefficients; // lower off-diagonal coefficients (column, value)
+  };
+
+  // Value of the function at the boundary of the domain: the function is -1/2 inside,
+  // 1/2 outside, and the screening term attracts it towards 0 at the input points.
+  static constexpr double boundary_value = 0.5;
+
+  struct Data
+  {
+    std::vector<Point> points;
+    std::vector<Vector> normals;
+    std::vector<std::size_t> indices; // indices of the points, sorted by the octree
+
+    std::unique_ptr<Octree> octree;
+    std::optional<typename Octree::template Property_map<FT> > values;
+    Bbox bbox;
+    FT root_side = 0;
+    FT sample_area = 0; // area of the surface per input point
+
+    FT contouring_value = 0;
+    Point inner_point;
+    Sphere bounding_sphere;
+  };
+
+// Data members.
+// Warning: the mesh generators make copies of implicit functions,
+// thus this class must be lightweight and stateless.
+private:
+
+  std::shared_ptr<Data> m_data;
+
+// Public methods
+public:
+
+  /// \name Creation
+  /// @{
+
+  /*!
+    Creates an octree Poisson implicit function from the range of points `[first, beyond)`.
+
+    \tparam InputIterator iterator over input points.
+    \tparam PointMap is a model of `ReadablePropertyMap` with
+      a `value_type = Point`.
+    \tparam NormalMap is a model of `ReadablePropertyMap`
+      with a `value_type = Vector`.
+
+    \param first iterator over the first input point.
+    \param beyond past-the-end iterator over the input points.
+    \param point_map property map: `value_type of InputIterator` -> `Point` (the position of an input point).
+    \param normal_map property map: `value_type of InputIterator` -> `Vector` (the *oriented* normal of an input point).
+  */
+  template <typename InputIterator,
+            typename PointMap,
+            typename NormalMap>
+  Octree_poisson_reconstruction_function(InputIterator first,
+                                         InputIterator beyond,
+                                         PointMap point_map,
+                                         NormalMap normal_map)
+    : m_data(std::make_shared<Data>())
+  {
+    for(InputIterator it = first; it != beyond; ++it)
+    {
+      m_data->points.push_back(get(point_map, *it));
+
+      Vector n = get(normal_map, *it);
+      const FT sq_norm = n * n;
+      if(sq_norm != FT(0))
+        n = n / CGAL::sqrt(sq_norm);
+      m_data->normals.push_back(n);
+    }
+  }
+
+  /// @}
+
+  /// \name Operations
+  /// @{
+
+  /*!
+    computes the implicit function.
+
+    \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    The function does not depend on `ConcurrencyTag`.
+
+    \param max_depth the maximum depth of the octree: the size of the smallest leaves
+           is the size of the bounding box of the points enlarged by 1.5, divided by `2^max_depth`.
+    \param screening_weight the weight of the screening term. With `0`, the classical
+           Poisson equation is solved.
+
+    \return `false` if the linear solver fails.
+  */
+  template <typename ConcurrencyTag = Sequential_tag>
+  bool compute_implicit_function(unsigned int max_depth = 8,
+                                 double screening_weight = 4.,
+                                 ConcurrencyTag = ConcurrencyTag())
+  {
+    Data& data = *m_data;
+    if(data.points.empty())
+      return false;
+
+    data.indices.resize(data.points.size());
+    std::iota(data.indices.begin(), data.indices.end(), std::size_t(0));
+
+    data.octree = std::make_unique<Octree>(Traits(data.indices,
+                                                  typename Traits::Point_map(data.points),
+                                                  FT(1.5)));
+    Octree& octree = *data.octree;
+    octree.refine(Orthtrees::Maximum_depth_and_maximum_contained_elements(max_depth, 0));
+    octree.grade();
+
+    data.bbox = octree.bbox(octree.root());
+    data.root_side = data.bbox.xmax() - data.bbox.xmin();
+    // The area of the surface per input point is estimated at the deepest level
+    // where the nodes that contain points contain 4 points on average
+    std::vector<std::size_t> nb_non_empty_nodes(octree.depth() + 1, 0);
+    for(Node_index n : octree.traverse(Orthtrees::Preorder_traversal<Octree>(octree)))
+      if(!octree.data(n).empty())
+        ++nb_non_empty_nodes[octree.depth(n)];
+    std::size_t sampling_depth = 0;
+    for(std::size_t d = 0; d <= octree.depth(); ++d)
+      if(4 * nb_non_empty_nodes[d] <= data.points.size())
+        sampling_depth = d;
+    data.sample_area = FT(nb_non_empty_nodes[sampling_depth])
+                     * CGAL::square(std::ldexp(data.root_side, -int(sampling_depth)))
+                     / FT(data.points.size());
+
+    data.values.emplace(octree.template add_property<FT>("poisson_values", FT(0)).first);
+    typename Octree::template Property_map<std::size_t> cell_indices =
+      octree.template add_property<std::size_t>("poisson_cell_indices", 0).first;
+
+    // Cascadic multigrid: solves on the octree truncated at each depth,
+    // starting from the solution at the previous depth.
+    std::vector<Node_index> cells;
+    for(std::size_t level = 0; level <= octree.depth(); ++level)
+    {
+      level_cells(level, cells);
+      for(std::size_t i = 0; i < cells.size(); ++i)
+        cell_indices[cells[i]] = i;
+
+      Eigen_vector x(cells.size());
+      for(std::size_t i = 0; i < cells.size(); ++i)
+      {
+        const Node_index c = cells[i];
+        x[i] = (octree.depth(c) == level && level > 0) ? (*data.values)[octree.parent(c)]
+                                                       : (*data.values)[c];
+      }
+
+      Matrix A;
+      Eigen_vector B;
+      assemble_system<ConcurrencyTag>(level, cells, cell_indices, FT(screening_weight), A, B);
+
+      internal::Poisson::Conjugate_gradient<Matrix, ConcurrencyTag> solver;
+      solver.setTolerance(FT(1e-7));
+      solver.compute(A);
+      x = solver.solveWithGuess(B, x);
+      if(solver.info() != Eigen::Success)
+        return false;
+
+      for(std::size_t i = 0; i < cells.size(); ++i)
+        (*data.values)[cells[i]] = x[i];
+    }
+    octree.remove_property(cell_indices);
+
+    // Shifts the function such that it is 0 at the median of the input points
+    std::vector<FT> point_values(data.points.size());
+    for_each_index<ConcurrencyTag>(data.points.size(), [&](std::size_t i)
+    {
+      point_values[i] = interpolate(data.points[i]);
+    });
+    typename std::vector<FT>::iterator median = point_values.begin() + point_values.size() / 2;
+    std::nth_element(point_values.begin(), median, point_values.end());
+    data.contouring_value = *median;
+
+    // The inner point is the center of the leaf with the smallest value
+    std::optional<Node_index> inner_leaf;
+    for(Node_index leaf : octree.traverse(Orthtrees::Leaves_traversal<Octree>(octree)))
+      if(!inner_leaf || (*data.values)[leaf] < (*data.values)[*inner_leaf])
+        inner_leaf = leaf;
+    data.inner_point = octree.barycenter(*inner_leaf);
+
+    const Bbox points_bbox = CGAL::bounding_box(data.points.begin(), data.points.end());
+    data.bounding_sphere = Sphere(CGAL::midpoint((points_bbox.min)(), (points_bbox.max)()),
+                                  CGAL::squared_distance((points_bbox.min)(), (points_bbox.max)()) / 4);
+
+    return true;
+  }
+
+  /*!
+    `ImplicitFunction` interface: evaluates the implicit function at the 3D query point `p`.
+  */
+  FT operator()(const Point& p) const
+  {
+    return interpolate(p) - m_data->contouring_value;
+  }
+
+  /// Returns a sphere bounding the input points.
+  Sphere bounding_sphere() const
+  {
+    return m_data->bounding_sphere;
+  }
+
+  /// Returns a point located inside the inferred surface.
+  Point get_inner_point() const
+  {
+    return m_data->inner_point;
+  }
+
+  /// Returns the number of leaves of the octree, which is the number of unknowns.
+  std::size_t number_of_leaves() const
+  {
+    if(!m_data->octree)
+      return 0;
+
+    const Octree& octree = *m_data->octree;
+    std::size_t nb = 0;
+    for(Node_index leaf : octree.traverse(Orthtrees::Leaves_traversal<Octree>(octree)))
+    {
+      CGAL_USE(leaf);
+      ++nb;
+    }
+    return nb;
+  }
+
+  /// @}
+
+// Private methods:
+private:
+
+  FT side(Node_index n) const
+  {
+    return std::ldexp(m_data->root_side, -int(m_data->octree->depth(n)));
+  }
+
+  // The cells at `level` are the leaves whose depth is at most `level`, and the nodes at depth `level`
+  bool is_cell(Node_index n, std::size_t level) const
+  {
+    return m_data->octree->is_leaf(n) || m_data->octree->depth(n) == level;
+  }
+
+  void level_cells(std::size_t level, std::vector<Node_index>& cells) const
+  {
+    const Octree& octree = *m_data->octree;
+    cells.clear();
+
+    std::vector<Node_index> stack(1, octree.root());
+    while(!stack.empty())
+    {
+      const Node_index n = stack.back();
+      stack.pop_back();
+      if(is_cell(n, level))
+        cells.push_back(n);
+      else
+        for(int i = Octree::degree - 1; i >= 0; --i)
+          stack.push_back(octree.child(n, i));
+    }
+  }
+
+  // Collects the cells at `level` that share a face with the cell `c`, in `direction`
+  void face_neighbors(Node_index c, std::size_t level, int direction,
+                      std::vector<Node_index>& neighbors) const
+  {
+    const Octree& octree = *m_data->octree;
+    neighbors.clear();
+
+    const std::optional<Node_index> adjacent = octree.adjacent_node(c, direction);
+    if(!adjacent)
+      return;
+
+    // the children of a node that touch `c` are on the opposite side
+    const int axis = direction / 2;
+    const bool side_of_c = (direction % 2 == 0);
+
+    std::vector<Node_index> stack(1, *adjacent);
+    while(!stack.empty())
+    {
+      const Node_index n = stack.back();
+      stack.pop_back();
+      if(is_cell(n, level))
+      {
+        neighbors.push_back(n);
+        continue;
+      }
+
+      for(int i = 0; i < Octree::degree; ++i)
+        if(typename Octree::Local_coordinates(i)[axis] == side_of_c)
+          stack.push_back(octree.child(n, i));
+    }
+  }
+
+  // Finite volume discretization of the screened Poisson equation on the cells at `level`:
+  // the flux between two adjacent cells is the difference of their values
+  // times the area of the common face divided by the distance between their centers.
+  template <typename ConcurrencyTag, typename Index_map>
+  void assemble_system(std::size_t level,
+                       const std::vector<Node_index>& cells,
+                       const Index_map& cell_indices,
+                       const FT screening_weight,
+                       Matrix& A,
+                       Eigen_vector& B) const
+  {
+    const Octree& octree = *m_data->octree;
+    const std::size_t n = cells.size();
+
+    // Vector field: the normals of the points of a cell, weighted by the area of the surface
+    // per point and divided by the volume of the cell, so that the function varies by 1 across the surface
+    std::vector<Field> fields(n);
+    std::vector<char> has_points(n);
+    for_each_index<ConcurrencyTag>(n, [&](std::size_t i)
+    {
+      Field field = { FT(0), FT(0), FT(0) };
+      std::size_t nb = 0;
+      for(std::size_t p : octree.data(cells[i]))
+      {
+        const Vector& normal = m_data->normals[p];
+        field[0] += normal.x();
+        field[1] += normal.y();
+        field[2] += normal.z();
+        ++nb;
+      }
+
+      const FT scale = m_data->sample_area / CGAL::square(side(cells[i])) / side(cells[i]);
+      for(int k = 0; k < 3; ++k)
+        field[k] *= scale;
+      fields[i] = field;
+      has_points[i] = (nb > 0);
+    });
+
+    // The rows are computed by blocks of cells, possibly in parallel, and then
+    // inserted in the matrix in the order of the cells.
+    std::vector<Eigen::Triplet<FT> > triplets;
+    triplets.reserve(4 * n);
+    B.resize(n);
+
+    const std::size_t block_size = 16384;
+    std::vector<Row> rows;
+    for(std::size_t first = 0; first < n; first += block_size)
+    {
+      const std::size_t nb_rows = (std::min)(block_size, n - first);
+      rows.resize(nb_rows);
+      for_each_index<ConcurrencyTag>(nb_rows, [&](std::size_t k)
+      {
+        const std::size_t i = first + k;
+        const Node_index c = cells[i];
+        const FT h = side(c);
+
+        Row& row = rows[k];
+        row.rhs = 0;
+        row.diagonal = 0;
+        row.coefficients.clear();
+
+        FT div = 0;
+        std::vector<Node_index> neighbors;
+        for(int direction = 0; direction < 6; ++direction)
+        {
+          const int axis = direction / 2;
+          const FT sign = (direction % 2 == 0) ? FT(-1) : FT(1);
+
+          face_neighbors(c, level, direction, neighbors);
+          if(neighbors.empty())
+          {
+            // boundary of the domain: the value is imposed at the center of the face
+            const FT w = 2 * h;
+            row.diagonal += w;
+            row.rhs += w * FT(boundary_value);
+            div += h * h * sign * fields[i][axis] / 2;
+            continue;
+          }
+
+          for(Node_index b : neighbors)
+          {
+            const std::size_t j = cell_indices[b];
+            const FT hb = side(b);
+            const FT area = CGAL::square((std::min)(h, hb));
+            const FT w = area / ((h + hb) / 2);
+
+            row.diagonal += w;
+            if(j < i)
+              row.coefficients.emplace_back(j, -w);
+            div += area * sign * (fields[i][axis] + fields[j][axis]) / 2;
+          }
+        }
+
+        if(has_points[i])
+          row.diagonal += screening_weight * h;
+
+        row.rhs -= div;
+      });
+
+      for(std::size_t k = 0; k < nb_rows; ++k)
+      {
+        const std::size_t i = first + k;
+        B[i] = rows[k].rhs;
+        for(const std::pair<std::size_t, FT>& c : rows[k].coefficients)
+          triplets.emplace_back(int(i), int(c.first), c.second);
+        triplets.emplace_back(int(i), int(i), rows[k].diagonal);
+      }
+    }
+
+    A.resize(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+  }
+
+  FT cell_value(const Point& q) const
+  {
+    if(m_data->bbox.has_on_unbounded_side(q))
+      return FT(boundary_value);
+    return (*m_data->values)[m_data->octree->locate(q)];
+  }
+
+  // Trilinear interpolation of the values at the centers of the cells
+  // of the size of the leaf containing `p`, around `p`
+  FT interpolate(const Point& p) const
+  {
+    if(m_data->bbox.has_on_unbounded_side(p))
+      return FT(boundary_value);
+
+    const Octree& octree = *m_data->octree;
+    const Node_index leaf = octree.locate(p);
+    const FT h = side(leaf);
+    const Point c = octree.barycenter(leaf);
+
+    std::array<FT, 3> t, offset;
+    for(int i = 0; i < 3; ++i)
+    {
+      const FT d = p[i] - c[i];
+      offset[i] = (d < 0) ? -h : h;
+      t[i] = CGAL::abs(d) / h;
+    }
+
+    FT result = 0;
+    for(int k = 0; k < 8; ++k)
+    {
+      FT w = 1;
+      std::array<FT, 3> q;
+      for(int i = 0; i < 3; ++i)
+      {
+        const bool shifted = ((k >> i) & 1) != 0;
+        w *= shifted ? t[i] : 1 - t[i];
+        q[i] = shifted ? c[i] + offset[i] : c[i];
+      }
+
+      if(w != FT(0))
+        result += w * ((k == 0) ? (*m_data->values)[leaf] : cell_value(Point(q[0], q[1], q[2])));
+    }
+    return result;
+  }
+
+  // Calls `f(i)` for each `i` in `[0, n)`, in parallel if `ConcurrencyTag` is `Parallel_tag`.
+  template <typename ConcurrencyTag, typename Function>
+  static void for_each_index(const std::size_t n, const Function& f)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for(std::size_t i = r.begin(); i != r.end(); ++i)
+          f(i);
+      });
+      return;
+    }
+#endif
+    for(std::size_t i = 0; i < n; ++i)
+      f(i);
+  }
+}; // end of Octree_poisson_reconstruction_function
+
+} //namespace CGAL
+
+#endif // CGAL_OCTREE_POISSON_RECONSTRUCTION_FUNCTION_H
@@ -34,6 +34,7 @@
 #include <CGAL/spatial_sort.h>
 #ifdef CGAL_EIGEN3_ENABLED
 #include <CGAL/Eigen_solver_traits.h>
+#include <CGAL/Poisson_surface_reconstruction_3/internal/Conjugate_gradient.h>
 #else
 #endif
 #include <CGAL/centroid.h>
@@ -43,8 +44,15 @@
 #include <CGAL/Robust_weighted_circumcenter_filtered_traits_3.h>
 #include <CGAL/compute_average_spacing.h>
 #include <CGAL/Timer.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
 
 #include <memory>
+#include <utility>
 #include <boost/iterator/indirect_iterator.hpp>
 
 /*!
@@ -268,6 +276,14 @@ private:
     void set (Cell_handle ch) { m_cell = ch.operator->(); }
   };
 
+  // Row of a vertex in the linear system A*X=B
+  struct Poisson_row
+  {
+    double rhs;
+    std::vector<std::pair<int, double> > coefficients; // off-diagonal coefficients (column, value)
+    double diagonal;
+  };
+
 // Data members.
 // Warning: the Surface Mesh Generation package makes copies of implicit functions,
 // thus this class must be lightweight and stateless.
@@ -414,12 +430,14 @@ public:
 
   // This variant requires all parameters.
   template <class SparseLinearAlgebraTraits_d,
-            class Visitor>
+            class Visitor,
+            class ConcurrencyTag = Sequential_tag>
   bool compute_implicit_function(
                                  SparseLinearAlgebraTraits_d solver,// = SparseLinearAlgebraTraits_d(),
                                  Visitor visitor,
                                  double approximation_ratio = 0,
-                                 double average_spacing_ratio = 5)
+                                 double average_spacing_ratio = 5,
+                                 ConcurrencyTag = ConcurrencyTag())
   {
     CGAL::Timer task_timer; task_timer.start();
     CGAL_TRACE_STREAM << "Delaunay refinement...\n";
@@ -435,11 +453,11 @@ public:
 
     std::vector<int> NB;
 
-    NB.push_back( delaunay_refinement(radius_edge_ratio_bound,sizing_field,max_vertices,enlarge_ratio));
+    NB.push_back( delaunay_refinement<ConcurrencyTag>(radius_edge_ratio_bound,sizing_field,max_vertices,enlarge_ratio));
 
     while(m_tr->insert_fraction(visitor)){
 
-      NB.push_back( delaunay_refinement(radius_edge_ratio_bound,sizing_field,max_vertices,enlarge_ratio));
+      NB.push_back( delaunay_refinement<ConcurrencyTag>(radius_edge_ratio_bound,sizing_field,max_vertices,enlarge_ratio));
     }
 
     if(approximation_ratio > 0. &&
@@ -486,7 +504,7 @@ public:
                                 boost::make_indirect_iterator (some_points.end()),
                                 Normal_of_point_with_normal_map<Geom_traits>() );
       coarse_poisson_function.compute_implicit_function(solver, Poisson_visitor(),
-                                                        0.);
+                                                        0., 5., ConcurrencyTag());
       internal::Poisson::Constant_sizing_field<Triangulation>
         min_sizing_field(CGAL::square(average_spacing));
       internal::Poisson::Constant_sizing_field<Triangulation>
@@ -501,7 +519,7 @@ public:
       std::cerr << "Construction time of the sizing field: " << sizing_field_timer.time()
                 << " seconds" << std::endl;
 
-      NB.push_back( delaunay_refinement(radius_edge_ratio_bound,
+      NB.push_back( delaunay_refinement<ConcurrencyTag>(radius_edge_ratio_bound,
                                         sizing_field2,
                                         max_vertices,
                                         enlarge_ratio,
@@ -530,7 +548,7 @@ public:
     // Computes the Poisson indicator function operator()
     // at each vertex of the triangulation.
     double lambda = 0.1;
-    if ( ! solve_poisson(solver, lambda) )
+    if ( ! solve_poisson<ConcurrencyTag>(solver, lambda) )
     {
       std::cerr << "Error: cannot solve Poisson equation" << std::endl;
       return false;
@@ -577,6 +595,32 @@ public:
       return compute_implicit_function<SparseLinearAlgebraTraits_d,Poisson_visitor>(solver,Poisson_visitor());
   }
 
+  /*!
+    Same as above, but the Delaunay refinement and the assembly of the linear system
+    are performed in parallel if `ConcurrencyTag` is `Parallel_tag`.
+    The scalar function does not depend on `ConcurrencyTag`.
+
+    \tparam SparseLinearAlgebraTraits_d Symmetric definite positive sparse linear solver.
+    If \ref thirdpartyEigen "Eigen" 3.1 (or greater) is available and `CGAL_EIGEN3_ENABLED`
+    is defined, an overload is provided whose default solver is, if `ConcurrencyTag` is `Parallel_tag`,
+    a conjugate gradient with a diagonal preconditioner whose operations are performed in parallel.
+    \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+    Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+
+    \param solver sparse linear solver.
+    \param smoother_hole_filling controls if the Delaunay refinement is done for the input points, or for an approximation of the surface obtained from a first pass of the algorithm on a sample of the points.
+
+    \return `false` if the linear solver fails.
+  */
+  template <class SparseLinearAlgebraTraits_d, class ConcurrencyTag>
+  bool compute_implicit_function(SparseLinearAlgebraTraits_d solver, bool smoother_hole_filling, ConcurrencyTag)
+  {
+    if (smoother_hole_filling)
+      return compute_implicit_function<SparseLinearAlgebraTraits_d,Poisson_visitor,ConcurrencyTag>(solver,Poisson_visitor(),0.02,5);
+    else
+      return compute_implicit_function<SparseLinearAlgebraTraits_d,Poisson_visitor,ConcurrencyTag>(solver,Poisson_visitor(),0,5);
+  }
+
   /// \cond SKIP_IN_MANUAL
 #ifdef CGAL_EIGEN3_ENABLED
   // This variant provides the default sparse linear traits class = Eigen_solver_traits.
@@ -585,6 +629,19 @@ public:
     typedef Eigen_solver_traits<Eigen::ConjugateGradient<Eigen_sparse_symmetric_matrix<double>::EigenType> > Solver;
     return compute_implicit_function<Solver>(Solver(), smoother_hole_filling);
   }
+
+  // This variant provides a default sparse linear traits class, whose operations
+  // are performed in parallel if `ConcurrencyTag` is `Parallel_tag`.
+  template <class ConcurrencyTag>
+  bool compute_implicit_function(bool smoother_hole_filling, ConcurrencyTag)
+  {
+    typedef Eigen_sparse_symmetric_matrix<double>::EigenType EigenMatrix;
+    typedef Eigen_solver_traits<
+      std::conditional_t<std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                         internal::Poisson::Conjugate_gradient<EigenMatrix, ConcurrencyTag>,
+                         Eigen::ConjugateGradient<EigenMatrix> > > Solver;
+    return compute_implicit_function<Solver>(Solver(), smoother_hole_filling, ConcurrencyTag());
+  }
 #endif
 
   boost::tuple<FT, Cell_handle, bool> special_func(const Point& p) const
@@ -667,6 +724,20 @@ public:
     std::cerr << N << " out of " << i << " cells have NULL_VECTOR as normal" << std::endl;
   }
 
+  // Same as above, `cells` being the finite cells, in the order of their indices
+  template <typename ConcurrencyTag>
+  void initialize_cell_normals(const std::vector<Cell_handle>& cells, ConcurrencyTag) const
+  {
+    Normal.resize(m_tr->number_of_cells());
+    for_each_index<ConcurrencyTag>(cells.size(), [&](std::size_t i)
+    {
+      Normal[i] = cell_normal(cells[i]);
+    });
+
+    std::size_t N = std::count(Normal.begin(), Normal.begin() + cells.size(), NULL_VECTOR);
+    std::cerr << N << " out of " << cells.size() << " cells have NULL_VECTOR as normal" << std::endl;
+  }
+
   void initialize_duals() const
   {
     Dual.resize(m_tr->number_of_cells());
@@ -678,6 +749,17 @@ public:
     }
   }
 
+  // Same as above, `cells` being the finite cells, in the order of their indices
+  template <typename ConcurrencyTag>
+  void initialize_duals(const std::vector<Cell_handle>& cells, ConcurrencyTag) const
+  {
+    Dual.resize(m_tr->number_of_cells());
+    for_each_index<ConcurrencyTag>(cells.size(), [&](std::size_t i)
+    {
+      Dual[i] = m_tr->dual(cells[i]);
+    });
+  }
+
   void clear_duals() const
   {
     Dual.clear();
@@ -734,20 +816,22 @@ private:
   /// Steiner points is set to zero.
   /// Returns the number of vertices inserted.
 
-  template <typename Sizing_field>
+  template <typename ConcurrencyTag,
+            typename Sizing_field>
   unsigned int delaunay_refinement(FT radius_edge_ratio_bound, ///< radius edge ratio bound (ignored if zero)
                                    Sizing_field sizing_field, ///< cell radius bound (ignored if zero)
                                    unsigned int max_vertices, ///< number of vertices bound
                                    FT enlarge_ratio) ///< bounding box enlarge ratio
   {
-    return delaunay_refinement(radius_edge_ratio_bound,
+    return delaunay_refinement<ConcurrencyTag>(radius_edge_ratio_bound,
                                sizing_field,
                                max_vertices,
                                enlarge_ratio,
                                internal::Poisson::Constant_sizing_field<Triangulation>());
   }
 
-  template <typename Sizing_field,
+  template <typename ConcurrencyTag,
+            typename Sizing_field,
             typename Second_sizing_field>
   unsigned int delaunay_refinement(FT radius_edge_ratio_bound, ///< radius edge ratio bound (ignored if zero)
                                    Sizing_field sizing_field, ///< cell radius bound (ignored if zero)
@@ -756,7 +840,7 @@ private:
                                    Second_sizing_field second_sizing_field)
   {
     Sphere elarged_bsphere = enlarged_bounding_sphere(enlarge_ratio);
-    unsigned int nb_vertices_added = poisson_refine_triangulation(*m_tr,radius_edge_ratio_bound,sizing_field,second_sizing_field,max_vertices,elarged_bsphere);
+    unsigned int nb_vertices_added = poisson_refine_triangulation<ConcurrencyTag>(*m_tr,radius_edge_ratio_bound,sizing_field,second_sizing_field,max_vertices,elarged_bsphere);
 
     return nb_vertices_added;
   }
@@ -764,8 +848,10 @@ private:
   /// Poisson reconstruction.
   /// Returns false on error.
   ///
+  /// @tparam ConcurrencyTag enables the parallel assembly of the linear system.
   /// @tparam SparseLinearAlgebraTraits_d Symmetric definite positive sparse linear solver.
-  template <class SparseLinearAlgebraTraits_d>
+  template <class ConcurrencyTag,
+            class SparseLinearAlgebraTraits_d>
   bool solve_poisson(
     SparseLinearAlgebraTraits_d solver, ///< sparse linear solver
     double lambda)
@@ -792,23 +878,56 @@ private:
     typename SparseLinearAlgebraTraits_d::Matrix A(nb_variables); // matrix is symmetric definite positive
     typename SparseLinearAlgebraTraits_d::Vector X(nb_variables), B(nb_variables);
 
-    initialize_duals();
+    std::vector<Cell_handle> cells;
+    cells.reserve(m_tr->number_of_finite_cells());
+    for(Finite_cells_iterator fcit = m_tr->finite_cells_begin();
+        fcit != m_tr->finite_cells_end();
+        ++fcit)
+      cells.push_back(fcit);
+
+    initialize_duals(cells, ConcurrencyTag());
 #ifndef CGAL_DIV_NON_NORMALIZED
-    initialize_cell_normals();
+    initialize_cell_normals(cells, ConcurrencyTag());
 #endif
+
+    std::vector<Vertex_handle> vertices;
+    vertices.reserve(nb_variables);
     Finite_vertices_iterator v, e;
     for(v = m_tr->finite_vertices_begin(),
         e = m_tr->finite_vertices_end();
         v != e;
         ++v)
+      if(!m_tr->is_constrained(v))
+        vertices.push_back(v);
+
+    // The rows are computed by blocks of vertices, possibly in parallel, and then
+    // inserted in the matrix in the order of the vertices, so that the linear
+    // system does not depend on the concurrency tag.
+    const std::size_t block_size = 16384;
+    std::vector<Poisson_row> rows;
+    for(std::size_t first = 0; first < vertices.size(); first += block_size)
     {
-      if(!m_tr->is_constrained(v)) {
+      const std::size_t nb_rows = (std::min)(block_size, vertices.size() - first);
+      rows.resize(nb_rows);
+      for_each_index<ConcurrencyTag>(nb_rows, [&](std::size_t i)
+      {
+        Vertex_handle vi = vertices[first + i];
 #ifdef CGAL_DIV_NON_NORMALIZED
-        B[v->index()] = div(v); // rhs -> divergent
+        rows[i].rhs = div(vi); // rhs -> divergent
 #else // not defined(CGAL_DIV_NORMALIZED)
-        B[v->index()] = div_normalized(v); // rhs -> divergent
+        rows[i].rhs = div_normalized(vi); // rhs -> divergent
 #endif // not defined(CGAL_DIV_NORMALIZED)
-        assemble_poisson_row<SparseLinearAlgebraTraits_d>(A,v,B,lambda);
+        compute_poisson_row(vi, lambda, rows[i]);
+      });
+
+      for(std::size_t i = 0; i < nb_rows; ++i)
+      {
+        const Poisson_row& row = rows[i];
+        const int index = vertices[first + i]->index();
+        B[index] = row.rhs;
+        for(const std::pair<int, double>& c : row.coefficients)
+          A.set_coef(index, c.first, c.second, true /*new*/); // off-diagonal coefficient
+        A.set_coef(index, index, row.diagonal, true /*new*/);
       }
     }
 
@@ -1002,7 +1121,7 @@ private:
   {
     std::vector<Cell_handle> cells;
     cells.reserve(32);
-    m_tr->incident_cells(v,std::back_inserter(cells));
+    m_tr->incident_cells_threadsafe(v,std::back_inserter(cells));
 
     FT div = 0;
     typename std::vector<Cell_handle>::iterator it;
@@ -1048,7 +1167,7 @@ private:
   {
     std::vector<Cell_handle> cells;
     cells.reserve(32);
-    m_tr->incident_cells(v,std::back_inserter(cells));
+    m_tr->incident_cells_threadsafe(v,std::back_inserter(cells));
 
     FT div = 0.0;
     typename std::vector<Cell_handle>::iterator it;
@@ -1201,18 +1320,19 @@ private:
     return area;
   }
 
-  /// Assemble vi's row of the linear system A*X=B
+  /// Computes vi's row of the linear system A*X=B.
+  /// `row.rhs` must be initialized with the divergence at vi.
   ///
-  /// @tparam SparseLinearAlgebraTraits_d Symmetric definite positive sparse linear solver.
-  template <class SparseLinearAlgebraTraits_d>
-  void assemble_poisson_row(typename SparseLinearAlgebraTraits_d::Matrix& A,
-                            Vertex_handle vi,
-                            typename SparseLinearAlgebraTraits_d::Vector& B,
-                            double lambda)
+  /// Only reads the triangulation, so that rows can be computed concurrently.
+  void compute_poisson_row(Vertex_handle vi,
+                           double lambda,
+                           Poisson_row& row)
   {
+    row.coefficients.clear();
+
     // for each vertex vj neighbor of vi
     std::vector<Edge> edges;
-    m_tr->incident_edges(vi,std::back_inserter(edges));
+    m_tr->tds().incident_edges_threadsafe(vi,std::back_inserter(edges));
 
     double diagonal = 0.0;
 
@@ -1239,26 +1359,49 @@ private:
           if(! is_valid(vj->f())){
             std::cerr << "vj->f() = " << vj->f() << " is not valid" << std::endl;
           }
-          B[vi->index()] -= cij * vj->f(); // change rhs
-          if(! is_valid( B[vi->index()])){
-            std::cerr << " B[vi->index()] = " <<  B[vi->index()] << " is not valid" << std::endl;
+          row.rhs -= cij * vj->f(); // change rhs
+          if(! is_valid(row.rhs)){
+            std::cerr << " B[vi->index()] = " <<  row.rhs << " is not valid" << std::endl;
           }
 
         } else {
           if(! is_valid(cij)){
             std::cerr << "cij = " << cij << " is not valid" << std::endl;
           }
-          A.set_coef(vi->index(),vj->index(), -cij, true /*new*/); // off-diagonal coefficient
+          row.coefficients.emplace_back(vj->index(), -cij); // off-diagonal coefficient
         }
 
         diagonal += cij;
       }
     // diagonal coefficient
     if (vi->type() == Triangulation::INPUT){
-      A.set_coef(vi->index(),vi->index(), diagonal + lambda, true /*new*/) ;
+      row.diagonal = diagonal + lambda;
     } else{
-      A.set_coef(vi->index(),vi->index(), diagonal, true /*new*/);
+      row.diagonal = diagonal;
+    }
+  }
+
+  /// Calls `f(i)` for each `i` in `[0, n)`, in parallel if `ConcurrencyTag` is `Parallel_tag`.
+  template <typename ConcurrencyTag, typename Function>
+  static void for_each_index(const std::size_t n, const Function& f)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for(std::size_t i = r.begin(); i != r.end(); ++i)
+          f(i);
+      });
+      return;
     }
+#endif
+    for(std::size_t i = 0; i < n; ++i)
+      f(i);
   }
 
 
@@ -0,0 +1,276 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_POISSON_SURFACE_RECONSTRUCTION_3_INTERNAL_CONJUGATE_GRADIENT_H
+#define CGAL_POISSON_SURFACE_RECONSTRUCTION_3_INTERNAL_CONJUGATE_GRADIENT_H
+
+#include <CGAL/license/Poisson_surface_reconstruction_3.h>
+
+#include <CGAL/Eigen_solver_traits.h>
+#include <CGAL/tags.h>
+
+#include <Eigen/Sparse>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+namespace internal {
+namespace Poisson {
+
+// Conjugate gradient with a Jacobi (diagonal) preconditioner, following `Eigen::ConjugateGradient`
+// (same stopping criterion and default parameters), whose vector operations and matrix-vector
+// products are performed in parallel if `ConcurrencyTag` is `Parallel_tag`.
+//
+// It can be used as a solver of `Eigen_solver_traits`, with a symmetric matrix
+// whose lower triangle is stored (see `Eigen_sparse_symmetric_matrix`).
+//
+// The reductions (dot products) are done on blocks of fixed size, so that the result
+// does not depend on the number of threads.
+template <typename MatrixType,
+          typename ConcurrencyTag = Parallel_tag>
+class Conjugate_gradient
+{
+public:
+  typedef typename MatrixType::Scalar                      Scalar;
+  typedef typename MatrixType::StorageIndex                StorageIndex;
+  typedef Eigen::Index                                     Index;
+  typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1>         Vector;
+
+private:
+  typedef Eigen::SparseMatrix<Scalar, Eigen::RowMajor, StorageIndex> Full_matrix;
+
+  static constexpr Index block_size = 4096;
+
+public:
+  Conjugate_gradient() { }
+
+  // The tolerance is relative to the norm of the right-hand side
+  Conjugate_gradient& setTolerance(const Scalar tolerance) { m_tolerance = tolerance; return *this; }
+  Scalar tolerance() const { return m_tolerance; }
+
+  // The default maximum number of iterations is twice the number of unknowns
+  Conjugate_gradient& setMaxIterations(const Index max_iterations) { m_max_iterations = max_iterations; return *this; }
+  Index maxIterations() const { return (m_max_iterations < 0) ? 2 * m_matrix.cols() : m_max_iterations; }
+
+  Index iterations() const { return m_iterations; }
+  Scalar error() const { return m_error; }
+  Eigen::ComputationInfo info() const { return m_info; }
+
+  // `A` is a symmetric matrix, of which only the lower triangle is used
+  Conjugate_gradient& compute(const MatrixType& A)
+  {
+    m_matrix = A.template selfadjointView<Eigen::Lower>();
+    m_matrix.makeCompressed();
+
+    m_inverse_diagonal.resize(m_matrix.rows());
+    for_each_block(m_matrix.rows(), [&](Index b, Index e)
+    {
+      for(Index i=b; i<e; ++i)
+      {
+        const Scalar d = m_matrix.coeff(i, i);
+        m_inverse_diagonal[i] = (d != Scalar(0)) ? Scalar(1) / d : Scalar(1);
+      }
+    });
+
+    m_info = Eigen::Success;
+    return *this;
+  }
+
+  template <typename Rhs>
+  Vector solve(const Eigen::MatrixBase<Rhs>& b)
+  {
+    return solveWithGuess(b, Vector::Zero(m_matrix.rows()));
+  }
+
+  // Same as above, starting from `x0`
+  template <typename Rhs, typename Guess>
+  Vector solveWithGuess(const Eigen::MatrixBase<Rhs>& b, const Eigen::MatrixBase<Guess>& x0)
+  {
+    const Index n = m_matrix.rows();
+    CGAL_precondition(b.rows() == n && x0.rows() == n);
+
+    Vector x = x0;
+    const Vector rhs = b;
+
+    m_iterations = 0;
+    m_error = 0;
+    m_info = Eigen::Success;
+
+    const Scalar rhs_norm2 = dot(rhs, rhs);
+    if(rhs_norm2 == Scalar(0))
+      return Vector::Zero(n);
+
+    const Scalar consider_as_zero = (std::numeric_limits<Scalar>::min)();
+    const Scalar threshold = (std::max)(m_tolerance * m_tolerance * rhs_norm2, consider_as_zero);
+
+    Vector p(n), z(n), tmp(n);
+    product(x, tmp);
+    Vector residual = rhs - tmp;
+    Scalar residual_norm2 = dot(residual, residual);
+    if(residual_norm2 < threshold)
+    {
+      m_error = std::sqrt(residual_norm2 / rhs_norm2);
+      return x;
+    }
+
+    precondition(residual, p);
+    Scalar abs_new = dot(residual, p);
+
+    const Index max_iterations = maxIterations();
+    Index i = 0;
+    while(i < max_iterations)
+    {
+      product(p, tmp);
+
+      const Scalar alpha = abs_new / dot(p, tmp);
+      for_each_block(n, [&](Index bb, Index e)
+      {
+        for(Index j=bb; j<e; ++j)
+        {
+          x[j] += alpha * p[j];
+          residual[j] -= alpha * tmp[j];
+        }
+      });
+
+      residual_norm2 = dot(residual, residual);
+      if(residual_norm2 < threshold)
+        break;
+
+      precondition(residual, z);
+
+      const Scalar abs_old = abs_new;
+      abs_new = dot(residual, z);
+      const Scalar beta = abs_new / abs_old;
+      for_each_block(n, [&](Index bb, Index e)
+      {
+        for(Index j=bb; j<e; ++j)
+          p[j] = z[j] + beta * p[j];
+      });
+
+      ++i;
+    }
+
+    m_error = std::sqrt(residual_norm2 / rhs_norm2);
+    m_iterations = i;
+    m_info = (m_error <= m_tolerance) ? Eigen::Success : Eigen::NoConvergence;
+
+    return x;
+  }
+
+private:
+  static Index number_of_blocks(const Index n) { return (n + block_size - 1) / block_size; }
+
+  // calls `f(k)` for each `k` in `[0, nb_blocks)`
+  template <typename Function>
+  static void for_each_block_index(const Index nb_blocks, const Function& f)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<Index>(0, nb_blocks),
+                        [&](const tbb::blocked_range<Index>& r)
+      {
+        for(Index k=r.begin(); k!=r.end(); ++k)
+          f(k);
+      });
+      return;
+    }
+#endif
+    for(Index k=0; k<nb_blocks; ++k)
+      f(k);
+  }
+
+  // calls `f(first, last)` on the blocks of `[0, n)`
+  template <typename Function>
+  static void for_each_block(const Index n, const Function& f)
+  {
+    for_each_block_index(number_of_blocks(n), [&](Index k)
+    {
+      f(k * block_size, (std::min)(n, (k + 1) * block_size));
+    });
+  }
+
+  Scalar dot(const Vector& u, const Vector& v) const
+  {
+    const Index n = u.rows();
+    std::vector<Scalar> partial_sums(number_of_blocks(n));
+    for_each_block(n, [&](Index b, Index e)
+    {
+      partial_sums[b / block_size] = u.segment(b, e - b).dot(v.segment(b, e - b));
+    });
+
+    Scalar sum = 0;
+    for(const Scalar s : partial_sums)
+      sum += s;
+    return sum;
+  }
+
+  void product(const Vector& v, Vector& result) const
+  {
+    for_each_block(m_matrix.rows(), [&](Index b, Index e)
+    {
+      for(Index i=b; i<e; ++i)
+      {
+        Scalar sum = 0;
+        for(typename Full_matrix::InnerIterator it(m_matrix, i); it; ++it)
+          sum += it.value() * v[it.index()];
+        result[i] = sum;
+      }
+    });
+  }
+
+  void precondition(const Vector& v, Vector& result) const
+  {
+    for_each_block(v.rows(), [&](Index b, Index e)
+    {
+      for(Index i=b; i<e; ++i)
+        result[i] = m_inverse_diagonal[i] * v[i];
+    });
+  }
+
+private:
+  Full_matrix m_matrix;
+  Vector m_inverse_diagonal;
+
+  Scalar m_tolerance = Eigen::NumTraits<Scalar>::epsilon();
+  Index m_max_iterations = -1;
+
+  Index m_iterations = 0;
+  Scalar m_error = 0;
+  Eigen::ComputationInfo m_info = Eigen::Success;
+};
+
+} // namespace Poisson
+
+// The matrix of the system is symmetric
+template <class FT, class EigenMatrix, class ConcurrencyTag>
+struct Get_eigen_matrix<Poisson::Conjugate_gradient<EigenMatrix, ConcurrencyTag>, FT>
+{
+  typedef Eigen_sparse_symmetric_matrix<FT>   type;
+};
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_POISSON_SURFACE_RECONSTRUCTION_3_INTERNAL_CONJUGATE_GRADIENT_H
@@ -22,6 +22,15 @@
 #include <CGAL/Poisson_mesh_cell_criteria_3.h>
 #include <CGAL/assertions.h>
 #include <CGAL/Poisson_surface_reconstruction_3/internal/Poisson_mesh_traits_generator_3.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+#include <type_traits>
+#include <vector>
 
 namespace CGAL {
 
@@ -98,6 +107,41 @@ public:
       test_if_cell_is_bad(cit);
   }
 
+  // Same as above, but the cells are tested in parallel if `ConcurrencyTag` is `Parallel_tag`.
+  // The bad cells are then added to the queue sequentially, in the same order.
+  template <typename ConcurrencyTag>
+  void scan_triangulation_impl(ConcurrencyTag)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if constexpr(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      std::vector<Cell_handle> cells;
+      cells.reserve(triangulation_ref_impl().number_of_finite_cells());
+      for(Cell_handle c : triangulation_ref_impl().finite_cell_handles())
+        cells.push_back(c);
+
+      std::vector<char> is_bad(cells.size());
+      std::vector<Cell_quality> qualities(cells.size());
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, cells.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+          is_bad[i] = is_in_domain(cells[i]) && should_be_refined(cells[i], qualities[i]);
+      });
+
+      for(std::size_t i=0; i<cells.size(); ++i)
+        if(is_bad[i])
+          this->add_bad_element(cells[i], qualities[i]);
+      return;
+    }
+#endif
+
+    scan_triangulation_impl();
+  }
+
   void after_insertion_impl(const Vertex_handle& v)
   {
     update_star(v);
@@ -185,6 +229,10 @@ public:
 /// - convergence is guaranteed if radius_edge_ratio_bound >= 1.0.
 ///
 /// *Template Parameters*
+/// @tparam ConcurrencyTag enables sequential versus parallel scan of the initial
+///         triangulation for bad cells. Possible values are `Sequential_tag`,
+///         `Parallel_tag`, and `Parallel_if_available_tag`.
+///         The insertions are sequential, and the result does not depend on it.
 /// @tparam Tr 3D Delaunay triangulation.
 /// @tparam Surface Sphere_3 or Iso_cuboid_3.
 /// @tparam Sizing_field A sizing field functor type
@@ -198,7 +246,8 @@ public:
 /// that is smaller than the value of the second sizing field at its
 /// center, then the cell is considered as small enough and the first
 /// sizing field is not evaluated for that cell.
-template <typename Tr,
+template <typename ConcurrencyTag = Sequential_tag,
+          typename Tr,
           typename Surface,
           typename Sizing_field,
           typename Second_sizing_field>
@@ -233,7 +282,7 @@ unsigned int poisson_refine_triangulation(
   Oracle oracle;
   Null_mesher_level null_mesher_level;
   Refiner refiner(tr, tets_criteria, max_vertices, enlarged_bbox, oracle, null_mesher_level);
-  refiner.scan_triangulation(); // Push bad cells to the queue
+  refiner.scan_triangulation_impl(ConcurrencyTag()); // Push bad cells to the queue
   refiner.refine(Null_mesh_visitor()); // Refine triangulation until queue is empty
 
   nb_vertices = tr.number_of_vertices() - nb_vertices;
@@ -21,10 +21,83 @@
 #include <CGAL/make_mesh_3.h>
 #include <CGAL/facets_in_complex_3_to_triangle_mesh.h>
 #include <CGAL/Poisson_reconstruction_function.h>
+#ifdef CGAL_EIGEN3_ENABLED
+#include <CGAL/Octree_poisson_reconstruction_function.h>
+#endif
 #include <CGAL/property_map.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace CGAL {
 
+namespace internal {
+
+  // Meshes the 0 level set of the implicit function `function`
+  // with the parameters of the Poisson surface reconstruction functions
+  template <typename Kernel,
+            typename Implicit_function,
+            typename PolygonMesh,
+            typename Tag>
+  bool
+  mesh_poisson_implicit_function(const Implicit_function& function,
+                                 PolygonMesh& output_mesh,
+                                 double spacing,
+                                 double sm_angle,
+                                 double sm_radius,
+                                 double sm_distance,
+                                 Tag)
+  {
+    typedef typename Kernel::Sphere_3 Sphere;
+    typedef typename Kernel::Point_3 Point;
+    typedef typename Kernel::FT FT;
+
+    typedef CGAL::Labeled_mesh_domain_3<Kernel> Mesh_domain;
+    typedef typename CGAL::Mesh_triangulation_3<Mesh_domain, CGAL::Default, Sequential_tag>::type Tr;
+    typedef CGAL::Mesh_complex_3_in_triangulation_3<Tr> C3t3;
+    typedef CGAL::Mesh_criteria_3<Tr> Mesh_criteria;
+
+    Point inner_point = function.get_inner_point();
+    Sphere bsphere = function.bounding_sphere();
+    FT radius = CGAL::approximate_sqrt(bsphere.squared_radius());
+
+    FT sm_sphere_radius = 5.0 * radius;
+    FT sm_dichotomy_error = sm_distance * spacing / 1000.0;
+
+    Mesh_domain domain = Mesh_domain::create_implicit_mesh_domain(function, Sphere(inner_point, sm_sphere_radius),
+      CGAL::parameters::relative_error_bound(sm_dichotomy_error / sm_sphere_radius));
+
+    Mesh_criteria criteria(CGAL::parameters::facet_angle = sm_angle,
+                           CGAL::parameters::facet_size = sm_radius*spacing,
+                           CGAL::parameters::facet_distance = sm_distance*spacing);
+
+
+    auto turn_tag_into_mesh_3_manifold_option = [](Tag) {
+      if constexpr (std::is_same_v<Tag, CGAL::Manifold_with_boundary_tag>)
+        return CGAL::parameters::manifold_with_boundary();
+      else if constexpr (std::is_same_v<Tag, CGAL::Manifold_tag>)
+        return CGAL::parameters::manifold();
+      else
+        return CGAL::parameters::non_manifold();
+    };
+
+    C3t3 c3t3 = CGAL::make_mesh_3<C3t3>(domain, criteria,
+                                        turn_tag_into_mesh_3_manifold_option(Tag())
+                                        .no_exude().no_perturb()
+                                        .manifold_with_boundary());
+
+    const auto& tr = c3t3.triangulation();
+
+    if(tr.number_of_vertices() == 0)
+      return false;
+
+    CGAL::facets_in_complex_3_to_triangle_mesh(c3t3, output_mesh);
+
+    return true;
+  }
+
+} // namespace internal
+
 
   /*!
     \ingroup PkgPoissonSurfaceReconstruction3Ref
@@ -95,57 +168,103 @@ namespace CGAL {
   {
     typedef typename boost::property_traits<PointMap>::value_type Point;
     typedef typename Kernel_traits<Point>::Kernel Kernel;
-    typedef typename Kernel::Sphere_3 Sphere;
-    typedef typename Kernel::FT FT;
 
     typedef CGAL::Poisson_reconstruction_function<Kernel> Poisson_reconstruction_function;
-    typedef CGAL::Labeled_mesh_domain_3<Kernel> Mesh_domain;
-    typedef typename CGAL::Mesh_triangulation_3<Mesh_domain, CGAL::Default, Sequential_tag>::type Tr;
-    typedef CGAL::Mesh_complex_3_in_triangulation_3<Tr> C3t3;
-    typedef CGAL::Mesh_criteria_3<Tr> Mesh_criteria;
 
     Poisson_reconstruction_function function(begin, end, point_map, normal_map);
     if ( ! function.compute_implicit_function() )
       return false;
 
-    Point inner_point = function.get_inner_point();
-    Sphere bsphere = function.bounding_sphere();
-    FT radius = CGAL::approximate_sqrt(bsphere.squared_radius());
+    return internal::mesh_poisson_implicit_function<Kernel>(function, output_mesh, spacing,
+                                                            sm_angle, sm_radius, sm_distance, tag);
+  }
 
-    FT sm_sphere_radius = 5.0 * radius;
-    FT sm_dichotomy_error = sm_distance * spacing / 1000.0;
+#if defined(CGAL_EIGEN3_ENABLED) || defined(DOXYGEN_RUNNING)
+  /*!
+    \ingroup PkgPoissonSurfaceReconstruction3Ref
 
-    Mesh_domain domain = Mesh_domain::create_implicit_mesh_domain(function, Sphere(inner_point, sm_sphere_radius),
-      CGAL::parameters::relative_error_bound(sm_dichotomy_error / sm_sphere_radius));
+    Same as `poisson_surface_reconstruction_delaunay()`, but the Poisson
+    implicit function is computed with `Octree_poisson_reconstruction_function`,
+    on an octree whose smallest leaves have a size close to `spacing`,
+    which requires much less memory.
 
-    Mesh_criteria criteria(CGAL::parameters::facet_angle = sm_angle,
-                           CGAL::parameters::facet_size = sm_radius*spacing,
-                           CGAL::parameters::facet_distance = sm_distance*spacing);
+    \tparam PointInputIterator is a model of `InputIterator`.
 
+    \tparam PointMap is a model of `ReadablePropertyMap` with value
+    type `Point_3<Kernel>`.
 
-    auto turn_tag_into_mesh_3_manifold_option = [](Tag) {
-      if constexpr (std::is_same_v<Tag, CGAL::Manifold_with_boundary_tag>)
-        return CGAL::parameters::manifold_with_boundary();
-      else if constexpr (std::is_same_v<Tag, CGAL::Manifold_tag>)
-        return CGAL::parameters::manifold();
-      else
-        return CGAL::parameters::non_manifold();
-    };
+    \tparam NormalMap is a model of `ReadablePropertyMap` with value
+    type `Vector_3<Kernel>`.
 
-    C3t3 c3t3 = CGAL::make_mesh_3<C3t3>(domain, criteria,
-                                        turn_tag_into_mesh_3_manifold_option(tag)
-                                        .no_exude().no_perturb()
-                                        .manifold_with_boundary());
+    \tparam PolygonMesh a model of `MutableFaceGraph` with an internal
+    point property map.
 
-    const auto& tr = c3t3.triangulation();
+    \tparam Tag is a tag whose type affects the behavior of the
+    meshing algorithm (see `make_surface_mesh()`).
 
-    if(tr.number_of_vertices() == 0)
+    \tparam ConcurrencyTag enables sequential versus parallel computation
+    of the implicit function. Possible values are `Sequential_tag`,
+    `Parallel_tag`, and `Parallel_if_available_tag`.
+
+    \param begin iterator on the first point of the sequence.
+    \param end past the end iterator of the point sequence.
+    \param point_map property map: value_type of `InputIterator` -> Point_3.
+    \param normal_map property map: value_type of `InputIterator` -> Vector_3.
+    \param output_mesh where the reconstruction is stored.
+    \param spacing size parameter.
+    \param sm_angle bound for the minimum facet angle in degrees.
+    \param sm_radius bound for the radius of the surface Delaunay balls (relatively to the `average_spacing`).
+    \param sm_distance bound for the center-center distances (relatively to the `average_spacing`).
+    \param tag surface mesher tag.
+    \param concurrency_tag concurrency tag.
+    \return `true` if reconstruction succeeded, `false` otherwise.
+  */
+  template <typename PointInputIterator,
+            typename PointMap,
+            typename NormalMap,
+            typename PolygonMesh,
+            typename Tag = CGAL::Manifold_with_boundary_tag,
+            typename ConcurrencyTag = CGAL::Sequential_tag>
+  bool
+  poisson_surface_reconstruction_octree (PointInputIterator begin,
+                                         PointInputIterator end,
+                                         PointMap point_map,
+                                         NormalMap normal_map,
+                                         PolygonMesh& output_mesh,
+                                         double spacing,
+                                         double sm_angle = 20.0,
+                                         double sm_radius = 30.0,
+                                         double sm_distance = 0.375,
+                                         Tag tag = Tag(),
+                                         ConcurrencyTag concurrency_tag = ConcurrencyTag())
+  {
+    typedef typename boost::property_traits<PointMap>::value_type Point;
+    typedef typename Kernel_traits<Point>::Kernel Kernel;
+
+    typedef CGAL::Octree_poisson_reconstruction_function<Kernel> Poisson_reconstruction_function;
+
+    if(begin == end)
       return false;
 
-    CGAL::facets_in_complex_3_to_triangle_mesh(c3t3, output_mesh);
+    // the smallest leaves have a size close to `spacing`; the root node is the
+    // bounding cube of the points enlarged by 1.5
+    Bbox_3 bbox;
+    for(PointInputIterator it = begin; it != end; ++it)
+      bbox += get(point_map, *it).bbox();
+    const double side = 1.5 * (std::max)({ bbox.xmax() - bbox.xmin(),
+                                           bbox.ymax() - bbox.ymin(),
+                                           bbox.zmax() - bbox.zmin() });
+    const double depth = std::ceil(std::log2(side / spacing));
+    const unsigned int max_depth = static_cast<unsigned int>((std::min)((std::max)(depth, 1.), 16.));
 
-    return true;
+    Poisson_reconstruction_function function(begin, end, point_map, normal_map);
+    if ( ! function.compute_implicit_function(max_depth, 4., concurrency_tag) )
+      return false;
+
+    return internal::mesh_poisson_implicit_function<Kernel>(function, output_mesh, spacing,
+                                                            sm_angle, sm_radius, sm_distance, tag);
   }
+#endif
 
 
 }
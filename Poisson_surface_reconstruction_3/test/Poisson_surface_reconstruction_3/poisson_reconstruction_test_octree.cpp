@@ -0,0 +1,119 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Octree_poisson_reconstruction_function.h>
+#include <CGAL/poisson_surface_reconstruction.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/property_map.h>
+#include <CGAL/IO/read_points.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// Checks the Poisson implicit function discretized on an octree,
+// on a sampling of the unit sphere.
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+
+typedef std::pair<Point, Vector> Point_with_normal;
+typedef CGAL::First_of_pair_property_map<Point_with_normal> Point_map;
+typedef CGAL::Second_of_pair_property_map<Point_with_normal> Normal_map;
+
+typedef CGAL::Octree_poisson_reconstruction_function<Kernel> Octree_poisson_reconstruction_function;
+typedef CGAL::Surface_mesh<Point> Mesh;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+template <typename Tag>
+std::vector<FT> values(const std::vector<Point_with_normal>& points,
+                       const std::vector<Point>& queries,
+                       Tag tag)
+{
+  Octree_poisson_reconstruction_function function(points.begin(), points.end(), Point_map(), Normal_map());
+
+  CGAL::Real_timer timer;
+  timer.start();
+  bool ok = function.compute_implicit_function(7, 4., tag);
+  assert(ok);
+  std::cout << "  " << function.number_of_leaves() << " leaves, "
+            << timer.time() << " s." << std::endl;
+
+  assert(function(function.get_inner_point()) < 0);
+
+  std::vector<FT> result;
+  for(const Point& q : queries)
+    result.push_back(function(q));
+  return result;
+}
+
+int main(int argc, char** argv)
+{
+  const char* filename = (argc > 1) ? argv[1] : "data/sphere_20k.xyz";
+
+  std::vector<Point> input;
+  if(!CGAL::IO::read_points(filename, std::back_inserter(input)))
+  {
+    std::cerr << "Error: cannot read file " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the input is a sampling of the unit sphere
+  std::vector<Point_with_normal> points;
+  for(const Point& p : input)
+    points.emplace_back(p, p - CGAL::ORIGIN);
+
+  CGAL::Random random(0);
+  std::vector<Point> queries;
+  for(int i=0; i<1000; ++i)
+    queries.emplace_back(random.get_double(-1.5, 1.5),
+                         random.get_double(-1.5, 1.5),
+                         random.get_double(-1.5, 1.5));
+
+  std::cout << "Sequential" << std::endl;
+  std::vector<FT> sequential_values = values(points, queries, CGAL::Sequential_tag());
+
+  // the sign is correct, except close to the surface
+  for(std::size_t i=0; i<queries.size(); ++i)
+  {
+    const double d = std::sqrt(CGAL::to_double(queries[i].x() * queries[i].x() +
+                                               queries[i].y() * queries[i].y() +
+                                               queries[i].z() * queries[i].z()));
+    if(std::abs(d - 1) > 0.1)
+      assert((sequential_values[i] < 0) == (d < 1));
+  }
+
+  // the function does not depend on the concurrency tag
+  std::cout << "Parallel" << std::endl;
+  std::vector<FT> parallel_values = values(points, queries, Concurrency_tag());
+  assert(parallel_values == sequential_values);
+
+  // meshing
+  Mesh mesh;
+  bool ok = CGAL::poisson_surface_reconstruction_octree(points.begin(), points.end(),
+                                                        Point_map(), Normal_map(), mesh, 0.05,
+                                                        20., 30., 0.375,
+                                                        CGAL::Manifold_with_boundary_tag(),
+                                                        Concurrency_tag());
+  assert(ok);
+  std::cout << num_vertices(mesh) << " vertices in the output mesh" << std::endl;
+  assert(num_faces(mesh) > 100);
+  for(Mesh::Vertex_index v : vertices(mesh))
+  {
+    const Point& p = mesh.point(v);
+    const double d = std::sqrt(CGAL::to_double(p.x() * p.x() + p.y() * p.y() + p.z() * p.z()));
+    assert(std::abs(d - 1) < 0.1);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,123 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Poisson_reconstruction_function.h>
+#include <CGAL/property_map.h>
+#include <CGAL/IO/read_points.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+// Checks that the implicit function does not depend on the concurrency tag,
+// and that the parallel solver gives the same function as the Eigen solver.
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+typedef Kernel::Point_3 Point;
+typedef Kernel::Vector_3 Vector;
+
+typedef std::pair<Point, Vector> Point_with_normal;
+typedef CGAL::First_of_pair_property_map<Point_with_normal> Point_map;
+typedef CGAL::Second_of_pair_property_map<Point_with_normal> Normal_map;
+
+typedef CGAL::Poisson_reconstruction_function<Kernel> Poisson_reconstruction_function;
+
+typedef CGAL::Eigen_sparse_symmetric_matrix<double>::EigenType EigenMatrix;
+typedef CGAL::Eigen_solver_traits<Eigen::ConjugateGradient<EigenMatrix> > Eigen_solver;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+template <typename Solver, typename Tag>
+std::vector<FT> values(const std::vector<Point_with_normal>& points,
+                       const std::vector<Point>& queries,
+                       const bool smoother_hole_filling,
+                       Tag tag)
+{
+  Poisson_reconstruction_function function(points.begin(), points.end(), Point_map(), Normal_map());
+
+  CGAL::Real_timer timer;
+  timer.start();
+  bool ok = function.compute_implicit_function(Solver(), smoother_hole_filling, tag);
+  assert(ok);
+  std::cout << "  " << function.tr().number_of_vertices() << " vertices, "
+            << timer.time() << " s." << std::endl;
+
+  std::vector<FT> result;
+  for(const Point& q : queries)
+    result.push_back(function(q));
+  return result;
+}
+
+int main(int argc, char** argv)
+{
+  const char* filename = (argc > 1) ? argv[1] : "data/sphere_20k.xyz";
+
+  std::vector<Point> input;
+  if(!CGAL::IO::read_points(filename, std::back_inserter(input)))
+  {
+    std::cerr << "Error: cannot read file " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the input is a sampling of the unit sphere
+  std::vector<Point_with_normal> points;
+  for(const Point& p : input)
+    points.emplace_back(p, p - CGAL::ORIGIN);
+
+  CGAL::Random random(0);
+  std::vector<Point> queries;
+  for(int i=0; i<1000; ++i)
+    queries.emplace_back(random.get_double(-1.5, 1.5),
+                         random.get_double(-1.5, 1.5),
+                         random.get_double(-1.5, 1.5));
+
+  for(const bool smoother_hole_filling : { false, true })
+  {
+    std::cout << "Smoother hole filling: " << std::boolalpha << smoother_hole_filling << std::endl;
+
+    std::cout << "Sequential" << std::endl;
+    std::vector<FT> sequential_values = values<Eigen_solver>(points, queries, smoother_hole_filling,
+                                                             CGAL::Sequential_tag());
+
+    // same linear system and same solver: same values
+    std::cout << "Parallel" << std::endl;
+    std::vector<FT> parallel_values = values<Eigen_solver>(points, queries, smoother_hole_filling,
+                                                           Concurrency_tag());
+    assert(parallel_values == sequential_values);
+
+    // the conjugate gradient with a parallel matrix-vector product
+    std::cout << "Parallel solver" << std::endl;
+    typedef CGAL::Eigen_solver_traits<
+      CGAL::internal::Poisson::Conjugate_gradient<EigenMatrix, Concurrency_tag> > Parallel_solver;
+    std::vector<FT> solver_values = values<Parallel_solver>(points, queries, smoother_hole_filling,
+                                                            Concurrency_tag());
+
+    for(std::size_t i=0; i<queries.size(); ++i)
+    {
+      assert(std::abs(solver_values[i] - sequential_values[i]) < 1e-3 * (1 + std::abs(sequential_values[i])));
+
+      // the sign is the same, except close to the surface
+      const double d = std::sqrt(CGAL::to_double(queries[i].x() * queries[i].x() +
+                                                 queries[i].y() * queries[i].y() +
+                                                 queries[i].z() * queries[i].z()));
+      if(std::abs(d - 1) > 0.1)
+        assert((solver_values[i] < 0) == (d < 1));
+    }
+  }
+
+  // default solver
+  Poisson_reconstruction_function function(points.begin(), points.end(), Point_map(), Normal_map());
+  bool ok = function.compute_implicit_function(false, Concurrency_tag());
+  assert(ok);
+  assert(function(CGAL::ORIGIN) < 0);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
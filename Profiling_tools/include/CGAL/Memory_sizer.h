@@ -27,6 +27,7 @@ struct Memory_sizer
     typedef std::size_t   size_type;
     size_type virtual_size()  const { return 0; }
     size_type resident_size() const { return 0; }
+    size_type peak_resident_size() const { return 0; }
 };
 
 } //namespace CGAL
@@ -46,9 +47,11 @@ struct Memory_sizer
 #  include <fstream>
 #  include <cstddef>
 #  include <unistd.h>
+#  include <sys/resource.h>
 #elif defined __APPLE__
 #include <mach/task.h>
 #include <mach/mach_init.h>
+#include <sys/resource.h>
 #endif
 
 namespace CGAL {
@@ -65,6 +68,27 @@ struct Memory_sizer
     size_type virtual_size()  const { return get(true); }
     size_type resident_size() const { return get(false); }
 
+    // The maximal resident size reached by the process so far
+    size_type peak_resident_size() const
+    {
+#ifdef _MSC_VER
+      size_type result = 0;
+      PROCESS_MEMORY_COUNTERS pmc;
+      if ( GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof(pmc)) )
+        result = pmc.PeakWorkingSetSize;
+      return result;
+#else
+      struct rusage usage;
+      if ( getrusage(RUSAGE_SELF, &usage) != 0 )
+        return 0;
+#  ifdef __APPLE__
+      return static_cast<size_type>(usage.ru_maxrss); // in bytes
+#  else
+      return static_cast<size_type>(usage.ru_maxrss) * 1024; // in kilobytes
+#  endif
+#endif
+    }
+
 private:
 
   size_type get (bool virtual_size)  const
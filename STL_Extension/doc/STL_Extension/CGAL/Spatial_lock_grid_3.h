@@ -50,6 +50,13 @@ public:
   /// Sets the bounding box of the domain.
   void set_bbox(const CGAL::Bbox_3 &bbox);
 
+  /// Returns the number of cells per axis of the grid.
+  int num_grid_cells_per_axis() const;
+
+  /// Sets the number of cells per axis of the grid.
+  /// \pre No cell of the grid is locked.
+  void set_num_grid_cells_per_axis(int num_grid_cells_per_axis);
+
 /// @}
 
 }; /* end Spatial_lock_grid_3 */
@@ -23,8 +23,26 @@
 #include <CGAL/Handle_for.h>
 #include <CGAL/assertions.h>
 
+// With `CGAL_HANDLE_BIASED_REFERENCE_COUNTING`, the references taken by the thread
+// that creates a `Rep` are counted without atomic operations (see Biased_reference_count.h).
+#if defined CGAL_HANDLE_BIASED_REFERENCE_COUNTING && defined CGAL_HAS_THREADS
+#  define CGAL_HANDLE_USE_BIASED_REFERENCE_COUNT 1
+#  include <CGAL/STL_Extension/internal/Biased_reference_count.h>
+#endif
+
 namespace CGAL {
 
+#ifdef CGAL_HANDLE_USE_BIASED_REFERENCE_COUNT
+class Rep
+  : public internal::Biased_reference_counted
+{
+    friend class Handle;
+  protected:
+    Rep(int count = 1)
+      : internal::Biased_reference_counted(count)
+    {}
+};
+#else
 class Rep
 {
     friend class Handle;
@@ -36,6 +54,7 @@ class Rep
 
     std::atomic_int count;
 };
+#endif
 
 
 class Handle
@@ -79,6 +98,15 @@ class Handle
     friend void swap(Handle& a, Handle& b) noexcept { std::swap(a.PTR, b.PTR); }
 
   private:
+#ifdef CGAL_HANDLE_USE_BIASED_REFERENCE_COUNT
+    void incref() const noexcept { PTR->incref(); }
+
+    void decref()
+    {
+      if (PTR->decref())
+        delete PTR;
+    }
+#else
     void incref() const noexcept
     {
       if (is_currently_single_threaded()) {
@@ -109,6 +137,7 @@ class Handle
         }
       }
     }
+#endif
 
   public:
     void reset()
@@ -120,8 +149,13 @@ class Handle
       }
     }
 
+#ifdef CGAL_HANDLE_USE_BIASED_REFERENCE_COUNT
+    int
+    refs()  const noexcept { return PTR->refs(); }
+#else
     int
     refs()  const noexcept { return PTR->count.load(std::memory_order_relaxed); }
+#endif
 
     Id_type id() const noexcept { return static_cast<Id_type>(reinterpret_cast<std::intptr_t>(static_cast<void*>(PTR)) / sizeof(Rep)); }
 
@@ -0,0 +1,286 @@
+// Copyright (c) 2026 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_INTERNAL_BIASED_REFERENCE_COUNT_H
+#define CGAL_INTERNAL_BIASED_REFERENCE_COUNT_H
+
+#include <CGAL/config.h>
+#include <CGAL/assertions.h>
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// Biased reference counting (Choi, Shull, and Torrellas, PACT 2018), used by `CGAL::Rep`
+// when `CGAL_HANDLE_BIASED_REFERENCE_COUNTING` is defined.
+//
+// An object is owned by the thread that creates it. The references taken and released
+// by the owner are counted in `biased` without atomic operations, and the ones of the
+// other threads in `shared`, atomically. The number of references is the sum of both.
+//
+// When `biased` drops to zero, the owner merges the counters: it marks the object
+// as merged and gives up its ownership, after which all the threads use `shared`,
+// and the object is deleted when `shared` drops to zero.
+//
+// When a reference counted in `biased` is released by another thread, `shared` becomes
+// negative. The object is then queued to its owner, which merges the counters the next
+// time it creates an object or when it exits. This defers the reclamation of the objects
+// that the owner does not use anymore. A queued object is only deleted by the merge.
+// If the owner has exited, the thread that queues the object merges it itself.
+//
+// The records of the threads are reused by the next threads, which then own the objects
+// of the previous ones; they are never released.
+
+namespace CGAL {
+namespace internal {
+
+class Biased_reference_counted;
+
+class Biased_reference_count_thread
+{
+  friend class Biased_reference_counted;
+
+  std::mutex mutex;
+  std::vector<Biased_reference_counted*> queue;
+  bool alive = false;                 // protected by `mutex`
+  std::atomic<bool> pending { false };
+  Biased_reference_count_thread* next_free = nullptr;
+
+  struct Registry
+  {
+    std::mutex mutex;
+    Biased_reference_count_thread* free = nullptr;
+  };
+
+  static Registry& registry()
+  {
+    static Registry r;
+    return r;
+  }
+
+  static Biased_reference_count_thread*& current_ptr()
+  {
+    static thread_local Biased_reference_count_thread* p = nullptr;
+    return p;
+  }
+
+  // releases the record of the thread when it exits
+  struct Owner
+  {
+    Biased_reference_count_thread* record;
+    ~Owner() { record->exit(); }
+  };
+
+  static Biased_reference_count_thread* acquire()
+  {
+    Biased_reference_count_thread* t;
+    {
+      Registry& r = registry();
+      std::lock_guard<std::mutex> lock(r.mutex);
+      t = r.free;
+      if(t != nullptr)
+        r.free = t->next_free;
+    }
+    if(t == nullptr)
+      t = new Biased_reference_count_thread();
+    {
+      std::lock_guard<std::mutex> lock(t->mutex);
+      t->alive = true;
+    }
+    static thread_local Owner owner { t };
+    return t;
+  }
+
+  inline void exit();
+  inline void process_queue();
+  inline void enqueue(Biased_reference_counted* o);
+
+public:
+  // the record of the current thread
+  static Biased_reference_count_thread* current()
+  {
+    Biased_reference_count_thread*& p = current_ptr();
+    if(p == nullptr)
+      p = acquire();
+    return p;
+  }
+
+  // the record of the current thread, or null if it has none yet
+  static Biased_reference_count_thread* current_if_any() noexcept
+  {
+    return current_ptr();
+  }
+};
+
+class Biased_reference_counted
+{
+  friend class Biased_reference_count_thread;
+
+  // `shared` is the counter of the other threads, times 4, plus the flags
+  static constexpr int merged = 1;
+  static constexpr int queued = 2;
+  static constexpr int one = 4;
+
+  std::atomic<Biased_reference_count_thread*> owner;
+  int biased;
+  std::atomic<int> shared;
+
+  bool is_owned() const noexcept
+  {
+    Biased_reference_count_thread* t = Biased_reference_count_thread::current_if_any();
+    return t != nullptr && owner.load(std::memory_order_relaxed) == t;
+  }
+
+  // adds `biased` to `shared`, and gives up the ownership. Called by the owner,
+  // or by any thread once the owner has exited. Returns true if the object must be deleted.
+  bool merge() noexcept
+  {
+    const int b = biased;
+    biased = 0;
+    owner.store(nullptr, std::memory_order_relaxed);
+    int s = shared.load(std::memory_order_relaxed);
+    int n;
+    do {
+      n = ((s & ~queued) + b * one) | merged;
+    } while(!shared.compare_exchange_weak(s, n, std::memory_order_acq_rel, std::memory_order_relaxed));
+    CGAL_assertion(n >= merged);
+    return n == merged;
+  }
+
+protected:
+  Biased_reference_counted(int count = 1)
+    : owner(Biased_reference_count_thread::current()), biased(count), shared(0)
+  {
+    Biased_reference_count_thread* t = owner.load(std::memory_order_relaxed);
+    if(t->pending.load(std::memory_order_relaxed))
+      t->process_queue();
+  }
+
+  virtual ~Biased_reference_counted() {}
+
+  void incref() noexcept
+  {
+    if(is_owned())
+      ++biased;
+    else
+      shared.fetch_add(one, std::memory_order_relaxed);
+  }
+
+  // returns true if the object must be deleted by the caller
+  bool decref()
+  {
+    if(is_owned())
+    {
+      if(--biased > 0)
+        return false;
+      owner.store(nullptr, std::memory_order_relaxed);
+      const int s = shared.fetch_or(merged, std::memory_order_acq_rel);
+      // a queued object is deleted by the merge
+      return s == 0;
+    }
+
+    int s = shared.load(std::memory_order_relaxed);
+    int n;
+    bool must_queue;
+    do {
+      n = s - one;
+      // the first time `shared` becomes negative, the object is queued
+      must_queue = (n < 0 && !(s & (queued | merged)));
+      if(must_queue)
+        n |= queued;
+    } while(!shared.compare_exchange_weak(s, n, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    if(must_queue)
+    {
+      Biased_reference_count_thread* t = owner.load(std::memory_order_relaxed);
+      CGAL_assertion(t != nullptr);
+      t->enqueue(this);
+      return false;
+    }
+    return n == merged;
+  }
+
+  // the number of references, which is exact only if no other thread uses the object
+  int refs() const noexcept
+  {
+    const int s = shared.load(std::memory_order_relaxed);
+    const int b = (s & merged) ? 0 : biased;
+    return b + (s - (s & (merged | queued))) / one;
+  }
+};
+
+void Biased_reference_count_thread::process_queue()
+{
+  std::vector<Biased_reference_counted*> q;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::swap(q, queue);
+    pending.store(false, std::memory_order_relaxed);
+  }
+  for(Biased_reference_counted* o : q)
+    if(o->merge())
+      delete o;
+}
+
+void Biased_reference_count_thread::enqueue(Biased_reference_counted* o)
+{
+  bool to_delete;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if(alive)
+    {
+      queue.push_back(o);
+      pending.store(true, std::memory_order_relaxed);
+      return;
+    }
+    // The owner has exited, and no thread can use its record before the mutex
+    // is released, so the object can be merged here.
+    to_delete = o->merge();
+  }
+  // deleting an object releases its own references, and can enqueue other objects
+  if(to_delete)
+    delete o;
+}
+
+void Biased_reference_count_thread::exit()
+{
+  for(;;)
+  {
+    std::vector<Biased_reference_counted*> q;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if(queue.empty())
+      {
+        alive = false;
+        pending.store(false, std::memory_order_relaxed);
+        break;
+      }
+      std::swap(q, queue);
+    }
+    for(Biased_reference_counted* o : q)
+      if(o->merge())
+        delete o;
+  }
+  // the references released after this point, by the destructors of other
+  // thread-local variables, are counted in `shared`
+  current_ptr() = nullptr;
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  next_free = r.free;
+  r.free = this;
+}
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_INTERNAL_BIASED_REFERENCE_COUNT_H
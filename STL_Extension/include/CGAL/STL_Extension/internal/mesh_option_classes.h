@@ -15,6 +15,10 @@
 
 namespace CGAL {
 
+namespace Mesh_3 {
+struct Mesh_statistics;
+}
+
 enum Mesh_error_code {
   CGAL_MESH_3_NO_ERROR = 0,
   CGAL_MESH_3_MAXIMAL_NUMBER_OF_VERTICES_REACHED,
@@ -138,6 +142,7 @@ struct Mesh_3_options {
 #ifndef CGAL_NO_ATOMIC
     , pointer_to_stop_atomic_boolean(0)
 #endif
+    , pointer_to_statistics(0)
   {}
 
   std::string dump_after_init_prefix;
@@ -153,6 +158,7 @@ struct Mesh_3_options {
 #ifndef CGAL_NO_ATOMIC
   Pointer_to_stop_atomic_boolean_t pointer_to_stop_atomic_boolean;
 #endif
+  Mesh_3::Mesh_statistics* pointer_to_statistics;
 
 }; // end struct Mesh_3_options
 
@@ -313,6 +313,7 @@ mesh_3_options(const CGAL_NP_CLASS& np = parameters::default_values())
   options.pointer_to_stop_atomic_boolean=choose_parameter(get_parameter(np, ::CGAL::internal_np::pointer_to_stop_atomic_boolean_param),
                                                           ((::CGAL::parameters::internal::Mesh_3_options::Pointer_to_stop_atomic_boolean_t)0));
 #endif
+  options.pointer_to_statistics=choose_parameter(get_parameter(np, ::CGAL::internal_np::statistics_param), ((::CGAL::Mesh_3::Mesh_statistics*)0));
 
   typedef Named_function_parameters<::CGAL::parameters::internal::Mesh_3_options, ::CGAL::internal_np::mesh_param_t, CGAL_NP_BASE> Param;
   return CGAL_NP_BUILD(Param, options);
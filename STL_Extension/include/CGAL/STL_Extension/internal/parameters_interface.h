@@ -48,6 +48,7 @@ CGAL_add_named_parameter(prevent_unselection_t, prevent_unselection, prevent_uns
 
 CGAL_add_named_parameter(verbose_t, verbose, verbose)
 CGAL_add_named_parameter(concurrency_tag_t, concurrency_tag, concurrency_tag)
+CGAL_add_named_parameter(number_of_tiles_per_side_t, number_of_tiles_per_side, number_of_tiles_per_side)
 
 // List of named parameters used for IO
 CGAL_add_named_parameter(vertex_normal_output_iterator_t, vertex_normal_output_iterator, vertex_normal_output_iterator)
@@ -338,6 +339,7 @@ CGAL_add_named_parameter_with_compatibility(maximal_number_of_vertices_param_t,
 CGAL_add_named_parameter_with_compatibility(nonlinear_growth_of_balls_param_t, nonlinear_growth_of_balls_param, nonlinear_growth_of_balls)
 CGAL_add_named_parameter_with_compatibility(pointer_to_error_code_param_t, pointer_to_error_code_param, pointer_to_error_code)
 CGAL_add_named_parameter_with_compatibility(pointer_to_stop_atomic_boolean_param_t, pointer_to_stop_atomic_boolean_param, pointer_to_stop_atomic_boolean)
+CGAL_add_named_parameter_with_compatibility(statistics_param_t, statistics_param, statistics)
 CGAL_add_named_parameter_with_compatibility(exude_options_param_t, exude_options_param, exude_options)
 CGAL_add_named_parameter_with_compatibility(perturb_options_param_t, perturb_options_param, perturb_options)
 CGAL_add_named_parameter_with_compatibility(odt_options_param_t, odt_options_param, odt_options)
@@ -15,12 +15,18 @@
 #ifdef CGAL_LINKED_WITH_TBB
 
 #include <CGAL/Bbox_3.h>
+#include <CGAL/assertions.h>
 
 #include <atomic>
+#include <new>
 #include <thread>
+#include <tbb/blocked_range.h>
 #include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
 
 #include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <vector>
 
 namespace CGAL {
@@ -34,26 +40,14 @@ struct Tag_priority_blocking {};
 // (Uses Curiously recurring template pattern)
 //*****************************************************************************
 
+// The cells of the grid store the ID of the thread owning them (0 if they are free),
+// so that a thread knows which cells it owns without a thread-local copy of the grid:
+// the memory of the structure does not grow with the number of threads, which allows
+// finer grids when there are many threads.
 template <typename Derived>
 class Spatial_lock_grid_base_3
 {
-private:
-  static bool *init_TLS_grid(int num_cells_per_axis)
-  {
-    int num_cells = num_cells_per_axis*
-      num_cells_per_axis*num_cells_per_axis;
-    bool *local_grid = new bool[num_cells];
-    for (int i = 0 ; i < num_cells ; ++i)
-      local_grid[i] = false;
-    return local_grid;
-  }
-
 public:
-  bool *get_thread_local_grid()
-  {
-    return m_tls_grids.local();
-  }
-
   void set_bbox(const Bbox_3 &bbox)
   {
     // Compute resolutions
@@ -77,9 +71,35 @@ public:
     return m_bbox;
   }
 
+  int num_grid_cells_per_axis() const
+  {
+    return m_num_grid_cells_per_axis;
+  }
+
+  // Changes the resolution of the grid.
+  // No cell must be locked when this function is called.
+  void set_num_grid_cells_per_axis(int num_grid_cells_per_axis)
+  {
+    CGAL_precondition(num_grid_cells_per_axis > 0);
+    CGAL_expensive_precondition(check_if_all_cells_are_unlocked());
+
+    if (num_grid_cells_per_axis == m_num_grid_cells_per_axis)
+      return;
+
+    m_num_grid_cells_per_axis = num_grid_cells_per_axis;
+    static_cast<Derived*>(this)->resize_grid_impl(num_cells());
+    for (typename TLS_locked_cells::iterator it = m_tls_locked_cells.begin() ;
+         it != m_tls_locked_cells.end() ;
+         ++it)
+    {
+      it->clear();
+    }
+    set_bbox(m_bbox);
+  }
+
   bool is_locked_by_this_thread(int cell_index)
   {
-    return get_thread_local_grid()[cell_index];
+    return static_cast<Derived*>(this)->is_cell_locked_by_this_thread_impl(cell_index);
   }
 
   template <typename P3>
@@ -91,7 +111,7 @@ public:
   template <typename P3>
   bool is_locked_by_this_thread(const P3 &point)
   {
-    return get_thread_local_grid()[get_grid_index(point)];
+    return is_locked_by_this_thread(get_grid_index(point));
   }
 
   bool try_lock(int cell_index)
@@ -102,7 +122,7 @@ public:
   template <bool no_spin>
   bool try_lock(int cell_index)
   {
-    return get_thread_local_grid()[cell_index]
+    return is_locked_by_this_thread(cell_index)
         || try_lock_cell<no_spin>(cell_index);
   }
 
@@ -253,9 +273,7 @@ public:
 
   void unlock(int cell_index)
   {
-    // Unlock lock and shared grid
     unlock_cell(cell_index);
-    get_thread_local_grid()[cell_index] = false;
   }
 
   void unlock_all_points_locked_by_this_thread()
@@ -267,7 +285,7 @@ public:
     {
       // If we still own the lock
       int cell_index = *it;
-      if (get_thread_local_grid()[cell_index] == true)
+      if (is_locked_by_this_thread(cell_index))
         unlock(cell_index);
     }
     tls_locked_cells.clear();
@@ -283,7 +301,7 @@ public:
     {
       // If we still own the lock
       int cell_index = *it;
-      if (get_thread_local_grid()[cell_index] == true)
+      if (is_locked_by_this_thread(cell_index))
       {
         if (cell_index == cell_index_to_keep_locked)
           cell_to_keep_found = true;
@@ -304,21 +322,19 @@ public:
 
   bool check_if_all_cells_are_unlocked()
   {
-    int num_cells = m_num_grid_cells_per_axis*
-      m_num_grid_cells_per_axis*m_num_grid_cells_per_axis;
+    const int n = num_cells();
     bool unlocked = true;
-    for (int i = 0 ; unlocked && i < num_cells ; ++i)
+    for (int i = 0 ; unlocked && i < n ; ++i)
       unlocked = !is_cell_locked(i);
     return unlocked;
   }
 
   bool check_if_all_tls_cells_are_unlocked()
   {
-    int num_cells = m_num_grid_cells_per_axis*
-      m_num_grid_cells_per_axis*m_num_grid_cells_per_axis;
+    const int n = num_cells();
     bool unlocked = true;
-    for (int i = 0 ; unlocked && i < num_cells ; ++i)
-      unlocked = (get_thread_local_grid()[i] == false);
+    for (int i = 0 ; unlocked && i < n ; ++i)
+      unlocked = !is_locked_by_this_thread(i);
     return unlocked;
   }
 
@@ -328,21 +344,61 @@ protected:
   Spatial_lock_grid_base_3(const Bbox_3 &bbox,
                                           int num_grid_cells_per_axis)
     : m_num_grid_cells_per_axis(num_grid_cells_per_axis),
-      m_tls_grids([num_grid_cells_per_axis](){ return init_TLS_grid(num_grid_cells_per_axis); })
+      m_tls_thread_ids(init_TLS_thread_id)
   {
     set_bbox(bbox);
   }
 
-  /// Destructor
-  ~Spatial_lock_grid_base_3()
+  int num_cells() const
+  {
+    return m_num_grid_cells_per_axis*m_num_grid_cells_per_axis*m_num_grid_cells_per_axis;
+  }
+
+  // ID of the calling thread, > 0
+  unsigned int this_thread_id()
   {
-    for( TLS_grid::iterator it_grid = m_tls_grids.begin() ;
-             it_grid != m_tls_grids.end() ;
-             ++it_grid )
+    return m_tls_thread_ids.local();
+  }
+
+  // The grid of the owners of the cells.
+  // It is initialized in parallel, so that its pages are spread among
+  // the memory nodes of the threads (first-touch policy on NUMA systems).
+  class Owner_grid
+  {
+  public:
+    typedef std::atomic<unsigned int> Cell;
+
+    Owner_grid() : m_cells(nullptr) {}
+    explicit Owner_grid(int size) : m_cells(nullptr) { resize(size); }
+    Owner_grid(const Owner_grid&) = delete;
+    Owner_grid& operator=(const Owner_grid&) = delete;
+    ~Owner_grid() { deallocate(); }
+
+    void resize(int size)
     {
-      delete [] *it_grid;
+      deallocate();
+      m_cells = static_cast<Cell*>(::operator new(sizeof(Cell) * std::size_t(size)));
+      Cell* cells = m_cells;
+      tbb::parallel_for(tbb::blocked_range<int>(0, size, 4096),
+                        [cells](const tbb::blocked_range<int>& r)
+      {
+        for (int i = r.begin() ; i != r.end() ; ++i)
+          new (cells + i) Cell(0);
+      });
+    }
+
+    Cell& operator[](int i) { return m_cells[i]; }
+
+  private:
+    void deallocate()
+    {
+      if (m_cells != nullptr)
+        ::operator delete(m_cells);
+      m_cells = nullptr;
     }
-  }
+
+    Cell* m_cells;
+  };
 
   template <typename P3>
   int get_grid_index(const P3& point) const
@@ -412,14 +468,24 @@ protected:
   double                                          m_resolution_y;
   double                                          m_resolution_z;
 
+private:
+  static unsigned int init_TLS_thread_id()
+  {
+    static std::atomic<unsigned int> last_id;
+    unsigned int id = ++last_id;
+    // Ensure it is > 0
+    return (1 + id%((std::numeric_limits<unsigned int>::max)()));
+  }
+
+protected:
   // TLS
   typedef tbb::enumerable_thread_specific<
-    bool*,
-    tbb::cache_aligned_allocator<bool*>,
-    tbb::ets_key_per_instance>                               TLS_grid;
+    unsigned int,
+    tbb::cache_aligned_allocator<unsigned int>,
+    tbb::ets_key_per_instance>                               TLS_thread_ids;
   typedef tbb::enumerable_thread_specific<std::vector<int> > TLS_locked_cells;
 
-  TLS_grid                                        m_tls_grids;
+  TLS_thread_ids                                  m_tls_thread_ids;
   TLS_locked_cells                                m_tls_locked_cells;
 };
 
@@ -447,14 +513,8 @@ public:
   // Constructors
   Spatial_lock_grid_3(const Bbox_3 &bbox, int num_grid_cells_per_axis)
   : Base(bbox, num_grid_cells_per_axis),
-    m_grid(num_grid_cells_per_axis*num_grid_cells_per_axis*num_grid_cells_per_axis)
+    m_grid(num_cells())
   {
-    int num_cells =
-      num_grid_cells_per_axis*num_grid_cells_per_axis*num_grid_cells_per_axis;
-
-    // Initialize grid (useless?)
-    for (int i = 0 ; i < num_cells ; ++i)
-      m_grid[i] = false;
   }
 
   ~Spatial_lock_grid_3()
@@ -463,16 +523,20 @@ public:
 
   bool is_cell_locked_impl(int cell_index)
   {
-    return (m_grid[cell_index] == true);
+    return (m_grid[cell_index] != 0);
+  }
+
+  bool is_cell_locked_by_this_thread_impl(int cell_index)
+  {
+    return (m_grid[cell_index].load(std::memory_order_relaxed) == this_thread_id());
   }
 
   template <bool no_spin>
   bool try_lock_cell_impl(int cell_index)
   {
-    bool v1 = true, v2 = false;
-    if(m_grid[cell_index].compare_exchange_strong(v2,v1))
+    unsigned int old_value = 0;
+    if(m_grid[cell_index].compare_exchange_strong(old_value, this_thread_id()))
     {
-      get_thread_local_grid()[cell_index] = true;
       m_tls_locked_cells.local().push_back(cell_index);
       return true;
     }
@@ -481,12 +545,17 @@ public:
 
   void unlock_cell_impl(int cell_index)
   {
-    m_grid[cell_index] = false;
+    m_grid[cell_index] = 0;
+  }
+
+  void resize_grid_impl(int num_cells)
+  {
+    m_grid.resize(num_cells);
   }
 
 protected:
 
-  std::vector<std::atomic<bool> > m_grid;
+  Owner_grid m_grid;
 };
 
 
@@ -506,14 +575,8 @@ public:
 
   Spatial_lock_grid_3(const Bbox_3 &bbox, int num_grid_cells_per_axis)
   : Base(bbox, num_grid_cells_per_axis),
-    m_grid(num_grid_cells_per_axis*num_grid_cells_per_axis*num_grid_cells_per_axis),
-    m_tls_thread_priorities(init_TLS_thread_priorities)
+    m_grid(num_cells())
   {
-    // Explicitly initialize the atomics
-    std::vector<std::atomic<unsigned int> >::iterator it     = m_grid.begin();
-    std::vector<std::atomic<unsigned int> >::iterator it_end = m_grid.end();
-    for ( ; it != it_end ; ++it)
-      *it = 0;
   }
 
   /// Destructor
@@ -526,10 +589,16 @@ public:
     return (m_grid[cell_index] != 0);
   }
 
+  bool is_cell_locked_by_this_thread_impl(int cell_index)
+  {
+    return (m_grid[cell_index].load(std::memory_order_relaxed) == this_thread_id());
+  }
+
+  // The ID of a thread is also its priority
   template <bool no_spin>
   bool try_lock_cell_impl(int cell_index)
   {
-    unsigned int this_thread_priority = m_tls_thread_priorities.local();
+    unsigned int this_thread_priority = this_thread_id();
 
     // NO SPIN
     if (no_spin)
@@ -537,7 +606,6 @@ public:
       unsigned int old_value = 0;
       if(m_grid[cell_index].compare_exchange_strong(old_value, this_thread_priority))
       {
-        get_thread_local_grid()[cell_index] = true;
         m_tls_locked_cells.local().push_back(cell_index);
         return true;
       }
@@ -550,7 +618,6 @@ public:
         unsigned int old_value =0;
         if(m_grid[cell_index].compare_exchange_weak(old_value, this_thread_priority))
         {
-          get_thread_local_grid()[cell_index] = true;
           m_tls_locked_cells.local().push_back(cell_index);
           return true;
         }
@@ -574,21 +641,14 @@ public:
     m_grid[cell_index] = 0;
   }
 
-private:
-  static unsigned int init_TLS_thread_priorities()
+  void resize_grid_impl(int num_cells)
   {
-    static std::atomic<unsigned int> last_id;
-    unsigned int id = ++last_id;
-    // Ensure it is > 0
-    return (1 + id%((std::numeric_limits<unsigned int>::max)()));
+    m_grid.resize(num_cells);
   }
 
 protected:
 
-  std::vector<std::atomic<unsigned int> >               m_grid;
-
-  typedef tbb::enumerable_thread_specific<unsigned int> TLS_thread_uint_ids;
-  TLS_thread_uint_ids                                   m_tls_thread_priorities;
+  Owner_grid m_grid;
 };
 
 } //namespace CGAL
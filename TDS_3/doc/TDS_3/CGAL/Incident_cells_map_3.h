@@ -0,0 +1,96 @@
+namespace CGAL {
+
+/*!
+\ingroup PkgTDS3Classes
+
+The class `Incident_cells_map_3` stores the cells incident to a set of vertices
+of a 3-dimensional triangulation data structure, contiguously in a single array
+(compressed sparse row layout).
+
+It is meant for algorithms which query the star of the same vertices many times,
+while the triangulation changes only locally between these queries,
+such as mesh optimizers. The stars are computed without marking cells,
+using a small local buffer, which allows building the map in parallel. Once built, the map can be queried concurrently.
+
+The map is not updated automatically when the triangulation data structure is modified.
+If the cells of `TDS` have an erase counter (as `Compact_container` uses),
+`is_up_to_date()` detects the vertices whose star has been modified
+since it was cached, which can then be refreshed with `update()`.
+This relies on the fact that the star of a vertex can only change if one of its cells
+is erased, which holds for insertions and removals of vertices, but not for `TDS::flip()`
+and the functions changing the dimension: the stars of the vertices of the flipped cells must
+then be refreshed explicitly.
+
+\tparam TDS is an instance of `Triangulation_data_structure_3`.
+*/
+template <typename TDS>
+class Incident_cells_map_3
+{
+public:
+/// \name Types
+/// @{
+
+  /// A const random access iterator over `TDS::Cell_handle`.
+  typedef unspecified_type Cell_iterator;
+
+  /// An `Iterator_range` of `Cell_iterator`.
+  typedef Iterator_range<Cell_iterator> Cell_range;
+
+  /// `true` if the cells of `TDS` have an erase counter, `false` otherwise.
+  static constexpr bool Tracks_erased_cells;
+
+/// @}
+
+/// \name Creation
+/// @{
+
+  /// creates an empty map.
+  Incident_cells_map_3();
+
+  /// creates a map storing the stars of all vertices of `tds`, computed in parallel if `ConcurrencyTag`
+  /// is `Parallel_tag`.
+  /// \pre `tds.dimension() == 3`
+  template <typename ConcurrencyTag = Sequential_tag>
+  explicit Incident_cells_map_3(const TDS& tds, ConcurrencyTag tag = ConcurrencyTag());
+
+/// @}
+
+/// \name Operations
+/// @{
+
+  /// clears the map, then stores the stars of all vertices of `tds`,
+  /// computed in parallel if `ConcurrencyTag` is `Parallel_tag`.
+  /// \pre `tds.dimension() == 3`
+  template <typename ConcurrencyTag = Sequential_tag>
+  void build(const TDS& tds, ConcurrencyTag tag = ConcurrencyTag());
+
+  /// computes (again) the stars of the vertices of the range `[first, last)`,
+  /// in parallel if `ConcurrencyTag` is `Parallel_tag`.
+  /// The value type of `InputIterator` is `TDS::Vertex_handle`.
+  /// \pre `tds.dimension() == 3`, and all the vertices are vertices of `tds`.
+  template <typename InputIterator, typename ConcurrencyTag = Sequential_tag>
+  void update(const TDS& tds, InputIterator first, InputIterator last,
+              ConcurrencyTag tag = ConcurrencyTag());
+
+  /// returns whether the star of `v` is stored in the map.
+  bool is_cached(TDS::Vertex_handle v) const;
+
+  /// returns whether the star of `v` is stored in the map, and none of its cells has
+  /// been erased since it was computed, in which case it is still the star of `v`.
+  /// \pre `Tracks_erased_cells` is `true`.
+  bool is_up_to_date(TDS::Vertex_handle v) const;
+
+  /// returns the cells incident to `v` when its star was computed.
+  /// \pre `is_cached(v)`
+  Cell_range incident_cells(TDS::Vertex_handle v) const;
+
+  /// returns the number of vertices whose star is stored.
+  std::size_t number_of_vertices() const;
+
+  /// clears the map.
+  void clear();
+
+/// @}
+};
+
+} // namespace CGAL
@@ -0,0 +1,271 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_INCIDENT_CELLS_MAP_3_H
+#define CGAL_INCIDENT_CELLS_MAP_3_H
+
+#include <CGAL/license/TDS_3.h>
+
+#include <CGAL/assertions.h>
+#include <CGAL/Compact_container.h>
+#include <CGAL/Handle_hash_function.h>
+#include <CGAL/Iterator_range.h>
+#include <CGAL/tags.h>
+
+#include <boost/unordered_map.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/enumerable_thread_specific.h>
+# include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+
+template <typename Tds>
+class Incident_cells_map_3
+{
+public:
+  typedef Tds                                           Triangulation_data_structure;
+  typedef typename Tds::Vertex_handle                   Vertex_handle;
+  typedef typename Tds::Cell_handle                     Cell_handle;
+  typedef std::size_t                                   size_type;
+
+  typedef typename std::vector<Cell_handle>::const_iterator  Cell_iterator;
+  typedef Iterator_range<Cell_iterator>                      Cell_range;
+
+  // `true` if the cells have an erase counter, which is then used
+  // by `is_up_to_date()` to detect outdated stars.
+  static constexpr bool Tracks_erased_cells =
+    internal::has_increment_erase_counter<typename Tds::Cell>::value;
+
+private:
+  typedef internal::Erase_counter_strategy<Tracks_erased_cells>  Erase_counter;
+  typedef std::pair<size_type, size_type>                        Star_range; // offset, size
+  typedef boost::unordered_map<Vertex_handle, Star_range,
+                               Handle_hash_function>             Star_map;
+
+public:
+  Incident_cells_map_3() {}
+
+  template <typename ConcurrencyTag = Sequential_tag>
+  explicit Incident_cells_map_3(const Tds& tds,
+                                ConcurrencyTag tag = ConcurrencyTag())
+  {
+    build(tds, tag);
+  }
+
+  // Computes the stars of all the vertices of `tds`.
+  template <typename ConcurrencyTag = Sequential_tag>
+  void build(const Tds& tds, ConcurrencyTag tag = ConcurrencyTag())
+  {
+    clear();
+    std::vector<Vertex_handle> vertices;
+    vertices.reserve(tds.number_of_vertices());
+    for(Vertex_handle v : tds.vertex_handles())
+      vertices.push_back(v);
+    m_stars.reserve(vertices.size());
+    update(tds, vertices.begin(), vertices.end(), tag);
+  }
+
+  // (Re)computes the stars of the vertices of the range `[first, last)`,
+  // which must be vertices of `tds`.
+  template <typename InputIterator, typename ConcurrencyTag = Sequential_tag>
+  void update(const Tds& tds, InputIterator first, InputIterator last,
+              ConcurrencyTag = ConcurrencyTag())
+  {
+    CGAL_precondition(tds.dimension() == 3);
+
+    std::vector<Vertex_handle> vertices(first, last);
+    std::sort(vertices.begin(), vertices.end());
+    vertices.erase(std::unique(vertices.begin(), vertices.end()), vertices.end());
+
+    const std::size_t n = vertices.size();
+    std::vector<Star_range> ranges(n);
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      // Stars are first gathered in thread-local buffers, then copied
+      // at their final position.
+      typedef tbb::enumerable_thread_specific<std::vector<Cell_handle> > Local_cells;
+      Local_cells local_cells;
+      std::vector<const std::vector<Cell_handle>*> sources(n);
+      std::vector<size_type> local_offsets(n);
+
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        std::vector<Cell_handle>& cells = local_cells.local();
+        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+        {
+          local_offsets[i] = cells.size();
+          tds.incident_cells_3_threadsafe(vertices[i], cells);
+          ranges[i].second = cells.size() - local_offsets[i];
+          sources[i] = &cells;
+        }
+      });
+
+      size_type offset = m_cells.size();
+      for(std::size_t i=0; i<n; ++i)
+      {
+        ranges[i].first = offset;
+        offset += ranges[i].second;
+      }
+      m_cells.resize(offset);
+      if(Tracks_erased_cells)
+        m_erase_counters.resize(offset);
+
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, n),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+        {
+          auto src = sources[i]->begin() + local_offsets[i];
+          std::copy(src, src + ranges[i].second, m_cells.begin() + ranges[i].first);
+          if(Tracks_erased_cells)
+            for(size_type j=ranges[i].first; j<ranges[i].first+ranges[i].second; ++j)
+              m_erase_counters[j] = Erase_counter::erase_counter(*m_cells[j]);
+        }
+      });
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      for(std::size_t i=0; i<n; ++i)
+      {
+        ranges[i].first = m_cells.size();
+        tds.incident_cells_3_threadsafe(vertices[i], m_cells);
+        ranges[i].second = m_cells.size() - ranges[i].first;
+      }
+      if(Tracks_erased_cells)
+      {
+        size_type j = m_erase_counters.size();
+        m_erase_counters.resize(m_cells.size());
+        for(; j<m_cells.size(); ++j)
+          m_erase_counters[j] = Erase_counter::erase_counter(*m_cells[j]);
+      }
+    }
+
+    for(std::size_t i=0; i<n; ++i)
+    {
+      Star_range& range = m_stars[vertices[i]];
+      m_nb_unused_cells += range.second;
+      range = ranges[i];
+    }
+
+    if(2 * m_nb_unused_cells > m_cells.size())
+      compact();
+  }
+
+  // Returns `true` if the star of `v` has been computed.
+  bool is_cached(Vertex_handle v) const
+  {
+    return m_stars.find(v) != m_stars.end();
+  }
+
+  // Returns `true` if the star of `v` has been computed, and if none of
+  // its cells has been erased since then. As erasing a cell is the only way
+  // to modify the star of a vertex, the cached star is then still valid.
+  bool is_up_to_date(Vertex_handle v) const
+  {
+    static_assert(Tracks_erased_cells,
+                  "is_up_to_date() requires cells with an erase counter");
+
+    typename Star_map::const_iterator it = m_stars.find(v);
+    if(it == m_stars.end())
+      return false;
+
+    const Star_range& range = it->second;
+    for(size_type j=range.first; j<range.first+range.second; ++j)
+      if(Erase_counter::erase_counter(*m_cells[j]) != m_erase_counters[j])
+        return false;
+    return true;
+  }
+
+  // Returns the cells incident to `v`, in the same order as
+  // `Tds::incident_cells_threadsafe()` at the time the star was computed.
+  // \pre `is_cached(v)`
+  Cell_range incident_cells(Vertex_handle v) const
+  {
+    typename Star_map::const_iterator it = m_stars.find(v);
+    CGAL_precondition(it != m_stars.end());
+
+    Cell_iterator begin = m_cells.begin() + it->second.first;
+    return Cell_range(begin, begin + it->second.second);
+  }
+
+  size_type number_of_vertices() const { return m_stars.size(); }
+
+  void clear()
+  {
+    m_stars.clear();
+    m_cells.clear();
+    m_erase_counters.clear();
+    m_nb_unused_cells = 0;
+  }
+
+private:
+  // Removes the stars that were replaced by `update()`, as well as the
+  // outdated ones, if they can be detected (e.g. stars of erased vertices)
+  void compact()
+  {
+    std::vector<Cell_handle> cells;
+    std::vector<unsigned int> erase_counters;
+    cells.reserve(m_cells.size() - m_nb_unused_cells);
+    if(Tracks_erased_cells)
+      erase_counters.reserve(cells.capacity());
+
+    for(typename Star_map::iterator it = m_stars.begin(); it != m_stars.end(); )
+    {
+      if constexpr(Tracks_erased_cells) {
+        if(!is_up_to_date(it->first)) {
+          it = m_stars.erase(it);
+          continue;
+        }
+      }
+
+      Star_range& range = (it++)->second;
+      const size_type offset = cells.size();
+      cells.insert(cells.end(), m_cells.begin() + range.first,
+                   m_cells.begin() + range.first + range.second);
+      if(Tracks_erased_cells)
+        erase_counters.insert(erase_counters.end(),
+                              m_erase_counters.begin() + range.first,
+                              m_erase_counters.begin() + range.first + range.second);
+      range.first = offset;
+    }
+
+    m_cells.swap(cells);
+    m_erase_counters.swap(erase_counters);
+    m_nb_unused_cells = 0;
+  }
+
+  Star_map m_stars;
+  // the stars, stored one after the other (CSR layout)
+  std::vector<Cell_handle> m_cells;
+  // the erase counters of the cells of `m_cells` when their star was computed
+  std::vector<unsigned int> m_erase_counters;
+  size_type m_nb_unused_cells = 0;
+};
+
+} // namespace CGAL
+
+#endif // CGAL_INCIDENT_CELLS_MAP_3_H
@@ -23,6 +23,7 @@
 
 #include <CGAL/basic.h>
 
+#include <algorithm>
 #include <utility>
 #include <map>
 #include <set>
@@ -81,6 +82,17 @@ public:
   // than what is exposed by the TDS concept (tds.is_vertex(Vertex_handle)).
   typedef CGAL::Tag_true              Is_CGAL_TDS_3;
 
+  // When `CGAL_TDS_3_THREADSAFE_ADJACENCY_QUERIES` is defined, the adjacency
+  // queries around a vertex (incident cells, facets, edges, adjacent vertices,
+  // degree) never write into the cells or vertices: they use the same
+  // local visited sets as the `_threadsafe` functions, and can therefore be
+  // called concurrently on a triangulation that is not being modified.
+#ifdef CGAL_TDS_3_THREADSAFE_ADJACENCY_QUERIES
+  static constexpr bool Threadsafe_adjacency_queries = true;
+#else
+  static constexpr bool Threadsafe_adjacency_queries = false;
+#endif
+
   // Tools to change the Vertex and Cell types of the TDS.
   template < typename Vb2 >
   struct Rebind_vertex {
@@ -842,10 +854,11 @@ private:
                                boost::container::small_vector<Cell_handle, 128>> found_cells;
     // boost::unordered_set<Cell_handle, Handle_hash_function> found_cells;
 
+    // `cells` might not be empty
+    std::size_t head = cells.size();
+    std::size_t tail = head + 1;
     cells.push_back(d);
     found_cells.insert(d);
-    int head=0;
-    int tail=1;
     do {
       Cell_handle c = cells[head];
 
@@ -1000,6 +1013,9 @@ public:
   template<class Treatment, class OutputIterator, class Filter, bool hasVisited>
   class Vertex_extractor;
 
+  static constexpr bool Use_vertex_visited_flag =
+    internal::Has_member_visited<Vertex>::value && !Threadsafe_adjacency_queries;
+
         // Visitor for visit_incident_cells:
         // outputs the result of Treatment applied to the vertices
   template<class Treatment, class OutputIterator, class Filter>
@@ -1143,6 +1159,12 @@ public:
   void incident_cells_3(Vertex_handle v,
                         std::vector<Cell_handle>& cells) const
   {
+    if constexpr(Threadsafe_adjacency_queries)
+    {
+      incident_cells_3_threadsafe(v, v->cell(), cells, CGAL::Emptyset_iterator());
+      return;
+    }
+
     just_incident_cells_3(v, cells);
     typename std::vector<Cell_handle>::iterator cit,end;
     for(cit = cells.begin(), end = cells.end();
@@ -1153,6 +1175,40 @@ public:
     }
   }
 
+  // Appends the cells incident to `v` to `cells`, in the same order as
+  // `incident_cells_threadsafe()`. Cells are not marked, and nothing is
+  // allocated as long as `cells` (e.g. a `boost::container::small_vector`)
+  // has enough inline capacity: the cells found so far serve as visited set,
+  // until the star becomes too large for linear lookups.
+  template <typename CellsContainer>
+  void incident_cells_3_threadsafe(Vertex_handle v, CellsContainer& cells) const
+  {
+    CGAL_precondition(dimension() == 3);
+
+    const std::size_t first = cells.size();
+    std::size_t head = first;
+    cells.push_back(v->cell());
+    do {
+      Cell_handle c = cells[head];
+
+      for (int i=0; i<4; ++i) {
+        if (c->vertex(i) == v)
+          continue;
+        Cell_handle next = c->neighbor(i);
+        if (std::find(cells.begin() + first, cells.end(), next) != cells.end())
+          continue;
+        if (cells.size() - first == 64) {
+          // restart with a sorted visited set
+          cells.erase(cells.begin() + first, cells.end());
+          incident_cells_3_threadsafe(v, v->cell(), cells, CGAL::Emptyset_iterator());
+          return;
+        }
+        cells.push_back(next);
+      }
+      ++head;
+    } while(head != cells.size());
+  }
+
   template <class Filter, class OutputIterator>
   OutputIterator
   incident_cells_threadsafe(Vertex_handle v, OutputIterator cells, Filter f = Filter()) const
@@ -1237,7 +1293,7 @@ public:
     }
     return visit_incident_cells<Vertex_extractor<Edge_feeder_treatment<OutputIterator>,
                                                  OutputIterator, Filter,
-                                                 internal::Has_member_visited<Vertex>::value>,
+                                                 Use_vertex_visited_flag>,
     OutputIterator>(v, edges, f);
   }
 
@@ -1309,7 +1365,7 @@ public:
     }
     return visit_incident_cells<Vertex_extractor<Vertex_feeder_treatment<OutputIterator>,
                                 OutputIterator, Filter,
-                                internal::Has_member_visited<Vertex>::value>,
+                                Use_vertex_visited_flag>,
     OutputIterator>(v, vertices, f);
   }
 
@@ -1385,6 +1441,9 @@ public:
     if ( dimension() < 2 )
     return output;
 
+    if constexpr(Threadsafe_adjacency_queries)
+      return visit_incident_cells_threadsafe<Visitor>(v, output, f);
+
     Visitor visit(v, output, this, f);
 
     boost::container::small_vector<Cell_handle, 128> tmp_cells;
@@ -1443,6 +1502,18 @@ public:
 
     Visitor visit(v, output, this, f);
 
+    if constexpr(Threadsafe_adjacency_queries)
+    {
+      if ( dimension() == 3 )
+        incident_cells_3_threadsafe(v, v->cell(), cells, visit.facet_it());
+      else
+        incident_cells_2(v, v->cell(), std::back_inserter(cells));
+
+      for(Cell_handle c : cells)
+        visit(c);
+      return visit.result();
+    }
+
     if ( dimension() == 3 )
     incident_cells_3(v, v->cell(), std::make_pair(std::back_inserter(cells), visit.facet_it()));
     else
@@ -1474,6 +1545,18 @@ public:
     std::vector<Cell_handle> tmp_cells;
     tmp_cells.reserve(64);
 
+    if constexpr(Threadsafe_adjacency_queries)
+    {
+      if ( dimension() == 3 )
+        incident_cells_3_threadsafe(v, v->cell(), tmp_cells, CGAL::Emptyset_iterator());
+      else
+        incident_cells_2(v, v->cell(), std::back_inserter(tmp_cells));
+
+      for(Cell_handle c : tmp_cells)
+        visit(c);
+      return visit.result();
+    }
+
     if ( dimension() == 3 )
       just_incident_cells_3(v, tmp_cells);
     else
@@ -1508,7 +1591,7 @@ public:
         Vertex_extractor<Vertex_feeder_treatment<OutputVertexIterator>,
                          OutputVertexIterator,
                          VertexFilter,
-                         internal::Has_member_visited<Vertex>::value>,
+                         Use_vertex_visited_flag>,
         OutputVertexIterator
       >(v, vertices, cells, f);
   }
@@ -1523,6 +1606,7 @@ public:
   }
 
   size_type degree(Vertex_handle v) const;
+  size_type degree_threadsafe(Vertex_handle v) const;
 
   // CHECKING
   bool is_valid(bool verbose = false, int level = 0) const;
@@ -3580,6 +3664,16 @@ degree(Vertex_handle v) const
     return res;
 }
 
+template <class Vb, class Cb, class Ct>
+typename Triangulation_data_structure_3<Vb,Cb,Ct>::size_type
+Triangulation_data_structure_3<Vb,Cb,Ct>::
+degree_threadsafe(Vertex_handle v) const
+{
+    std::size_t res;
+    adjacent_vertices_threadsafe(v, Counting_output_iterator(&res));
+    return res;
+}
+
 template <class Vb, class Cb, class Ct>
 bool
 Triangulation_data_structure_3<Vb,Cb,Ct>::
@@ -1264,16 +1264,20 @@ void collapse_short_edges(C3T3& c3t3,
 
   //collect long edges
   Boost_bimap short_edges;
-  for (const Edge& e : tr.finite_edges())
-  {
-    auto [collapsible, boundary] = can_be_collapsed(e, c3t3, protect_boundaries, cell_selector);
-    if (!collapsible)
-      continue;
+  evaluate_edges<typename T3::Concurrency_tag>(tr.finite_edges(),
+    [&](const Edge& e) -> std::optional<FT>
+    {
+      auto [collapsible, boundary] = can_be_collapsed(e, c3t3, protect_boundaries, cell_selector);
+      if (!collapsible)
+        return std::nullopt;
 
-    const auto sqlen = is_too_short(e, boundary, sizing, c3t3, cell_selector);
-    if(sqlen != std::nullopt)
-      short_edges.insert(short_edge(e, sqlen.value()));
-  }
+      return is_too_short(e, boundary, sizing, c3t3, cell_selector);
+    },
+    [&](const Edge& e, const std::optional<FT>& sqlen)
+    {
+      if(sqlen != std::nullopt)
+        short_edges.insert(short_edge(e, sqlen.value()));
+    });
 
 #ifdef CGAL_TETRAHEDRAL_REMESHING_DEBUG
   debug::dump_edges(short_edges, "short_edges.polylines.txt");
@@ -30,6 +30,16 @@
 #include <boost/container/small_vector.hpp>
 #include <boost/functional/hash.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 #include <cmath>
@@ -51,6 +61,8 @@ class Tetrahedral_remeshing_smoother
   typedef typename Tr::Edge                  Edge;
   typedef typename Tr::Facet                 Facet;
 
+  typedef typename Tr::Concurrency_tag       Concurrency_tag;
+
   typedef typename Tr::Geom_traits           Gt;
   typedef typename Gt::Vector_3              Vector_3;
   typedef typename Gt::Point_3               Point_3;
@@ -584,6 +596,102 @@ private:
     return valid_move;
   }
 
+  // moves the vertices to the positions given by `new_position(v, vid)`,
+  // when it is not `std::nullopt` and the move is valid.
+  // With `Parallel_tag`, the new positions are all computed from
+  // the current positions, then the vertices are moved by independent sets,
+  // such that two vertices moved concurrently never share a cell
+  template<typename NewPosition, typename IncidentCells>
+  std::size_t move_vertices(Tr& tr,
+                            const NewPosition& new_position,
+                            const IncidentCells& inc_cells,
+                            FT& total_move)
+  {
+    std::size_t nb_done = 0;
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    {
+      const std::vector<std::pair<Vertex_handle, std::size_t> >
+        vertices(m_vertex_id.begin(), m_vertex_id.end());
+
+      std::vector<std::optional<Point_3> > new_positions(vertices.size());
+#ifndef CGAL_TETRAHEDRAL_REMESHING_DEBUG // debug output is not thread-safe
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertices.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for (std::size_t i = r.begin(); i != r.end(); ++i)
+          new_positions[i] = new_position(vertices[i].first, vertices[i].second);
+      });
+#else
+      for (std::size_t i = 0; i < vertices.size(); ++i)
+        new_positions[i] = new_position(vertices[i].first, vertices[i].second);
+#endif
+
+      // greedy coloring of the vertices to be moved
+      std::vector<int> colors(m_free_vertices.size(), -1);
+      std::vector<std::vector<std::size_t> > independent_sets;
+      std::vector<bool> used_colors;
+      for (std::size_t i = 0; i < vertices.size(); ++i)
+      {
+        if (new_positions[i] == std::nullopt)
+          continue;
+
+        const std::size_t vid = vertices[i].second;
+        used_colors.assign(independent_sets.size() + 1, false);
+        for (const Cell_handle c : inc_cells[vid])
+        {
+          for (const Vertex_handle vi : tr.vertices(c))
+          {
+            const int ci = colors[vertex_id(vi)];
+            if (ci >= 0)
+              used_colors[ci] = true;
+          }
+        }
+
+        const std::size_t color = std::distance(used_colors.begin(),
+          std::find(used_colors.begin(), used_colors.end(), false));
+        if (color == independent_sets.size())
+          independent_sets.emplace_back();
+        independent_sets[color].push_back(i);
+        colors[vid] = static_cast<int>(color);
+      }
+
+      std::atomic<std::size_t> nb_moved(0);
+      tbb::enumerable_thread_specific<FT> local_total_move(FT(0));
+      for (const std::vector<std::size_t>& independent_set : independent_sets)
+      {
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, independent_set.size()),
+                          [&](const tbb::blocked_range<std::size_t>& r)
+        {
+          std::size_t local_nb_moved = 0;
+          for (std::size_t j = r.begin(); j != r.end(); ++j)
+          {
+            const std::size_t i = independent_set[j];
+            if (check_inversion_and_move(vertices[i].first, *new_positions[i],
+                                         inc_cells[vertices[i].second], tr,
+                                         local_total_move.local()))
+              ++local_nb_moved;
+          }
+          nb_moved += local_nb_moved;
+        });
+      }
+      total_move += local_total_move.combine(std::plus<FT>());
+      return nb_moved;
+    }
+#endif // CGAL_LINKED_WITH_TBB
+
+    // iterate over map of <vertex, id>
+    for (auto [v, vid] : m_vertex_id)
+    {
+      const std::optional<Point_3> new_pos = new_position(v, vid);
+      if (new_pos != std::nullopt
+          && check_inversion_and_move(v, *new_pos, inc_cells[vid], tr, total_move))
+        ++nb_done;
+    }
+    return nb_done;
+  }
+
   void collect_vertices_surface_indices(
     const C3t3& c3t3,
     std::unordered_map<Vertex_handle,
@@ -651,7 +759,6 @@ private:
 #endif
                                )
   {
-    std::size_t nb_done_1d = 0;
     auto& tr = c3t3.triangulation();
 
     const std::size_t nbv = tr.number_of_vertices();
@@ -660,52 +767,58 @@ private:
     std::vector<FT> masses(nbv, 0.);
 
     //collect neighbors
-    for (const Edge& e : c3t3.edges_in_complex())
-    {
-      const Vertex_handle vh0 = e.first->vertex(e.second);
-      const Vertex_handle vh1 = e.first->vertex(e.third);
-
-      CGAL_expensive_assertion(is_on_feature(vh0));
-      CGAL_expensive_assertion(is_on_feature(vh1));
+    evaluate_edges<Concurrency_tag>(c3t3.edges_in_complex(),
+      [&](const Edge& e) -> FT
+      {
+        CGAL_expensive_assertion(is_on_feature(e.first->vertex(e.second)));
+        CGAL_expensive_assertion(is_on_feature(e.first->vertex(e.third)));
+
+        if (!is_free(e.first->vertex(e.second)) && !is_free(e.first->vertex(e.third)))
+          return FT(0);
+        return density_along_segment(e, c3t3, true);
+      },
+      [&](const Edge& e, const FT density)
+      {
+        if (density == FT(0))
+          return;
 
-      const std::size_t& i0 = vertex_id(vh0);
-      const std::size_t& i1 = vertex_id(vh1);
+        const Vertex_handle vh0 = e.first->vertex(e.second);
+        const Vertex_handle vh1 = e.first->vertex(e.third);
 
-      const bool vh0_moving = is_free(i0);
-      const bool vh1_moving = is_free(i1);
+        const std::size_t& i0 = vertex_id(vh0);
+        const std::size_t& i1 = vertex_id(vh1);
 
-      if (!vh0_moving && !vh1_moving)
-        continue;
+        const bool vh0_moving = is_free(i0);
+        const bool vh1_moving = is_free(i1);
 
-      const Point_3& p0 = point(vh0->point());
-      const Point_3& p1 = point(vh1->point());
-      const FT density = density_along_segment(e, c3t3, true);
+        const Point_3& p0 = point(vh0->point());
+        const Point_3& p1 = point(vh1->point());
 
-      if (vh0_moving)
-      {
-        moves[i0] += density * Vector_3(p0, p1);
-        neighbors[i0]++;
-        masses[i0] += density;
-      }
-      if (vh1_moving)
-      {
-        moves[i1] += density * Vector_3(p1, p0);
-        neighbors[i1]++;
-        masses[i1] += density;
-      }
-    }
+        if (vh0_moving)
+        {
+          moves[i0] += density * Vector_3(p0, p1);
+          neighbors[i0]++;
+          masses[i0] += density;
+        }
+        if (vh1_moving)
+        {
+          moves[i1] += density * Vector_3(p1, p0);
+          neighbors[i1]++;
+          masses[i1] += density;
+        }
+      });
 
-    // iterate over map of <vertex, id>
-    for (auto [v, vid] : m_vertex_id)
+    auto new_position = [&](const Vertex_handle v,
+                            const std::size_t vid) -> std::optional<Point_3>
     {
       if (!is_free(vid) || !is_on_feature(v))
-        continue;
+        return std::nullopt;
 
       const Point_3 current_pos = point(v->point());
 
       const std::size_t nb_neighbors = neighbors[vid];
       if(nb_neighbors == 0)
-        continue;
+        return std::nullopt;
 
       CGAL_assertion(masses[vid] > 0);
       const Vector_3 move = (nb_neighbors > 0)
@@ -745,12 +858,11 @@ private:
 #ifdef CGAL_TETRAHEDRAL_REMESHING_DEBUG
       os_surf << "2 " << current_pos << " " << new_pos << std::endl;
 #endif
-      // move vertex
-      if (check_inversion_and_move(v, new_pos, inc_cells[vid], tr, total_move)){
-        nb_done_1d++;
-      }
-    }
-    return nb_done_1d;
+      return new_pos;
+    };
+
+    // move vertices
+    return move_vertices(tr, new_position, inc_cells, total_move);
   }
 
 
@@ -767,7 +879,6 @@ std::size_t smooth_vertices_on_surfaces(C3t3& c3t3,
 #endif
                                )
 {
-  std::size_t nb_done_2d = 0;
   auto& tr = c3t3.triangulation();
 
   const std::size_t nbv = tr.number_of_vertices();
@@ -775,53 +886,60 @@ std::size_t smooth_vertices_on_surfaces(C3t3& c3t3,
   std::vector<int> neighbors(nbv, 0);
   std::vector<FT> masses(nbv, 0.);
 
-  for (const Edge& e : tr.finite_edges())
+  auto is_moving = [&](const Vertex_handle v)
   {
-    if (!c3t3.is_in_complex(e) && is_boundary(c3t3, e, m_cell_selector))
+    return !is_on_feature(v) && is_free(v);
+  };
+
+  evaluate_edges<Concurrency_tag>(tr.finite_edges(),
+    [&](const Edge& e) -> FT
     {
+      if (c3t3.is_in_complex(e) || !is_boundary(c3t3, e, m_cell_selector))
+        return FT(0);
+      if (!is_moving(e.first->vertex(e.second)) && !is_moving(e.first->vertex(e.third)))
+        return FT(0);
+      return density_along_segment(e, c3t3, true);
+    },
+    [&](const Edge& e, const FT density)
+    {
+      if (density == FT(0))
+        return;
+
       const Vertex_handle vh0 = e.first->vertex(e.second);
       const Vertex_handle vh1 = e.first->vertex(e.third);
 
       const std::size_t& i0 = vertex_id(vh0);
       const std::size_t& i1 = vertex_id(vh1);
 
-      const bool vh0_moving = !is_on_feature(vh0) && is_free(i0);
-      const bool vh1_moving = !is_on_feature(vh1) && is_free(i1);
-
-      if (!vh0_moving && !vh1_moving)
-        continue;
-
       const Point_3& p0 = point(vh0->point());
       const Point_3& p1 = point(vh1->point());
-      const FT density = density_along_segment(e, c3t3, true);
 
-      if (vh0_moving)
+      if (is_moving(vh0))
       {
         moves[i0] += density * Vector_3(p0, p1);
         neighbors[i0]++;
         masses[i0] += density;
       }
-      if (vh1_moving)
+      if (is_moving(vh1))
       {
         moves[i1] += density * Vector_3(p1, p0);
         neighbors[i1]++;
         masses[i1] += density;
       }
-    }
-  }
+    });
 
-  // iterate over map of <vertex, id>
-  for (auto [v, vid] : m_vertex_id)
+  auto new_position = [&](const Vertex_handle v,
+                          const std::size_t vid) -> std::optional<Point_3>
   {
     if (!is_free(vid) || v->in_dimension() != 2)
-      continue;
+      return std::nullopt;
 
     const std::size_t nb_neighbors = neighbors[vid];
     const Point_3 current_pos = point(v->point());
 
     const auto& incident_surface_patches = vertices_surface_indices.at(v);
     if (incident_surface_patches.size() > 1)
-      continue;
+      return std::nullopt;
     const Surface_patch_index si = incident_surface_patches[0];
 
     CGAL_assertion(si != Surface_patch_index());
@@ -925,35 +1043,32 @@ std::size_t smooth_vertices_on_surfaces(C3t3& c3t3,
       }
 #endif //CGAL_TET_REMESHING_SMOOTHING_WITH_MLS
 
-      if (check_inversion_and_move(v, new_pos, inc_cells[vid], tr, total_move)){
-        nb_done_2d++;
-      }
 #ifdef CGAL_TETRAHEDRAL_REMESHING_DEBUG
       os_surf << "2 " << current_pos << " " << new_pos << std::endl;
 #endif
+      return new_pos;
     }
     else if (nb_neighbors > 0)
     {
 #ifdef CGAL_TET_REMESHING_SMOOTHING_WITH_MLS
       std::optional<Point_3> mls_proj = project(si, current_pos);
       if (mls_proj == std::nullopt)
-        continue;
+        return std::nullopt;
 
       const Point_3 new_pos = *mls_proj;
 #else // AABB_tree projection
       const Point_3 new_pos = m_segments_aabb_tree.closest_point(current_pos);
 #endif // CGAL_TET_REMESHING_SMOOTHING_WITH_MLS
 
-      if (check_inversion_and_move(v, new_pos, inc_cells[vid], tr, total_move)){
-        nb_done_2d++;
-      }
 #ifdef CGAL_TETRAHEDRAL_REMESHING_DEBUG
         os_surf0 << "2 " << current_pos << " " << new_pos << std::endl;
 #endif
+      return new_pos;
     }
-  }
+    return std::nullopt;
+  };
 
-  return nb_done_2d;
+  return move_vertices(tr, new_position, inc_cells, total_move);
 }
 
 template<typename IncidentCells>
@@ -965,7 +1080,6 @@ std::size_t smooth_internal_vertices(C3t3& c3t3,
 #endif
                                      )
 {
-  std::size_t nb_done_3d = 0;
   auto& tr = c3t3.triangulation();
 
   const std::size_t nbv = tr.number_of_vertices();
@@ -973,66 +1087,67 @@ std::size_t smooth_internal_vertices(C3t3& c3t3,
   std::vector<int> neighbors(nbv, 0);/*for dim 3 vertices, start counting directly from 0*/
   std::vector<FT> masses(nbv, 0.);
 
-  for (const Edge& e : tr.finite_edges())
+  auto is_moving = [&](const Vertex_handle v)
   {
-    if (is_outside(e, c3t3, m_cell_selector))
-      continue;
-    else
+    return c3t3.in_dimension(v) == 3 && is_free(v);
+  };
+
+  evaluate_edges<Concurrency_tag>(tr.finite_edges(),
+    [&](const Edge& e) -> FT
+    {
+      if (is_outside(e, c3t3, m_cell_selector))
+        return FT(0);
+      if (!is_moving(e.first->vertex(e.second)) && !is_moving(e.first->vertex(e.third)))
+        return FT(0);
+      return density_along_segment(e, c3t3);
+    },
+    [&](const Edge& e, const FT density)
     {
+      if (density == FT(0))
+        return;
+
       const Vertex_handle vh0 = e.first->vertex(e.second);
       const Vertex_handle vh1 = e.first->vertex(e.third);
 
       const std::size_t& i0 = vertex_id(vh0);
       const std::size_t& i1 = vertex_id(vh1);
 
-      const bool vh0_moving = (c3t3.in_dimension(vh0) == 3 && is_free(i0));
-      const bool vh1_moving = (c3t3.in_dimension(vh1) == 3 && is_free(i1));
-
-      if (!vh0_moving && !vh1_moving)
-        continue;
-
       const Point_3& p0 = point(vh0->point());
       const Point_3& p1 = point(vh1->point());
-      const FT density = density_along_segment(e, c3t3);
 
-      if (vh0_moving)
+      if (is_moving(vh0))
       {
         moves[i0] += density * Vector_3(p0, p1);
         neighbors[i0]++;
         masses[i0] += density;
       }
-      if (vh1_moving)
+      if (is_moving(vh1))
       {
         moves[i1] += density * Vector_3(p1, p0);
         neighbors[i1]++;
         masses[i1] += density;
       }
-    }
-  }
+    });
 
-  // iterate over map of <vertex, id>
-  for (auto [v, vid] : m_vertex_id)
+  auto new_position = [&](const Vertex_handle v,
+                          const std::size_t vid) -> std::optional<Point_3>
   {
     if (!is_free(vid))
-      continue;
+      return std::nullopt;
 
     if (c3t3.in_dimension(v) == 3 && neighbors[vid] > 1)
     {
-#ifdef CGAL_TETRAHEDRAL_REMESHING_DEBUG
-      os_vol << "2 " << point(v->point());
-#endif
       const Vector_3 move = moves[vid] / masses[vid];// static_cast<FT>(neighbors[vid]);
       Point_3 new_pos = point(v->point()) + move;
-      if (check_inversion_and_move(v, new_pos, inc_cells[vid], tr, total_move)){
-        nb_done_3d++;
-      }
-
 #ifdef CGAL_TETRAHEDRAL_REMESHING_DEBUG
-      os_vol << " " << point(v->point()) << std::endl;
+      os_vol << "2 " << point(v->point()) << " " << new_pos << std::endl;
 #endif
+      return new_pos;
     }
-  }
-  return nb_done_3d;
+    return std::nullopt;
+  };
+
+  return move_vertices(tr, new_position, inc_cells, total_move);
 }
 
 public:
@@ -297,16 +297,20 @@ void split_long_edges(C3T3& c3t3,
   //collect long edges
   T3& tr = c3t3.triangulation();
   Boost_bimap long_edges;
-  for (Edge e : tr.finite_edges())
-  {
-    auto [splittable, boundary] = can_be_split(e, c3t3, protect_boundaries, cell_selector);
-    if (!splittable)
-      continue;
+  evaluate_edges<typename T3::Concurrency_tag>(tr.finite_edges(),
+    [&](const Edge& e) -> std::optional<FT>
+    {
+      auto [splittable, boundary] = can_be_split(e, c3t3, protect_boundaries, cell_selector);
+      if (!splittable)
+        return std::nullopt;
 
-    const std::optional<FT> sqlen = is_too_long(e, boundary, sizing, c3t3, cell_selector);
-    if(sqlen != std::nullopt)
-      long_edges.insert(long_edge(make_vertex_pair(e), sqlen.value()));
-  }
+      return is_too_long(e, boundary, sizing, c3t3, cell_selector);
+    },
+    [&](const Edge& e, const std::optional<FT>& sqlen)
+    {
+      if(sqlen != std::nullopt)
+        long_edges.insert(long_edge(make_vertex_pair(e), sqlen.value()));
+    });
 
 #ifdef CGAL_TETRAHEDRAL_REMESHING_DEBUG
   debug::dump_edges(long_edges, "long_edges.polylines.txt");
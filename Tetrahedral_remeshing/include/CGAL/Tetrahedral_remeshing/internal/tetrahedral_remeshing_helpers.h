@@ -28,11 +28,20 @@
 
 #include <CGAL/IO/File_binary_mesh_3.h>
 
+#include <CGAL/tags.h>
+
 #include <boost/container/flat_set.hpp>
 #include <boost/container/small_vector.hpp>
 #include <boost/bimap.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <optional>
+#include <type_traits>
+#include <vector>
 
 namespace CGAL
 {
@@ -1260,22 +1269,60 @@ typename Gt::Vector_3 normal(const Facet& f, const Gt& gt)
   return gt.construct_scaled_vector_3_object()(n, FT(1) / FT(2));
 }
 
+// calls `insert(e, evaluate(e))` for all edges `e` of `edges`,
+// following the order of the range.
+// With `Parallel_tag`, the calls to `evaluate`, that must not modify
+// the triangulation, are made in parallel, and `insert` is then called
+// sequentially
+template<typename ConcurrencyTag, typename EdgeRange,
+         typename Evaluate, typename Insert>
+void evaluate_edges(const EdgeRange& edges,
+                    const Evaluate& evaluate,
+                    const Insert& insert)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+  {
+    using Edge = std::decay_t<decltype(*edges.begin())>;
+    using Value = std::decay_t<decltype(evaluate(std::declval<const Edge&>()))>;
+
+    const std::vector<Edge> edges_vector(edges.begin(), edges.end());
+    std::vector<Value> values(edges_vector.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, edges_vector.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+                      {
+                        for (std::size_t i = r.begin(); i != r.end(); ++i)
+                          values[i] = evaluate(edges_vector[i]);
+                      });
+
+    for (std::size_t i = 0; i < edges_vector.size(); ++i)
+      insert(edges_vector[i], values[i]);
+    return;
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
+  for (const auto& e : edges)
+    insert(e, evaluate(e));
+}
+
 template<typename C3t3, typename CellSelector, typename OutputIterator>
 OutputIterator get_internal_edges(const C3t3& c3t3,
                                   CellSelector cell_selector,
                                   OutputIterator oit)/*holds Edges*/
 {
-  for (typename C3t3::Triangulation::Finite_edges_iterator
-       eit = c3t3.triangulation().finite_edges_begin();
-       eit != c3t3.triangulation().finite_edges_end();
-       ++eit)
-  {
-    const typename C3t3::Edge& e = *eit;
-    if (is_internal(e, c3t3, cell_selector))
+  using Edge = typename C3t3::Edge;
+  using Concurrency_tag = typename C3t3::Triangulation::Concurrency_tag;
+
+  evaluate_edges<Concurrency_tag>(c3t3.triangulation().finite_edges(),
+    [&](const Edge& e) { return is_internal(e, c3t3, cell_selector); },
+    [&](const Edge& e, const bool internal)
     {
-      *oit++ = make_vertex_pair(e);
-    }
-  }
+      if (internal)
+        *oit++ = make_vertex_pair(e);
+    });
   return oit;
 }
 
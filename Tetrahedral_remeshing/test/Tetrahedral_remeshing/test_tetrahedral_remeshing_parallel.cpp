@@ -0,0 +1,84 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Tetrahedral_remeshing/Remeshing_triangulation_3.h>
+#include <CGAL/tetrahedral_remeshing.h>
+
+#include <CGAL/Random.h>
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+// Remeshes the same input with `Sequential_tag` and with `Parallel_tag`,
+// and checks that both outputs are valid and preserve the subdomains
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+typedef CGAL::Tetrahedral_remeshing::Remeshing_triangulation_3<K> Sequential_triangulation;
+typedef CGAL::Tetrahedral_remeshing::Remeshing_triangulation_3<K, Concurrency_tag>
+  Parallel_triangulation;
+
+template<typename Tr>
+void generate_input_two_subdomains(const std::vector<K::Point_3>& points, Tr& tr)
+{
+  tr.insert(points.begin(), points.end());
+
+  for (typename Tr::Cell_handle c : tr.finite_cell_handles())
+  {
+    const K::Point_3 p = CGAL::centroid(c->vertex(0)->point(), c->vertex(1)->point(),
+                                        c->vertex(2)->point(), c->vertex(3)->point());
+    c->set_subdomain_index(p.x() > 0 ? 1 : 2);
+  }
+}
+
+template<typename Tr>
+std::size_t remesh_and_check(const std::vector<K::Point_3>& points)
+{
+  Tr tr;
+  generate_input_two_subdomains(points, tr);
+
+  CGAL::tetrahedral_isotropic_remeshing(tr, 0.2,
+    CGAL::parameters::number_of_iterations(3));
+
+  assert(tr.is_valid());
+
+  std::size_t nb_cells[2] = {0, 0};
+  for (typename Tr::Cell_handle c : tr.finite_cell_handles())
+  {
+    assert(CGAL::POSITIVE == CGAL::orientation(c->vertex(0)->point(),
+                                               c->vertex(1)->point(),
+                                               c->vertex(2)->point(),
+                                               c->vertex(3)->point()));
+    if (c->subdomain_index() != 0)
+      ++nb_cells[c->subdomain_index() - 1];
+  }
+  assert(nb_cells[0] > 0 && nb_cells[1] > 0);
+
+  std::cout << tr.number_of_vertices() << " vertices, "
+            << nb_cells[0] + nb_cells[1] << " cells" << std::endl;
+  return tr.number_of_vertices();
+}
+
+int main()
+{
+  CGAL::Random rng(0);
+
+  std::vector<K::Point_3> points;
+  for (int i = 0; i < 500; ++i)
+    points.emplace_back(rng.get_double(-1., 1.), rng.get_double(-1., 1.), rng.get_double(-1., 1.));
+
+  // the vertices are not smoothed in the same order,
+  // but the outputs are similar
+  const std::size_t nbv_seq = remesh_and_check<Sequential_triangulation>(points);
+  const std::size_t nbv_par = remesh_and_check<Parallel_triangulation>(points);
+  assert(10 * nbv_par > 9 * nbv_seq && 10 * nbv_par < 11 * nbv_seq);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -108,21 +108,26 @@ void go(
   }
 }
 
+// The dimension (2 to 12) can be given on the command line, for example
+// `delaunay 5` to measure the static filters of Epick_d in dimension 5.
 int main(int argc, char **argv)
 {
   srand(static_cast<unsigned int>(time(NULL)));
-  //int N = 100; if( argc > 1 ) N = atoi(argv[1]);
-  go<2>(5000000);
-  //go<3>(1000000);
-  //go<4>(300000);
-  //go<5>(50000);
-  //go<6>(5000);
-  //go<7>(1000);
-  //go<8>(300);
-  //go<9>(100);
-  //go<10>(30);
-  //go<11>(20);
-  //go<12>(15);
+  const int D = (argc > 1) ? atoi(argv[1]) : 2;
+  switch(D)
+  {
+    case 3: go<3>(1000000); break;
+    case 4: go<4>(300000); break;
+    case 5: go<5>(50000); break;
+    case 6: go<6>(5000); break;
+    case 7: go<7>(1000); break;
+    case 8: go<8>(300); break;
+    case 9: go<9>(100); break;
+    case 10: go<10>(30); break;
+    case 11: go<11>(20); break;
+    case 12: go<12>(15); break;
+    default: go<2>(5000000);
+  }
 
   return 0;
 }
@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <utility>
 #include <iostream>
+#include <tuple>
+#include <type_traits>
 
 #include <CGAL/iterator.h>
 #include <CGAL/function_objects.h>
@@ -57,6 +59,12 @@
 #include <CGAL/determinant.h>
 #endif // no CGAL_NO_STRUCTURAL_FILTERING
 
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/enumerable_thread_specific.h>
+# include <tbb/parallel_for.h>
+#endif
+
 namespace CGAL {
 template < class Gt, class Tds > class Triangulation_2;
 template < class Gt, class Tds > std::istream& operator>>
@@ -541,6 +549,65 @@ public:
 
 #endif // no CGAL_NO_STRUCTURAL_FILTERING
 
+  // Locates all the points of the range [first, last) and writes, in the order of the range,
+  // the tuples (f, lt, li) that `locate(p, lt, li)` would give for each point.
+  // The queries are spatially sorted and each thread walks from the result of
+  // its previous query. The triangulation must not be modified concurrently.
+  template <class InputIterator, class OutputIterator, class ConcurrencyTag = Sequential_tag>
+  OutputIterator
+  locate(InputIterator first, InputIterator last,
+         OutputIterator out,
+         ConcurrencyTag = ConcurrencyTag()) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    typedef std::tuple<Face_handle, Locate_type, int>             Located_point;
+
+    const std::vector<Point> points(first, last);
+    std::vector<std::size_t> indices(points.size());
+    for(std::size_t i=0; i<indices.size(); ++i)
+      indices[i] = i;
+
+    typedef typename Pointer_property_map<Point>::const_type Pmap;
+    typedef Spatial_sort_traits_adapter_2<Geom_traits, Pmap> Search_traits;
+    spatial_sort<ConcurrencyTag>(indices.begin(), indices.end(),
+                                 Search_traits(make_property_map(points), geom_traits()));
+
+    std::vector<Located_point> results(points.size());
+    auto locate_one = [&](std::size_t i, Face_handle& hint)
+    {
+      Locate_type lt;
+      int li = -1;
+      hint = locate(points[indices[i]], lt, li, hint);
+      results[indices[i]] = Located_point(hint, lt, li);
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::enumerable_thread_specific<Face_handle> tls_hint;
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, indices.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          Face_handle& hint = tls_hint.local();
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                            locate_one(i, hint);
+                        });
+    }
+    else
+#endif
+    {
+      Face_handle hint;
+      for(std::size_t i=0; i<indices.size(); ++i)
+        locate_one(i, hint);
+    }
+
+    return std::copy(results.begin(), results.end(), out);
+  }
+
   //TRAVERSING : ITERATORS AND CIRCULATORS
   Finite_faces_iterator finite_faces_begin() const;
   Finite_faces_iterator finite_faces_end() const;
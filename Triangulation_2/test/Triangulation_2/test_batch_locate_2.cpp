@@ -0,0 +1,73 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_2                                               Point;
+
+template <typename Tr, typename Tag>
+void check(const Tr& tr, const std::vector<Point>& queries)
+{
+  typedef std::tuple<typename Tr::Face_handle, typename Tr::Locate_type, int> Located_point;
+
+  std::vector<Located_point> res;
+  tr.locate(queries.begin(), queries.end(), std::back_inserter(res), Tag());
+  assert(res.size() == queries.size());
+
+  for(std::size_t i=0; i<queries.size(); ++i)
+  {
+    typename Tr::Locate_type lt;
+    int li;
+    typename Tr::Face_handle f = tr.locate(queries[i], lt, li);
+    assert(std::get<1>(res[i]) == lt);
+
+    typename Tr::Face_handle g = std::get<0>(res[i]);
+    if(lt == Tr::FACE)
+      assert(g == f);
+    else if(lt == Tr::VERTEX)
+      assert(g->vertex(std::get<2>(res[i])) == f->vertex(li));
+    else if(lt == Tr::EDGE)
+      assert(tr.is_edge(g->vertex(tr.ccw(std::get<2>(res[i]))), g->vertex(tr.cw(std::get<2>(res[i])))));
+    else if(lt == Tr::OUTSIDE_CONVEX_HULL)
+      assert(tr.is_infinite(g));
+  }
+}
+
+template <typename Tr>
+void test(const std::vector<Point>& points, const std::vector<Point>& queries)
+{
+  Tr tr;
+  tr.insert(points.begin(), points.end());
+  check<Tr, CGAL::Sequential_tag>(tr, queries);
+#ifdef CGAL_LINKED_WITH_TBB
+  check<Tr, CGAL::Parallel_tag>(tr, queries);
+#endif
+}
+
+int main()
+{
+  CGAL::get_default_random() = CGAL::Random(0);
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_disc_2<Point> gen(1.);
+  std::copy_n(gen, 5000, std::back_inserter(points));
+
+  std::vector<Point> queries;
+  CGAL::Random_points_in_square_2<Point> qgen(1.2);
+  std::copy_n(qgen, 20000, std::back_inserter(queries));
+  queries.insert(queries.end(), points.begin(), points.begin() + 100);
+
+  test<CGAL::Delaunay_triangulation_2<K> >(points, queries);
+  test<CGAL::Constrained_Delaunay_triangulation_2<K> >(points, queries);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
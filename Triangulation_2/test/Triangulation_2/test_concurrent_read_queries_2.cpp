@@ -0,0 +1,86 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Random.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_2                                               Point;
+typedef CGAL::Delaunay_triangulation_2<K>                        DT;
+typedef DT::Vertex_handle                                        Vertex_handle;
+typedef DT::Face_handle                                          Face_handle;
+
+struct Vertex_queries
+{
+  std::vector<Face_handle> faces;
+  std::vector<Vertex_handle> vertices;
+  std::size_t nb_edges = 0;
+  std::size_t degree = 0;
+
+  bool operator==(const Vertex_queries& other) const
+  {
+    return faces == other.faces && vertices == other.vertices &&
+           nb_edges == other.nb_edges && degree == other.degree;
+  }
+};
+
+Vertex_queries query(const DT& dt, Vertex_handle v)
+{
+  Vertex_queries q;
+  DT::Face_circulator fc = dt.incident_faces(v), fdone(fc);
+  do { q.faces.push_back(fc); } while(++fc != fdone);
+  DT::Vertex_circulator vc = dt.incident_vertices(v), vdone(vc);
+  do { q.vertices.push_back(vc); } while(++vc != vdone);
+  DT::Edge_circulator ec = dt.incident_edges(v), edone(ec);
+  do { ++q.nb_edges; } while(++ec != edone);
+  q.degree = dt.degree(v);
+  return q;
+}
+
+int main()
+{
+  CGAL::get_default_random() = CGAL::Random(0);
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_disc_2<Point> gen(1.);
+  std::copy_n(gen, 10000, std::back_inserter(points));
+  DT dt(points.begin(), points.end());
+  assert(dt.is_valid());
+
+  std::vector<Vertex_handle> vertices(dt.all_vertex_handles().begin(),
+                                      dt.all_vertex_handles().end());
+
+  std::vector<Vertex_queries> ref(vertices.size());
+  for(std::size_t i=0; i<vertices.size(); ++i)
+  {
+    ref[i] = query(dt, vertices[i]);
+    assert(ref[i].degree == ref[i].vertices.size());
+    assert(ref[i].degree == ref[i].faces.size());
+    assert(ref[i].degree == ref[i].nb_edges);
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::vector<Vertex_queries> res(vertices.size());
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertices.size()),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+  {
+    for(std::size_t i=r.begin(); i!=r.end(); ++i)
+      res[i] = query(dt, vertices[i]);
+  });
+
+  for(std::size_t i=0; i<vertices.size(); ++i)
+    assert(res[i] == ref[i]);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
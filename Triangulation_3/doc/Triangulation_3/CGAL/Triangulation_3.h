@@ -776,6 +776,25 @@ locate(const Point & query, Locate_type & lt,
 int & li, int & lj, Vertex_handle hint,
 bool *could_lock_zone = nullptr) const;
 
+/*!
+Locates all the points of the range `[first, last)` and writes to `out`, in the
+order of the range, a tuple `std::tuple<Cell_handle, Locate_type, int, int>`
+holding the same cell, locate type and indices as `locate(query, lt, li, lj)` for each point.
+
+The queries are spatially sorted before being located, and each walk starts
+from the result of the previous query handled by the same thread.
+If `ConcurrencyTag` is `Parallel_tag`, the queries are located in parallel
+(this requires \ref thirdpartyTBB). The triangulation must not be modified during the call.
+
+\tparam InputIterator must be an input iterator with value type `Point`.
+\tparam OutputIterator must be an output iterator accepting `std::tuple<Cell_handle, Locate_type, int, int>`.
+\tparam ConcurrencyTag enables sequential versus parallel algorithm. Possible values are `Sequential_tag` and `Parallel_tag`.
+*/
+template <class InputIterator, class OutputIterator, class ConcurrencyTag = Sequential_tag>
+OutputIterator
+locate(InputIterator first, InputIterator last, OutputIterator out,
+       ConcurrencyTag tag = ConcurrencyTag()) const;
+
 
 /*!
 Returns a value indicating on which side of the oriented boundary
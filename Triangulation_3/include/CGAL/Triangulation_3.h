@@ -66,6 +66,9 @@
 
 #ifdef CGAL_LINKED_WITH_TBB
 # include <tbb/scalable_allocator.h>
+# include <tbb/blocked_range.h>
+# include <tbb/enumerable_thread_specific.h>
+# include <tbb/parallel_for.h>
 #endif
 
 #include <iostream>
@@ -76,6 +79,8 @@
 #include <utility>
 #include <stack>
 #include <array>
+#include <tuple>
+#include <type_traits>
 
 #define CGAL_TRIANGULATION_3_USE_THE_4_POINTS_CONSTRUCTOR
 
@@ -1046,6 +1051,64 @@ public:
                   could_lock_zone);
   }
 
+  // Locates all the points of the range [first, last) and writes, in the order of the range,
+  // the tuples (c, lt, li, lj) that `locate(p, lt, li, lj)` would give for each point.
+  // The queries are spatially sorted and each thread walks from the result of
+  // its previous query. The triangulation must not be modified concurrently.
+  template <class InputIterator, class OutputIterator, class ConcurrencyTag = Sequential_tag>
+  OutputIterator locate(InputIterator first, InputIterator last,
+                        OutputIterator out,
+                        ConcurrencyTag = ConcurrencyTag()) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    typedef std::tuple<Cell_handle, Locate_type, int, int>        Located_point;
+
+    const std::vector<Point> points(first, last);
+    std::vector<std::size_t> indices(points.size());
+    for(std::size_t i=0; i<indices.size(); ++i)
+      indices[i] = i;
+
+    typedef typename Pointer_property_map<Point>::const_type Pmap;
+    typedef Spatial_sort_traits_adapter_3<Geom_traits, Pmap> Search_traits;
+    spatial_sort<ConcurrencyTag>(indices.begin(), indices.end(),
+                                 Search_traits(make_property_map(points), geom_traits()));
+
+    std::vector<Located_point> results(points.size());
+    auto locate_one = [&](std::size_t i, Cell_handle& hint)
+    {
+      Locate_type lt;
+      int li = -1, lj = -1;
+      hint = locate(points[indices[i]], lt, li, lj, hint);
+      results[indices[i]] = Located_point(hint, lt, li, lj);
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::enumerable_thread_specific<Cell_handle> tls_hint;
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, indices.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          Cell_handle& hint = tls_hint.local();
+                          for(std::size_t i=r.begin(); i!=r.end(); ++i)
+                            locate_one(i, hint);
+                        });
+    }
+    else
+#endif
+    {
+      Cell_handle hint;
+      for(std::size_t i=0; i<indices.size(); ++i)
+        locate_one(i, hint);
+    }
+
+    return std::copy(results.begin(), results.end(), out);
+  }
+
   // PREDICATES ON POINTS ``TEMPLATED'' by the geom traits
   Bounded_side side_of_tetrahedron(const Point& p,
                                    const Point& p0, const Point& p1,
@@ -2157,6 +2220,15 @@ public:
     return _tds.incident_cells(v, cells, Finite_filter(this));
   }
 
+  template <class OutputIterator>
+  OutputIterator finite_incident_cells_threadsafe(Vertex_handle v, OutputIterator cells) const
+  {
+    if(dimension() == 2)
+      return _tds.incident_cells_threadsafe(v, cells, Finite_filter_2D(this));
+
+    return _tds.incident_cells_threadsafe(v, cells, Finite_filter(this));
+  }
+
   template <class OutputIterator>
   OutputIterator incident_facets(Vertex_handle v, OutputIterator facets) const
   {
@@ -2224,6 +2296,12 @@ public:
     return _tds.adjacent_vertices(v, vertices, Finite_filter(this));
   }
 
+  template <class OutputIterator>
+  OutputIterator finite_adjacent_vertices_threadsafe(Vertex_handle v, OutputIterator vertices) const
+  {
+    return _tds.adjacent_vertices_threadsafe(v, vertices, Finite_filter(this));
+  }
+
   template <class OutputIterator>
   OutputIterator incident_edges(Vertex_handle v, OutputIterator edges) const
   {
@@ -2318,6 +2396,11 @@ public:
     return _tds.degree(v);
   }
 
+  size_type degree_threadsafe(Vertex_handle v) const
+  {
+    return _tds.degree_threadsafe(v);
+  }
+
   // CHECKING
   bool is_valid(bool verbose = false, int level = 0) const;
   bool is_valid(Cell_handle c, bool verbose = false, int level = 0) const;
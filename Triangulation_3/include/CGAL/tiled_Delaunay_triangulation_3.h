@@ -0,0 +1,571 @@
+// Copyright (c) 2026  GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     :
+
+#ifndef CGAL_TILED_DELAUNAY_TRIANGULATION_3_H
+#define CGAL_TILED_DELAUNAY_TRIANGULATION_3_H
+
+#include <CGAL/license/Triangulation_3.h>
+
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/Cartesian_converter.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/assertions.h>
+
+#include <boost/unordered_map.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace internal {
+
+// Regular grid of tiles over the bounding box of the input points.
+// Each point is assigned to the tile given by a monotone function of its
+// coordinates, so that for each axis and each slab index `s` the points of
+// the slabs `< s` (resp. `> s`) are bounded from above (resp. below) by the
+// exact coordinates recorded in `prefix_max` (resp. `suffix_min`).
+struct Tile_grid_3
+{
+  std::size_t n;
+  std::array<double, 3> origin;
+  std::array<double, 3> step;
+  std::array<double, 3> lo, hi; // exact bounding box of the input
+
+  // prefix_max[a][s] = max coordinate along `a` of the points in slabs [0, s)
+  // suffix_min[a][s] = min coordinate along `a` of the points in slabs [s, n)
+  std::array<std::vector<double>, 3> prefix_max, suffix_min;
+
+  std::size_t slab(int a, double x) const
+  {
+    if(step[a] == 0.)
+      return 0;
+    const double s = std::floor((x - origin[a]) / step[a]);
+    if(s < 0.) return 0;
+    return (std::min)(static_cast<std::size_t>(s), n - 1);
+  }
+
+  std::size_t tile(std::size_t i, std::size_t j, std::size_t k) const
+  {
+    return (i * n + j) * n + k;
+  }
+};
+
+// A box of tiles [ilo[a], ihi[a]] along each axis `a`.
+struct Tile_region_3
+{
+  std::array<std::size_t, 3> ilo, ihi;
+
+  bool covers_slab_range(const Tile_grid_3& g, int a, bool lower) const
+  {
+    return lower ? (ilo[a] == 0) : (ihi[a] == g.n - 1);
+  }
+
+  bool is_whole_grid(const Tile_grid_3& g) const
+  {
+    for(int a=0; a<3; ++a)
+      if(ilo[a] != 0 || ihi[a] != g.n - 1)
+        return false;
+    return true;
+  }
+};
+
+// Certifies that a cell of a triangulation of the points of a tile region
+// is also a cell of the Delaunay triangulation of the whole input, that is
+// that no point outside of the region can conflict with it.
+template <typename Gt>
+class Tiled_cell_certifier_3
+{
+  typedef typename Gt::Point_3                                   Point_3;
+  typedef Simple_cartesian<Interval_nt_advanced>                 IK;
+  typedef Cartesian_converter<Gt, IK>                            To_interval;
+
+  const Tile_grid_3& grid;
+  const Gt& gt;
+
+public:
+  Tiled_cell_certifier_3(const Tile_grid_3& grid, const Gt& gt)
+    : grid(grid), gt(gt)
+  { }
+
+  // returns `true` if the closed circumscribing ball of `p0, p1, p2, p3`
+  // certainly contains no input point outside of `r`
+  bool finite_cell(const Point_3& p0, const Point_3& p1,
+                   const Point_3& p2, const Point_3& p3,
+                   const Tile_region_3& r) const
+  {
+    Protect_FPU_rounding<true> protection;
+    To_interval to_interval;
+
+    const typename IK::Point_3 ip0 = to_interval(p0), ip1 = to_interval(p1),
+                               ip2 = to_interval(p2), ip3 = to_interval(p3);
+    typename IK::Point_3 c;
+    try
+    {
+      c = IK().construct_circumcenter_3_object()(ip0, ip1, ip2, ip3);
+    }
+    catch(Uncertain_conversion_exception&)
+    {
+      return false;
+    }
+
+    const Interval_nt_advanced r2 = squared_distance(c, ip0);
+    for(int a=0; a<3; ++a)
+    {
+      const Interval_nt_advanced ca = c.cartesian(a);
+      if(!r.covers_slab_range(grid, a, true /*lower*/))
+      {
+        const Interval_nt_advanced d = ca - grid.prefix_max[a][r.ilo[a]];
+        if(!(d.inf() > 0) || !(square(d).inf() > r2.sup()))
+          return false;
+      }
+      if(!r.covers_slab_range(grid, a, false /*upper*/))
+      {
+        const Interval_nt_advanced d = grid.suffix_min[a][r.ihi[a] + 1] - ca;
+        if(!(d.inf() > 0) || !(square(d).inf() > r2.sup()))
+          return false;
+      }
+    }
+    return true;
+  }
+
+  // returns `true` if no input point outside of `r` lies in the closed
+  // halfspace bounded by the plane through `p0, p1, p2` and that does not
+  // contain `inner`, that is if the facet is a facet of the global convex hull
+  bool hull_facet(const Point_3& p0, const Point_3& p1, const Point_3& p2,
+                  const Point_3& inner, const Tile_region_3& r) const
+  {
+    typename Gt::Orientation_3 orientation = gt.orientation_3_object();
+    typename Gt::Construct_point_3 cp = gt.construct_point_3_object();
+
+    const Orientation inner_side = orientation(p0, p1, p2, inner);
+    CGAL_assertion(inner_side != COPLANAR);
+
+    // the points outside of `r` lie in the union of at most six boxes
+    for(int a=0; a<3; ++a)
+    {
+      for(int side=0; side<2; ++side)
+      {
+        if(r.covers_slab_range(grid, a, side == 0))
+          continue;
+
+        std::array<double, 3> blo = grid.lo, bhi = grid.hi;
+        if(side == 0)
+          bhi[a] = grid.prefix_max[a][r.ilo[a]];
+        else
+          blo[a] = grid.suffix_min[a][r.ihi[a] + 1];
+
+        for(int corner=0; corner<8; ++corner)
+        {
+          const Point_3 q = cp((corner & 1) ? bhi[0] : blo[0],
+                               (corner & 2) ? bhi[1] : blo[1],
+                               (corner & 4) ? bhi[2] : blo[2]);
+          if(orientation(p0, p1, p2, q) != inner_side)
+            return false;
+        }
+      }
+    }
+    return true;
+  }
+};
+
+} // namespace internal
+
+/*!
+ * \ingroup PkgTriangulation3Functions
+ *
+ * computes the finite cells of the Delaunay triangulation of `points` tile by tile,
+ * so that only the points of a tile and of a few rings of neighboring tiles
+ * are held in a triangulation at any time.
+ *
+ * The bounding box of `points` is partitioned into a regular grid of tiles.
+ * For each tile, a local Delaunay triangulation of the points of the tile and of the
+ * surrounding rings of tiles is built with `Delaunay_triangulation_3`,
+ * and the stars of the vertices of the tile are checked to be stable, that is to say
+ * that no input point outside of the tiles already inserted can conflict
+ * with their cells. The local triangulation is grown ring by ring
+ * until all the stars of the tile are stable.
+ * Stable stars are then cells of the Delaunay triangulation of the whole
+ * input and are streamed to `out` as soon as they are certified.
+ *
+ * Each finite cell of the Delaunay triangulation of `points` is reported exactly once,
+ * as a positively oriented array of four indices in `points`.
+ * The cells are reported tile by tile, which makes `out` suitable to write
+ * the cells directly to disk. `merge_tiled_Delaunay_cells_3()` can be used
+ * to assemble the global triangulation from the cells.
+ *
+ * @tparam PointRange a model of `RandomAccessRange` whose value type is `Gt::Point_3`
+ * @tparam OutputIterator an output iterator accepting `std::array<std::size_t, 4>`
+ * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+ *
+ * @param points the input points
+ * @param out the output iterator receiving the finite cells
+ * @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+ *
+ * \cgalNamedParamsBegin
+ *   \cgalParamNBegin{number_of_tiles_per_side}
+ *     \cgalParamDescription{the number of tiles along each axis of the bounding box}
+ *     \cgalParamType{`std::size_t`}
+ *     \cgalParamDefault{chosen so that each tile contains about 100,000 points on average}
+ *   \cgalParamNEnd
+ *   \cgalParamNBegin{geom_traits}
+ *     \cgalParamDescription{an instance of a geometric traits class}
+ *     \cgalParamType{a model of `DelaunayTriangulationTraits_3` whose points have `double` coordinates,
+ *                    such as `Exact_predicates_inexact_constructions_kernel`}
+ *     \cgalParamDefault{a default-constructed traits object, deduced from the value type of `points`}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * @returns the past-the-end iterator of the output
+ *
+ * @pre the points of `points` are pairwise distinct.
+ */
+template <typename PointRange,
+          typename OutputIterator,
+          typename NamedParameters = parameters::Default_named_parameters>
+OutputIterator
+tiled_Delaunay_triangulation_3(const PointRange& points,
+                               OutputIterator out,
+                               const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename std::iterator_traits<typename PointRange::const_iterator>::value_type Point_3;
+  typedef typename Kernel_traits<Point_3>::Kernel                         Default_gt;
+  typedef typename internal_np::Lookup_named_param_def<internal_np::geom_traits_t,
+                                                       NamedParameters,
+                                                       Default_gt>::type  Gt;
+
+  typedef Triangulation_vertex_base_with_info_3<std::size_t, Gt>          Vb;
+  typedef Delaunay_triangulation_cell_base_3<Gt>                          Cb;
+  typedef Triangulation_data_structure_3<Vb, Cb>                          Tds;
+  typedef Delaunay_triangulation_3<Gt, Tds>                               DT;
+  typedef typename DT::Vertex_handle                                      Vertex_handle;
+  typedef typename DT::Cell_handle                                        Cell_handle;
+
+  typedef internal::Tile_grid_3                          Grid;
+  typedef internal::Tile_region_3                        Region;
+
+  const Gt gt = choose_parameter<Gt>(get_parameter(np, internal_np::geom_traits));
+
+  const std::size_t nb_points = points.size();
+  if(nb_points == 0)
+    return out;
+
+  std::size_t n = choose_parameter(get_parameter(np, internal_np::number_of_tiles_per_side), 0);
+  if(n == 0)
+    n = (std::max)(std::size_t(1),
+                   static_cast<std::size_t>(std::cbrt(double(nb_points) / 100000.)));
+
+  // Build the grid
+  Grid grid;
+  grid.n = n;
+  for(int a=0; a<3; ++a)
+  {
+    grid.lo[a] = (std::numeric_limits<double>::max)();
+    grid.hi[a] = std::numeric_limits<double>::lowest();
+  }
+  for(std::size_t i=0; i<nb_points; ++i)
+  {
+    for(int a=0; a<3; ++a)
+    {
+      const double x = to_double(points[i].cartesian(a));
+      grid.lo[a] = (std::min)(grid.lo[a], x);
+      grid.hi[a] = (std::max)(grid.hi[a], x);
+    }
+  }
+  for(int a=0; a<3; ++a)
+  {
+    grid.origin[a] = grid.lo[a];
+    grid.step[a] = (grid.hi[a] - grid.lo[a]) / double(n);
+  }
+
+  // Assign the points to tiles (counting sort) and record the exact slab extents
+  std::vector<std::size_t> point_tile(nb_points);
+  std::vector<std::size_t> tile_begin(n*n*n + 1, 0);
+  std::array<std::vector<double>, 3> slab_max, slab_min;
+  for(int a=0; a<3; ++a)
+  {
+    slab_max[a].assign(n, std::numeric_limits<double>::lowest());
+    slab_min[a].assign(n, (std::numeric_limits<double>::max)());
+  }
+
+  for(std::size_t i=0; i<nb_points; ++i)
+  {
+    std::array<std::size_t, 3> s;
+    for(int a=0; a<3; ++a)
+    {
+      const double x = to_double(points[i].cartesian(a));
+      s[a] = grid.slab(a, x);
+      slab_max[a][s[a]] = (std::max)(slab_max[a][s[a]], x);
+      slab_min[a][s[a]] = (std::min)(slab_min[a][s[a]], x);
+    }
+    point_tile[i] = grid.tile(s[0], s[1], s[2]);
+    ++tile_begin[point_tile[i] + 1];
+  }
+  for(std::size_t t=0; t<n*n*n; ++t)
+    tile_begin[t+1] += tile_begin[t];
+
+  std::vector<std::size_t> tile_points(nb_points);
+  {
+    std::vector<std::size_t> fill(tile_begin.begin(), tile_begin.end() - 1);
+    for(std::size_t i=0; i<nb_points; ++i)
+      tile_points[fill[point_tile[i]]++] = i;
+  }
+
+  for(int a=0; a<3; ++a)
+  {
+    grid.prefix_max[a].assign(n + 1, std::numeric_limits<double>::lowest());
+    grid.suffix_min[a].assign(n + 1, (std::numeric_limits<double>::max)());
+    for(std::size_t s=0; s<n; ++s)
+      grid.prefix_max[a][s+1] = (std::max)(grid.prefix_max[a][s], slab_max[a][s]);
+    for(std::size_t s=n; s>0; --s)
+      grid.suffix_min[a][s-1] = (std::min)(grid.suffix_min[a][s], slab_min[a][s-1]);
+  }
+
+  internal::Tiled_cell_certifier_3<Gt> certifier(grid, gt);
+
+  std::vector<std::pair<Point_3, std::size_t> > new_points;
+  std::vector<Cell_handle> star;
+  std::vector<Vertex_handle> pending, still_pending;
+
+  for(std::size_t ti=0; ti<n; ++ti)
+  for(std::size_t tj=0; tj<n; ++tj)
+  for(std::size_t tk=0; tk<n; ++tk)
+  {
+    const std::size_t t = grid.tile(ti, tj, tk);
+    if(tile_begin[t] == tile_begin[t+1])
+      continue;
+
+    DT dt(gt);
+    Region inserted = { {{ti, tj, tk}}, {{ti, tj, tk}} };
+    Region region = inserted;
+    bool first_round = true;
+
+    for(;;)
+    {
+      // insert the points of the tiles of `region` that are not in `inserted`
+      new_points.clear();
+      for(std::size_t i=region.ilo[0]; i<=region.ihi[0]; ++i)
+      for(std::size_t j=region.ilo[1]; j<=region.ihi[1]; ++j)
+      for(std::size_t k=region.ilo[2]; k<=region.ihi[2]; ++k)
+      {
+        if(!first_round &&
+           i >= inserted.ilo[0] && i <= inserted.ihi[0] &&
+           j >= inserted.ilo[1] && j <= inserted.ihi[1] &&
+           k >= inserted.ilo[2] && k <= inserted.ihi[2])
+          continue;
+
+        const std::size_t tt = grid.tile(i, j, k);
+        for(std::size_t p=tile_begin[tt]; p<tile_begin[tt+1]; ++p)
+          new_points.emplace_back(points[tile_points[p]], tile_points[p]);
+      }
+      dt.insert(new_points.begin(), new_points.end());
+      inserted = region;
+
+      if(first_round)
+      {
+        for(Vertex_handle v : dt.finite_vertex_handles())
+          if(point_tile[v->info()] == t)
+            pending.push_back(v);
+        first_round = false;
+      }
+
+      const bool whole = region.is_whole_grid(grid);
+      still_pending.clear();
+      for(Vertex_handle v : pending)
+      {
+        bool stable = true;
+        if(!whole)
+        {
+          if(dt.dimension() < 3)
+            stable = false;
+
+          star.clear();
+          if(stable)
+            dt.incident_cells(v, std::back_inserter(star));
+
+          for(std::size_t ci=0; stable && ci<star.size(); ++ci)
+          {
+            const Cell_handle c = star[ci];
+            if(dt.is_infinite(c))
+            {
+              const int inf = c->index(dt.infinite_vertex());
+              const Cell_handle nc = c->neighbor(inf);
+              const int j = nc->index(c);
+              stable = certifier.hull_facet(c->vertex((inf+1)&3)->point(),
+                                            c->vertex((inf+2)&3)->point(),
+                                            c->vertex((inf+3)&3)->point(),
+                                            nc->vertex(j)->point(), region);
+            }
+            else
+            {
+              stable = certifier.finite_cell(c->vertex(0)->point(), c->vertex(1)->point(),
+                                             c->vertex(2)->point(), c->vertex(3)->point(),
+                                             region);
+            }
+          }
+        }
+
+        if(!stable)
+        {
+          still_pending.push_back(v);
+          continue;
+        }
+
+        if(dt.dimension() < 3)
+          continue;
+
+        // the star of `v` is stable: report the cells whose smallest index is `v`'s
+        star.clear();
+        dt.finite_incident_cells(v, std::back_inserter(star));
+        for(Cell_handle c : star)
+        {
+          const std::array<std::size_t, 4> cell = { { c->vertex(0)->info(), c->vertex(1)->info(),
+                                                      c->vertex(2)->info(), c->vertex(3)->info() } };
+          if(*std::min_element(cell.begin(), cell.end()) == v->info())
+            *out++ = cell;
+        }
+      }
+
+      pending.swap(still_pending);
+      if(pending.empty())
+        break;
+
+      // grow the region by one ring of tiles
+      for(int a=0; a<3; ++a)
+      {
+        if(region.ilo[a] > 0) --region.ilo[a];
+        if(region.ihi[a] + 1 < n) ++region.ihi[a];
+      }
+    }
+  }
+
+  return out;
+}
+
+/*!
+ * \ingroup PkgTriangulation3Functions
+ *
+ * assembles a 3D triangulation from the finite cells of a triangulation,
+ * as produced for example by `tiled_Delaunay_triangulation_3()`.
+ * The infinite cells are created from the facets that are incident to a single finite cell.
+ *
+ * @tparam Triangulation a model of `Triangulation_3`
+ * @tparam PointRange a model of `RandomAccessRange` whose value type is convertible to `Triangulation::Point`
+ * @tparam CellRange a model of `Range` whose value type is `std::array<std::size_t, 4>`
+ *
+ * @param points the vertices of the triangulation
+ * @param cells the positively oriented finite cells of the triangulation,
+ *              given as indices in `points`
+ * @param tr the triangulation, cleared and filled by the function
+ *
+ * @pre `cells` is the set of finite cells of a valid three-dimensional triangulation of `points`.
+ */
+template <typename Triangulation, typename PointRange, typename CellRange>
+void merge_tiled_Delaunay_cells_3(const PointRange& points,
+                                  const CellRange& cells,
+                                  Triangulation& tr)
+{
+  typedef typename Triangulation::Vertex_handle                    Vertex_handle;
+  typedef typename Triangulation::Cell_handle                      Cell_handle;
+  typedef typename Triangulation::Point                            Point;
+  typedef std::array<Vertex_handle, 3>                             Facet_key;
+  typedef boost::unordered_map<Facet_key, std::pair<Cell_handle, int> > Facet_map;
+
+  tr.clear();
+  if(std::begin(cells) == std::end(cells))
+  {
+    tr.insert(points.begin(), points.end());
+    return;
+  }
+
+  tr.tds().clear(); // not tr.clear() since it calls tr.init()
+  tr.tds().set_dimension(3);
+
+  std::vector<Vertex_handle> vertices(points.size());
+  tr.set_infinite_vertex(tr.tds().create_vertex());
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    vertices[i] = tr.tds().create_vertex();
+    vertices[i]->set_point(Point(points[i]));
+  }
+
+  // glue the cells along their common facets; the facets left in the map
+  // after all cells have been created are incident to a single cell
+  Facet_map facets;
+  auto glue_facet = [&](Cell_handle c, int i)
+  {
+    Facet_key f = { { c->vertex((i+1)&3), c->vertex((i+2)&3), c->vertex((i+3)&3) } };
+    std::sort(f.begin(), f.end());
+    auto res = facets.emplace(f, std::make_pair(c, i));
+    if(!res.second)
+    {
+      tr.tds().set_adjacency(c, i, res.first->second.first, res.first->second.second);
+      facets.erase(res.first);
+    }
+  };
+
+  for(const std::array<std::size_t, 4>& ids : cells)
+  {
+    const Cell_handle c = tr.tds().create_cell(vertices[ids[0]], vertices[ids[1]],
+                                               vertices[ids[2]], vertices[ids[3]]);
+    for(int i=0; i<4; ++i)
+    {
+      vertices[ids[i]]->set_cell(c);
+      glue_facet(c, i);
+    }
+  }
+
+  // the remaining facets are on the convex hull: close them with infinite cells
+  std::vector<std::pair<Cell_handle, int> > hull_facets;
+  hull_facets.reserve(facets.size());
+  for(const auto& f : facets)
+    hull_facets.push_back(f.second);
+  facets.clear();
+
+  for(const std::pair<Cell_handle, int>& f : hull_facets)
+  {
+    const Cell_handle c = f.first;
+    const int i = f.second;
+
+    // the infinite cell must be positively oriented as seen from `c`
+    Cell_handle ic;
+    if(i == 0 || i == 2)
+      ic = tr.tds().create_cell(tr.infinite_vertex(), c->vertex((i+2)&3),
+                                c->vertex((i+1)&3), c->vertex((i+3)&3));
+    else
+      ic = tr.tds().create_cell(tr.infinite_vertex(), c->vertex((i+3)&3),
+                                c->vertex((i+1)&3), c->vertex((i+2)&3));
+
+    tr.tds().set_adjacency(ic, 0, c, i);
+    tr.infinite_vertex()->set_cell(ic);
+    for(int j=1; j<4; ++j)
+      glue_facet(ic, j);
+  }
+
+  CGAL_postcondition(facets.empty());
+}
+
+} // namespace CGAL
+
+#endif // CGAL_TILED_DELAUNAY_TRIANGULATION_3_H
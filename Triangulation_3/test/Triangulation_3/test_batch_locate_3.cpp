@@ -0,0 +1,69 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_3                                               Point;
+typedef CGAL::Delaunay_triangulation_3<K>                        DT;
+typedef std::tuple<DT::Cell_handle, DT::Locate_type, int, int>   Located_point;
+
+template <typename Tag>
+void check(const DT& dt, const std::vector<Point>& queries)
+{
+  std::vector<Located_point> res;
+  dt.locate(queries.begin(), queries.end(), std::back_inserter(res), Tag());
+  assert(res.size() == queries.size());
+
+  for(std::size_t i=0; i<queries.size(); ++i)
+  {
+    DT::Locate_type lt;
+    int li, lj;
+    DT::Cell_handle c = dt.locate(queries[i], lt, li, lj);
+    assert(std::get<1>(res[i]) == lt);
+
+    // the cell may differ for degenerate queries, but it must contain the query
+    DT::Locate_type lt2;
+    int li2, lj2;
+    assert(dt.side_of_cell(queries[i], std::get<0>(res[i]), lt2, li2, lj2) != CGAL::ON_UNBOUNDED_SIDE);
+    if(lt == DT::CELL)
+      assert(std::get<0>(res[i]) == c);
+    if(lt == DT::VERTEX)
+      assert(std::get<0>(res[i])->vertex(std::get<2>(res[i])) == c->vertex(li));
+  }
+}
+
+int main()
+{
+  CGAL::get_default_random() = CGAL::Random(0);
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_sphere_3<Point> gen(1.);
+  std::copy_n(gen, 5000, std::back_inserter(points));
+  DT dt(points.begin(), points.end());
+
+  // queries inside, outside the convex hull, and on vertices
+  std::vector<Point> queries;
+  CGAL::Random_points_in_cube_3<Point> qgen(1.2);
+  std::copy_n(qgen, 20000, std::back_inserter(queries));
+  queries.insert(queries.end(), points.begin(), points.begin() + 100);
+
+  check<CGAL::Sequential_tag>(dt, queries);
+#ifdef CGAL_LINKED_WITH_TBB
+  check<CGAL::Parallel_tag>(dt, queries);
+#endif
+
+  // empty range
+  std::vector<Located_point> res;
+  dt.locate(queries.end(), queries.end(), std::back_inserter(res));
+  assert(res.empty());
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
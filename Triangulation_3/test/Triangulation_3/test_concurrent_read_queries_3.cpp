@@ -0,0 +1,129 @@
+#define CGAL_TDS_3_THREADSAFE_ADJACENCY_QUERIES
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_3                                               Point;
+typedef CGAL::Delaunay_triangulation_3<K>                        DT;
+typedef DT::Vertex_handle                                        Vertex_handle;
+typedef DT::Cell_handle                                          Cell_handle;
+
+struct Vertex_queries
+{
+  std::set<Cell_handle> cells;
+  std::set<Cell_handle> finite_cells;
+  std::set<Vertex_handle> vertices;
+  std::set<Vertex_handle> finite_vertices;
+  std::size_t nb_facets = 0;
+  std::size_t nb_edges = 0;
+  std::size_t degree = 0;
+};
+
+template <bool threadsafe_api>
+Vertex_queries query(const DT& dt, Vertex_handle v)
+{
+  Vertex_queries q;
+  std::vector<Cell_handle> cells, finite_cells;
+  std::vector<Vertex_handle> vertices, finite_vertices;
+  std::vector<DT::Facet> facets;
+  std::vector<DT::Edge> edges;
+  if(threadsafe_api) {
+    dt.incident_cells_threadsafe(v, std::back_inserter(cells));
+    dt.finite_incident_cells_threadsafe(v, std::back_inserter(finite_cells));
+    dt.adjacent_vertices_threadsafe(v, std::back_inserter(vertices));
+    dt.finite_adjacent_vertices_threadsafe(v, std::back_inserter(finite_vertices));
+    dt.incident_facets_threadsafe(v, std::back_inserter(facets));
+    dt.incident_edges_threadsafe(v, std::back_inserter(edges));
+    q.degree = dt.degree_threadsafe(v);
+  } else {
+    dt.incident_cells(v, std::back_inserter(cells));
+    dt.finite_incident_cells(v, std::back_inserter(finite_cells));
+    dt.adjacent_vertices(v, std::back_inserter(vertices));
+    dt.finite_adjacent_vertices(v, std::back_inserter(finite_vertices));
+    dt.incident_facets(v, std::back_inserter(facets));
+    dt.incident_edges(v, std::back_inserter(edges));
+    q.degree = dt.degree(v);
+  }
+  q.cells.insert(cells.begin(), cells.end());
+  q.finite_cells.insert(finite_cells.begin(), finite_cells.end());
+  q.vertices.insert(vertices.begin(), vertices.end());
+  q.finite_vertices.insert(finite_vertices.begin(), finite_vertices.end());
+  assert(q.cells.size() == cells.size());
+  assert(q.vertices.size() == vertices.size());
+  q.nb_facets = facets.size();
+  q.nb_edges = edges.size();
+  return q;
+}
+
+bool operator==(const Vertex_queries& a, const Vertex_queries& b)
+{
+  return a.cells == b.cells && a.finite_cells == b.finite_cells &&
+         a.vertices == b.vertices && a.finite_vertices == b.finite_vertices &&
+         a.nb_facets == b.nb_facets && a.nb_edges == b.nb_edges &&
+         a.degree == b.degree;
+}
+
+int main()
+{
+  CGAL::get_default_random() = CGAL::Random(0);
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_sphere_3<Point> gen(1.);
+  std::copy_n(gen, 5000, std::back_inserter(points));
+  DT dt(points.begin(), points.end());
+  assert(dt.is_valid());
+
+  std::vector<Vertex_handle> vertices(dt.all_vertex_handles().begin(),
+                                      dt.all_vertex_handles().end());
+
+  // reference: the incident cells obtained from a global traversal
+  std::map<Vertex_handle, std::set<Cell_handle> > ref_cells;
+  for(Cell_handle c : dt.all_cell_handles())
+    for(int i=0; i<4; ++i)
+      ref_cells[c->vertex(i)].insert(c);
+
+  std::vector<Vertex_queries> ref(vertices.size());
+  for(std::size_t i=0; i<vertices.size(); ++i)
+  {
+    ref[i] = query<false>(dt, vertices[i]);
+    assert(ref[i].cells == ref_cells[vertices[i]]);
+    assert(ref[i].degree == ref[i].vertices.size());
+    assert(query<true>(dt, vertices[i]) == ref[i]);
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::vector<Vertex_queries> res(vertices.size()), res_ts(vertices.size());
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, vertices.size()),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+  {
+    for(std::size_t i=r.begin(); i!=r.end(); ++i) {
+      res[i] = query<false>(dt, vertices[i]);
+      res_ts[i] = query<true>(dt, vertices[i]);
+    }
+  });
+
+  for(std::size_t i=0; i<vertices.size(); ++i) {
+    assert(res[i] == ref[i]);
+    assert(res_ts[i] == ref[i]);
+  }
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
@@ -0,0 +1,143 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Incident_cells_map_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel      K;
+typedef K::Point_3                                               Point;
+
+// a cell base with an erase counter, to detect outdated stars
+template <typename Gt, typename Cb = CGAL::Delaunay_triangulation_cell_base_3<Gt> >
+struct Cell_base_with_erase_counter
+  : public Cb
+{
+  template <typename Tds2>
+  struct Rebind_TDS {
+    typedef typename Cb::template Rebind_TDS<Tds2>::Other Cb2;
+    typedef Cell_base_with_erase_counter<Gt, Cb2>        Other;
+  };
+
+  // user-provided constructors which, as Compact_container expects,
+  // do not reset the erase counter of a reused cell
+  Cell_base_with_erase_counter() {}
+
+  Cell_base_with_erase_counter(const Cell_base_with_erase_counter& other)
+    : Cb(other), m_erase_counter(other.erase_counter())
+  {}
+
+  template <typename... Args>
+  Cell_base_with_erase_counter(const Args&... args) : Cb(args...) {}
+
+  unsigned int erase_counter() const { return m_erase_counter; }
+  void set_erase_counter(unsigned int c) { m_erase_counter = c; }
+  void increment_erase_counter() { ++m_erase_counter; }
+
+private:
+  // atomic, so that the increment is not discarded as a dead store
+  // before the destruction of the cell
+  std::atomic<unsigned int> m_erase_counter;
+};
+
+typedef CGAL::Triangulation_data_structure_3<
+  CGAL::Triangulation_vertex_base_3<K>,
+  Cell_base_with_erase_counter<K> >                              Tds;
+typedef CGAL::Delaunay_triangulation_3<K, Tds>                   DT;
+typedef DT::Vertex_handle                                        Vertex_handle;
+typedef DT::Cell_handle                                          Cell_handle;
+typedef CGAL::Incident_cells_map_3<Tds>                          Map;
+
+static_assert(Map::Tracks_erased_cells);
+static_assert(!CGAL::Incident_cells_map_3<
+                CGAL::Delaunay_triangulation_3<K>::Triangulation_data_structure>::Tracks_erased_cells);
+
+bool same_star(const DT& dt, const Map& map, Vertex_handle v)
+{
+  std::vector<Cell_handle> cells, cached;
+  dt.incident_cells(v, std::back_inserter(cells));
+  for(Cell_handle c : map.incident_cells(v))
+    cached.push_back(c);
+  std::sort(cells.begin(), cells.end());
+  std::sort(cached.begin(), cached.end());
+  return cells == cached;
+}
+
+template <typename Tag>
+void test(DT dt)
+{
+  Map map(dt.tds(), Tag());
+  assert(map.number_of_vertices() == dt.number_of_vertices() + 1);
+  for(Vertex_handle v : dt.all_vertex_handles())
+  {
+    assert(map.is_cached(v));
+    assert(map.is_up_to_date(v));
+    assert(same_star(dt, map, v));
+
+    // same order as the threadsafe query
+    std::vector<Cell_handle> cells;
+    dt.incident_cells_threadsafe(v, std::back_inserter(cells));
+    assert(std::equal(cells.begin(), cells.end(),
+                      map.incident_cells(v).begin(), map.incident_cells(v).end()));
+  }
+
+  // modify the triangulation, and refresh the outdated stars
+  CGAL::Random rnd(1);
+  for(int round=0; round<5; ++round)
+  {
+    std::vector<Vertex_handle> to_remove;
+    for(Vertex_handle v : dt.finite_vertex_handles())
+      if(rnd.get_int(0, 50) == 0)
+        to_remove.push_back(v);
+    for(Vertex_handle v : to_remove)
+      dt.remove(v);
+    CGAL::Random_points_in_sphere_3<Point> gen(1., rnd);
+    for(int i=0; i<200; ++i)
+      dt.insert(*gen++);
+
+    std::vector<Vertex_handle> outdated;
+    std::size_t nb_up_to_date = 0;
+    for(Vertex_handle v : dt.all_vertex_handles())
+    {
+      if(map.is_up_to_date(v)) {
+        ++nb_up_to_date;
+        assert(same_star(dt, map, v));
+      }
+      else
+        outdated.push_back(v);
+    }
+    assert(nb_up_to_date > 0 && !outdated.empty());
+
+    map.update(dt.tds(), outdated.begin(), outdated.end(), Tag());
+    for(Vertex_handle v : dt.all_vertex_handles())
+    {
+      assert(map.is_up_to_date(v));
+      assert(same_star(dt, map, v));
+    }
+  }
+}
+
+int main()
+{
+  CGAL::get_default_random() = CGAL::Random(0);
+
+  std::vector<Point> points;
+  CGAL::Random_points_in_sphere_3<Point> gen(1.);
+  std::copy_n(gen, 5000, std::back_inserter(points));
+  DT dt(points.begin(), points.end());
+  assert(dt.is_valid());
+
+  test<CGAL::Sequential_tag>(dt);
+#ifdef CGAL_LINKED_WITH_TBB
+  test<CGAL::Parallel_tag>(dt);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
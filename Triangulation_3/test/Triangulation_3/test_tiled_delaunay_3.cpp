@@ -0,0 +1,114 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+#include <CGAL/tiled_Delaunay_triangulation_3.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <set>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel              K;
+typedef K::Point_3                                                       Point;
+
+typedef CGAL::Triangulation_vertex_base_with_info_3<std::size_t, K>      Vb;
+typedef CGAL::Delaunay_triangulation_cell_base_3<K>                      Cb;
+typedef CGAL::Triangulation_data_structure_3<Vb, Cb>                     Tds;
+typedef CGAL::Delaunay_triangulation_3<K, Tds>                           DT_with_info;
+typedef CGAL::Delaunay_triangulation_3<K>                                DT;
+
+typedef std::array<std::size_t, 4>                                       Cell;
+
+// canonical form of a positively oriented cell: smallest index first,
+// keeping the orientation
+Cell canonical(Cell c)
+{
+  std::size_t m = std::min_element(c.begin(), c.end()) - c.begin();
+  // rotate by an even permutation to put the minimum first
+  switch(m)
+  {
+    case 1: c = {{ c[1], c[0], c[3], c[2] }}; break;
+    case 2: c = {{ c[2], c[3], c[0], c[1] }}; break;
+    case 3: c = {{ c[3], c[2], c[1], c[0] }}; break;
+    default: break;
+  }
+  // even permutations of the last three vertices
+  Cell best = c;
+  for(int i=0; i<2; ++i)
+  {
+    c = {{ c[0], c[2], c[3], c[1] }};
+    if(c < best) best = c;
+  }
+  return best;
+}
+
+void test(const std::vector<Point>& points, std::size_t tiles)
+{
+  // reference
+  std::vector<std::pair<Point, std::size_t> > pts;
+  for(std::size_t i=0; i<points.size(); ++i)
+    pts.emplace_back(points[i], i);
+  DT_with_info reference(pts.begin(), pts.end());
+
+  std::set<Cell> expected;
+  for(auto c : reference.finite_cell_handles())
+    expected.insert(canonical({{ c->vertex(0)->info(), c->vertex(1)->info(),
+                                 c->vertex(2)->info(), c->vertex(3)->info() }}));
+
+  std::vector<Cell> cells;
+  CGAL::tiled_Delaunay_triangulation_3(points, std::back_inserter(cells),
+                                       CGAL::parameters::number_of_tiles_per_side(tiles));
+
+  std::set<Cell> computed;
+  for(const Cell& c : cells)
+  {
+    bool inserted = computed.insert(canonical(c)).second;
+    assert(inserted); // each cell is reported exactly once
+    CGAL_USE(inserted);
+  }
+  assert(computed == expected);
+
+  DT merged;
+  CGAL::merge_tiled_Delaunay_cells_3(points, cells, merged);
+  assert(merged.is_valid());
+  assert(merged.number_of_vertices() == reference.number_of_vertices());
+  assert(merged.number_of_finite_cells() == reference.number_of_finite_cells());
+  assert(merged.number_of_cells() == reference.number_of_cells());
+
+  std::cout << points.size() << " points, " << tiles << "^3 tiles: "
+            << cells.size() << " cells" << std::endl;
+}
+
+int main()
+{
+  CGAL::get_default_random() = CGAL::Random(0);
+
+  // random points in a cube
+  std::vector<Point> points;
+  CGAL::Random_points_in_cube_3<Point> gen(1.);
+  std::copy_n(gen, 3000, std::back_inserter(points));
+  test(points, 1);
+  test(points, 3);
+  test(points, 5);
+
+  // random points on a sphere: large empty balls
+  points.clear();
+  CGAL::Random_points_on_sphere_3<Point> sgen(1.);
+  std::copy_n(sgen, 400, std::back_inserter(points));
+  test(points, 4);
+
+  // degenerate input: points on a grid
+  points.clear();
+  for(int i=0; i<8; ++i)
+    for(int j=0; j<8; ++j)
+      for(int k=0; k<8; ++k)
+        points.emplace_back(i, j, k);
+  test(points, 3);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}